@@ -15,10 +15,17 @@
 #include <functional>
 #include <vector>
 #include <unordered_map>
+#include <ctime>
 
+#ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
 #include <Windows.h>
+#else
+#include <mutex>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace USS
 {
@@ -33,18 +40,33 @@ namespace USS
     class FCriticalSection
     {
     public:
+#ifdef _WIN32
         FCriticalSection() { InitializeCriticalSection(&m_CS); }
         ~FCriticalSection() { DeleteCriticalSection(&m_CS); }
+#else
+        FCriticalSection() = default;
+        ~FCriticalSection() = default;
+#endif
 
         FCriticalSection(const FCriticalSection&) = delete;
         FCriticalSection& operator=(const FCriticalSection&) = delete;
 
+#ifdef _WIN32
         void Lock() { EnterCriticalSection(&m_CS); }
         void Unlock() { LeaveCriticalSection(&m_CS); }
         bool TryLock() { return TryEnterCriticalSection(&m_CS) != 0; }
 
     private:
         CRITICAL_SECTION m_CS;
+#else
+        // Recursive, like CRITICAL_SECTION - only tools and tests run here
+        void Lock() { m_Mutex.lock(); }
+        void Unlock() { m_Mutex.unlock(); }
+        bool TryLock() { return m_Mutex.try_lock(); }
+
+    private:
+        std::recursive_mutex m_Mutex;
+#endif
     };
 
     /**
@@ -75,6 +97,33 @@ namespace USS
     using uintptr = uintptr_t;
     using intptr = intptr_t;
 
+    // ========================================================================
+    // Platform Helpers
+    // ========================================================================
+
+    namespace Platform
+    {
+        // OS thread id - the one debuggers and crash dumps show
+        inline uint32 GetCurrentThreadId()
+        {
+#ifdef _WIN32
+            return ::GetCurrentThreadId();
+#else
+            return static_cast<uint32>(syscall(SYS_gettid));
+#endif
+        }
+
+        // Thread-safe localtime
+        inline bool LocalTime(time_t Seconds, struct tm& Out)
+        {
+#ifdef _WIN32
+            return localtime_s(&Out, &Seconds) == 0;
+#else
+            return localtime_r(&Seconds, &Out) != nullptr;
+#endif
+        }
+    }
+
     enum class EResult : uint8
     {
         Success = 0,
@@ -85,6 +134,7 @@ namespace USS
         HookFailed,
         AlreadyInitialized,
         NotInitialized,
+        Timeout,
 
         InvalidState,
         InvalidParameter,
@@ -113,6 +163,7 @@ namespace USS
         case EResult::HookFailed:           return "HookFailed";
         case EResult::AlreadyInitialized:   return "AlreadyInitialized";
         case EResult::NotInitialized:       return "NotInitialized";
+        case EResult::Timeout:              return "Timeout";
         case EResult::InvalidState:         return "InvalidState";
         case EResult::InvalidParameter:     return "InvalidParameter";
         case EResult::InsufficientResources:return "InsufficientResources";
@@ -137,16 +188,59 @@ namespace USS
         ClassName(ClassName&&) = delete; \
         ClassName& operator=(ClassName&&) = delete;
 
+// Levels below this are compiled out - call sites and arguments vanish.
+// Matches ELogLevel: 0 Trace, 1 Debug, 2 Info, 3 Warning, 4 Error, 5 Fatal
+#ifndef USS_LOG_COMPILE_LEVEL
 #ifdef USS_DEBUG
-#define USS_LOG(fmt, ...) ::USS::Log::Write(::USS::ELogLevel::Info, fmt, ##__VA_ARGS__)
-#define USS_WARN(fmt, ...) ::USS::Log::Write(::USS::ELogLevel::Warning, fmt, ##__VA_ARGS__)
-#define USS_ERROR(fmt, ...) ::USS::Log::Write(::USS::ELogLevel::Error, fmt, ##__VA_ARGS__)
+#define USS_LOG_COMPILE_LEVEL 0
+#else
+#define USS_LOG_COMPILE_LEVEL 5
+#endif
+#endif
+
+// Each call site registers its format once and queues only raw arguments
+// (see Core/Logging/LogFormat.h). Rate is messages per second for this
+// site; 0 uses Log::SetSiteRateLimit.
+#define USS_LOG_SITE_RATE(Level, Rate, fmt, ...) \
+        do { \
+            static const ::USS::FLogSite UssLogSite(Level, fmt, __FILE__, __LINE__, Rate); \
+            ::USS::Log::WriteSite(UssLogSite, ##__VA_ARGS__); \
+        } while (0)
+
+#define USS_LOG_SITE(Level, fmt, ...) USS_LOG_SITE_RATE(Level, 0, fmt, ##__VA_ARGS__)
+
+#if USS_LOG_COMPILE_LEVEL <= 0
+#define USS_TRACE(fmt, ...) USS_LOG_SITE(::USS::ELogLevel::Trace, fmt, ##__VA_ARGS__)
+#else
+#define USS_TRACE(fmt, ...) ((void)0)
+#endif
+
+#if USS_LOG_COMPILE_LEVEL <= 1
+#define USS_VERBOSE(fmt, ...) USS_LOG_SITE(::USS::ELogLevel::Debug, fmt, ##__VA_ARGS__)
+#else
+#define USS_VERBOSE(fmt, ...) ((void)0)
+#endif
+
+#if USS_LOG_COMPILE_LEVEL <= 2
+#define USS_LOG(fmt, ...) USS_LOG_SITE(::USS::ELogLevel::Info, fmt, ##__VA_ARGS__)
+#define USS_LOG_RATE(PerSecond, fmt, ...) USS_LOG_SITE_RATE(::USS::ELogLevel::Info, PerSecond, fmt, ##__VA_ARGS__)
 #else
 #define USS_LOG(fmt, ...) ((void)0)
+#define USS_LOG_RATE(PerSecond, fmt, ...) ((void)0)
+#endif
+
+#if USS_LOG_COMPILE_LEVEL <= 3
+#define USS_WARN(fmt, ...) USS_LOG_SITE(::USS::ELogLevel::Warning, fmt, ##__VA_ARGS__)
+#else
 #define USS_WARN(fmt, ...) ((void)0)
+#endif
+
+#if USS_LOG_COMPILE_LEVEL <= 4
+#define USS_ERROR(fmt, ...) USS_LOG_SITE(::USS::ELogLevel::Error, fmt, ##__VA_ARGS__)
+#else
 #define USS_ERROR(fmt, ...) ((void)0)
 #endif
 
-#define USS_FATAL(fmt, ...) ::USS::Log::Write(::USS::ELogLevel::Fatal, fmt, ##__VA_ARGS__)
+#define USS_FATAL(fmt, ...) USS_LOG_SITE(::USS::ELogLevel::Fatal, fmt, ##__VA_ARGS__)
 
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
  */
 
 #include "CrashHandler.h"
+#include "FlightRecorder.h"
 #include "../Logging/Log.h"
 
 #include <DbgHelp.h>
@@ -17,6 +18,8 @@ namespace USS
     bool FCrashHandler::s_bInitialized = false;
     bool FCrashHandler::s_bShowMessageBox = true;
     bool FCrashHandler::s_bWriteMinidump = true;
+    bool FCrashHandler::s_bWriteFlightRecorder = true;
+    char FCrashHandler::s_CrashTimestamp[32] = {};
     LPTOP_LEVEL_EXCEPTION_FILTER FCrashHandler::s_pPreviousFilter = nullptr;
     std::terminate_handler FCrashHandler::s_pPreviousTerminate = nullptr;
 
@@ -295,19 +298,28 @@ namespace USS
     // Minidump Writing
     // ========================================================================
 
+    void FCrashHandler::GetCrashFilePath(char* OutPath, size_t PathSize, const char* Extension)
+    {
+        // Fixed on first use so the dump and flight record pair up
+        if (!s_CrashTimestamp[0])
+        {
+            time_t Now = time(nullptr);
+            struct tm TimeInfo;
+            localtime_s(&TimeInfo, &Now);
+
+            strftime(s_CrashTimestamp, sizeof(s_CrashTimestamp), "%Y%m%d_%H%M%S", &TimeInfo);
+        }
+
+        snprintf(OutPath, PathSize, "USS_Crash_%s.%s", s_CrashTimestamp, Extension);
+    }
+
     void FCrashHandler::WriteMinidumpFile(EXCEPTION_POINTERS* pExceptionInfo)
     {
         if (!s_bWriteMinidump)
             return;
 
         char DumpPath[MAX_PATH];
-        time_t Now = time(nullptr);
-        struct tm TimeInfo;
-        localtime_s(&TimeInfo, &Now);
-
-        char Timestamp[64];
-        strftime(Timestamp, sizeof(Timestamp), "%Y%m%d_%H%M%S", &TimeInfo);
-        snprintf(DumpPath, sizeof(DumpPath), "USS_Crash_%s.dmp", Timestamp);
+        GetCrashFilePath(DumpPath, sizeof(DumpPath), "dmp");
 
         HANDLE hFile = CreateFileA(DumpPath, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
         if (hFile == INVALID_HANDLE_VALUE)
@@ -342,6 +354,24 @@ namespace USS
         }
     }
 
+    void FCrashHandler::WriteFlightRecorderFile()
+    {
+        if (!s_bWriteFlightRecorder)
+            return;
+
+        char RecordPath[MAX_PATH];
+        GetCrashFilePath(RecordPath, sizeof(RecordPath), "flight.txt");
+
+        if (FFlightRecorder::WriteToFile(RecordPath) == EResult::Success)
+        {
+            Log::Write(ELogLevel::Fatal, "Flight recorder written to: %s", RecordPath);
+        }
+        else
+        {
+            Log::Write(ELogLevel::Fatal, "Failed to write flight recorder (error: %lu)", GetLastError());
+        }
+    }
+
     // ========================================================================
     // Exception Handlers
     // ========================================================================
@@ -352,6 +382,8 @@ namespace USS
 
         WriteMinidumpFile(pExceptionInfo);
 
+        WriteFlightRecorderFile();
+
         if (s_bShowMessageBox)
         {
             char Message[512];
@@ -400,6 +432,8 @@ namespace USS
 
         CaptureAndLogCallstack(nullptr);
 
+        WriteFlightRecorderFile();
+
         if (s_bShowMessageBox)
         {
             MessageBoxA(nullptr,
@@ -425,6 +459,8 @@ namespace USS
 
         CaptureAndLogCallstack(nullptr);
 
+        WriteFlightRecorderFile();
+
         if (s_bShowMessageBox)
         {
             MessageBoxA(nullptr,
@@ -461,6 +497,8 @@ namespace USS
 
         CaptureAndLogCallstack(nullptr);
 
+        WriteFlightRecorderFile();
+
         if (s_bShowMessageBox)
         {
             MessageBoxA(nullptr,
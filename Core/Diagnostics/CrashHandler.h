@@ -3,6 +3,9 @@
  *
  * Catches all unhandled exceptions (C++ and SEH) and logs callstack
  * information before terminating. Essential for debugging DLL injection issues.
+ *
+ * Each crash also writes USS_Crash_<time>.flight.txt next to the minidump:
+ * the FFlightRecorder history of recent log records and ProcessEvents.
  */
 
 #pragma once
@@ -77,6 +80,12 @@ namespace USS
          */
         static void SetWriteMinidump(bool bWrite) { s_bWriteMinidump = bWrite; }
 
+        /**
+         * Set whether to write the flight recorder file on crash
+         * Default is true
+         */
+        static void SetWriteFlightRecorder(bool bWrite) { s_bWriteFlightRecorder = bWrite; }
+
     private:
         // Internal handlers
         static LONG WINAPI UnhandledExceptionHandler(EXCEPTION_POINTERS* pExceptionInfo);
@@ -94,13 +103,17 @@ namespace USS
         static void LogExceptionInfo(EXCEPTION_POINTERS* pExceptionInfo);
         static EExceptionType GetExceptionType(DWORD ExceptionCode);
 
-        // Minidump writing
+        // Crash artifacts, named USS_Crash_<time of first crash>.<Extension>
+        static void GetCrashFilePath(char* OutPath, size_t PathSize, const char* Extension);
         static void WriteMinidumpFile(EXCEPTION_POINTERS* pExceptionInfo);
+        static void WriteFlightRecorderFile();
 
         // State
         static bool s_bInitialized;
         static bool s_bShowMessageBox;
         static bool s_bWriteMinidump;
+        static bool s_bWriteFlightRecorder;
+        static char s_CrashTimestamp[32];
         static LPTOP_LEVEL_EXCEPTION_FILTER s_pPreviousFilter;
         static std::terminate_handler s_pPreviousTerminate;
     };
@@ -0,0 +1,332 @@
+/**
+ * UniversalSlashingSimulator - Flight Recorder Implementation
+ */
+
+#include "FlightRecorder.h"
+#include "../Logging/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <ctime>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace USS
+{
+    /**
+     * Sequence is position + 1 once the event is complete; a dump only
+     * trusts slots whose sequence matches and wasn't lapped meanwhile.
+     */
+    struct FFlightRecorder::FEvent
+    {
+        std::atomic<uint64> Sequence;
+        int64 TimeUs;
+        void* Object;
+        void* Function;
+        uint32 ThreadId;
+        uint8 Tag;
+    };
+
+    /**
+     * Open-addressed UFunction* -> name. Key goes null -> Claimed while
+     * the name is copied, then to the function pointer.
+     */
+    struct FFlightRecorder::FFunctionName
+    {
+        std::atomic<void*> Key;
+        char Name[FunctionNameLength];
+    };
+
+    FFlightRecorder::FEvent FFlightRecorder::s_Events[FFlightRecorder::EventCapacity];
+    std::atomic<uint64> FFlightRecorder::s_EventPos(0);
+    FFlightRecorder::FFunctionName FFlightRecorder::s_FunctionNames[FFlightRecorder::FunctionNameSlots];
+    const char* const* FFlightRecorder::s_TagNames = nullptr;
+    uint32 FFlightRecorder::s_TagNameCount = 0;
+
+    namespace
+    {
+        void* const ClaimedKey = reinterpret_cast<void*>(1);
+
+        uint32 HashPointer(void* Pointer)
+        {
+            uint64 Value = reinterpret_cast<uintptr>(Pointer);
+            Value ^= Value >> 33;
+            Value *= 0xFF51AFD7ED558CCDull;
+            Value ^= Value >> 33;
+            return static_cast<uint32>(Value);
+        }
+
+        // Raw file calls only - WriteToFile may run from a crash handler
+#ifdef _WIN32
+        using FFileHandle = HANDLE;
+
+        FFileHandle OpenDumpFile(const char* FilePath)
+        {
+            return CreateFileA(FilePath, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        }
+
+        bool IsValidFile(FFileHandle File) { return File != INVALID_HANDLE_VALUE; }
+
+        void WriteDumpFile(FFileHandle File, const char* Data, uint32 Size)
+        {
+            DWORD Written = 0;
+            WriteFile(File, Data, Size, &Written, nullptr);
+        }
+
+        void CloseDumpFile(FFileHandle File) { CloseHandle(File); }
+#else
+        using FFileHandle = int;
+
+        FFileHandle OpenDumpFile(const char* FilePath)
+        {
+            return open(FilePath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        }
+
+        bool IsValidFile(FFileHandle File) { return File >= 0; }
+
+        void WriteDumpFile(FFileHandle File, const char* Data, uint32 Size)
+        {
+            while (Size > 0)
+            {
+                ssize_t Written = write(File, Data, Size);
+                if (Written <= 0)
+                    return;
+
+                Data += Written;
+                Size -= static_cast<uint32>(Written);
+            }
+        }
+
+        void CloseDumpFile(FFileHandle File) { close(File); }
+#endif
+
+        /**
+         * Buffered writer over a raw file handle
+         */
+        class FDumpWriter
+        {
+        public:
+            explicit FDumpWriter(FFileHandle File)
+                : m_File(File)
+                , m_Used(0)
+            {}
+
+            ~FDumpWriter() { Flush(); }
+
+            void Write(const char* Text, uint32 Length)
+            {
+                while (Length > 0)
+                {
+                    if (m_Used == sizeof(m_Buffer))
+                        Flush();
+
+                    uint32 Chunk = std::min<uint32>(Length, sizeof(m_Buffer) - m_Used);
+                    memcpy(m_Buffer + m_Used, Text, Chunk);
+                    m_Used += Chunk;
+                    Text += Chunk;
+                    Length -= Chunk;
+                }
+            }
+
+            void Printf(const char* Format, ...)
+            {
+                char Line[512];
+
+                va_list Args;
+                va_start(Args, Format);
+                int Length = vsnprintf(Line, sizeof(Line), Format, Args);
+                va_end(Args);
+
+                if (Length > 0)
+                    Write(Line, std::min<uint32>(static_cast<uint32>(Length), sizeof(Line) - 1));
+            }
+
+            void Flush()
+            {
+                if (m_Used == 0)
+                    return;
+
+                WriteDumpFile(m_File, m_Buffer, m_Used);
+                m_Used = 0;
+            }
+
+        private:
+            FFileHandle m_File;
+            uint32 m_Used;
+            char m_Buffer[4096];
+        };
+
+        // HH:MM:SS.uuuuuu local time
+        void FormatEventTime(int64 TimeUs, char* Out, size_t OutSize)
+        {
+            time_t Seconds = static_cast<time_t>(TimeUs / 1000000);
+
+            struct tm TimeInfo;
+            Platform::LocalTime(Seconds, TimeInfo);
+
+            size_t Length = strftime(Out, OutSize, "%H:%M:%S", &TimeInfo);
+            snprintf(Out + Length, OutSize - Length, ".%06d", static_cast<int32>(TimeUs % 1000000));
+        }
+
+        void WriteLogLine(const char* Line, uint32 Length, void* Context)
+        {
+            static_cast<FDumpWriter*>(Context)->Write(Line, Length);
+        }
+    }
+
+    void FFlightRecorder::RecordEvent(void* Object, void* Function, uint8 Tag)
+    {
+        uint64 Pos = s_EventPos.fetch_add(1, std::memory_order_relaxed);
+        FEvent& Event = s_Events[Pos & (EventCapacity - 1)];
+
+        // Invalidate first so a dump racing this write skips the slot
+        Event.Sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        Event.TimeUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        Event.Object = Object;
+        Event.Function = Function;
+        Event.ThreadId = Platform::GetCurrentThreadId();
+        Event.Tag = Tag;
+
+        Event.Sequence.store(Pos + 1, std::memory_order_release);
+    }
+
+    void FFlightRecorder::NoteFunctionName(void* Function, const char* Name)
+    {
+        if (!Function || Function == ClaimedKey || !Name)
+            return;
+
+        uint32 Index = HashPointer(Function);
+
+        for (uint32 Probe = 0; Probe < FunctionNameSlots; ++Probe, ++Index)
+        {
+            FFunctionName& Slot = s_FunctionNames[Index & (FunctionNameSlots - 1)];
+            void* Key = Slot.Key.load(std::memory_order_acquire);
+
+            if (Key == Function)
+                return;
+
+            if (Key != nullptr)
+                continue;
+
+            void* Expected = nullptr;
+            if (!Slot.Key.compare_exchange_strong(Expected, ClaimedKey, std::memory_order_acq_rel))
+            {
+                if (Expected == Function)
+                    return;
+                continue;
+            }
+
+            snprintf(Slot.Name, sizeof(Slot.Name), "%s", Name);
+            Slot.Key.store(Function, std::memory_order_release);
+            return;
+        }
+
+        // Table full - the dump falls back to the raw pointer
+    }
+
+    const char* FFlightRecorder::FindFunctionName(void* Function)
+    {
+        if (!Function)
+            return nullptr;
+
+        uint32 Index = HashPointer(Function);
+
+        for (uint32 Probe = 0; Probe < FunctionNameSlots; ++Probe, ++Index)
+        {
+            FFunctionName& Slot = s_FunctionNames[Index & (FunctionNameSlots - 1)];
+            void* Key = Slot.Key.load(std::memory_order_acquire);
+
+            if (Key == Function)
+                return Slot.Name;
+
+            if (Key == nullptr)
+                return nullptr;
+        }
+
+        return nullptr;
+    }
+
+    void FFlightRecorder::SetTagNames(const char* const* Names, uint32 Count)
+    {
+        s_TagNames = Names;
+        s_TagNameCount = Names ? Count : 0;
+    }
+
+    EResult FFlightRecorder::WriteToFile(const char* FilePath)
+    {
+        if (!FilePath)
+            return EResult::InvalidParameter;
+
+        FFileHandle hFile = OpenDumpFile(FilePath);
+        if (!IsValidFile(hFile))
+            return EResult::Failed;
+
+        {
+            FDumpWriter Writer(hFile);
+
+            Writer.Printf("UniversalSlashingSimulator flight recorder\r\n\r\n");
+
+            // Log records - includes ones the writer thread never got to
+            Writer.Printf("==== Recent log records ====\r\n");
+            uint32 LogRecords = Log::DumpRecent(&WriteLogLine, &Writer);
+            Writer.Printf("(%u records, %llu dropped since start)\r\n\r\n",
+                LogRecords, static_cast<unsigned long long>(Log::GetDroppedCount()));
+
+            // ProcessEvent history, oldest first
+            const uint64 End = s_EventPos.load(std::memory_order_acquire);
+            const uint64 Begin = (End > EventCapacity) ? End - EventCapacity : 0;
+
+            Writer.Printf("==== Recent ProcessEvent calls (%llu total) ====\r\n",
+                static_cast<unsigned long long>(End));
+
+            for (uint64 Pos = Begin; Pos < End; ++Pos)
+            {
+                const FEvent& Slot = s_Events[Pos & (EventCapacity - 1)];
+
+                if (Slot.Sequence.load(std::memory_order_acquire) != Pos + 1)
+                    continue;
+
+                FEvent Event;
+                Event.TimeUs = Slot.TimeUs;
+                Event.Object = Slot.Object;
+                Event.Function = Slot.Function;
+                Event.ThreadId = Slot.ThreadId;
+                Event.Tag = Slot.Tag;
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (Slot.Sequence.load(std::memory_order_relaxed) != Pos + 1)
+                    continue;
+
+                const char* FunctionName = FindFunctionName(Event.Function);
+                const char* TagName = (Event.Tag < s_TagNameCount) ? s_TagNames[Event.Tag] : nullptr;
+
+                char Time[32];
+                FormatEventTime(Event.TimeUs, Time, sizeof(Time));
+
+                char Line[256];
+                int Length = snprintf(Line, sizeof(Line), "[%s] tid %-6u  %-20s  %s (%p)  obj %p\r\n",
+                    Time,
+                    Event.ThreadId,
+                    TagName ? TagName : "-",
+                    FunctionName ? FunctionName : "?",
+                    Event.Function,
+                    Event.Object);
+
+                if (Length > 0)
+                    Writer.Write(Line, std::min<uint32>(static_cast<uint32>(Length), sizeof(Line) - 1));
+            }
+        }
+
+        CloseDumpFile(hFile);
+        return EResult::Success;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+/**
+ * UniversalSlashingSimulator - Flight Recorder
+ *
+ * Always-on, fixed-size history of recent ProcessEvent traffic, dumped
+ * by FCrashHandler next to the minidump together with the most recent
+ * records still sitting in the log ring (see Log::DumpRecent). Nothing
+ * here allocates after startup: events go into a static lock-free ring,
+ * function names into a static table, and the dump is rendered through
+ * stack buffers straight into a Win32 file handle.
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include <atomic>
+
+namespace USS
+{
+    /**
+     * Flight Recorder - process-wide, static like FCrashHandler
+     */
+    class FFlightRecorder
+    {
+    public:
+        static constexpr uint32 EventCapacity = 2048;       // Power of two
+        static constexpr uint32 FunctionNameSlots = 4096;   // Power of two
+        static constexpr uint32 FunctionNameLength = 64;
+
+        /**
+         * Record one ProcessEvent
+         * @param Tag - Caller-defined classification, see SetTagNames
+         */
+        static void RecordEvent(void* Object, void* Function, uint8 Tag);
+
+        /**
+         * Remember a function's name so the dump can print it without
+         * touching the engine (call once, when the name is first resolved)
+         */
+        static void NoteFunctionName(void* Function, const char* Name);
+
+        /**
+         * Names printed for event tags; the array must outlive the process
+         */
+        static void SetTagNames(const char* const* Names, uint32 Count);
+
+        /**
+         * Write recent log records and events to a text file
+         * Safe to call from a crash handler - no heap use
+         */
+        static EResult WriteToFile(const char* FilePath);
+
+        static uint64 GetEventCount() { return s_EventPos.load(std::memory_order_relaxed); }
+
+    private:
+        FFlightRecorder() = default;
+
+        struct FEvent;
+        struct FFunctionName;
+
+        static const char* FindFunctionName(void* Function);
+
+        static FEvent s_Events[EventCapacity];
+        static std::atomic<uint64> s_EventPos;
+
+        static FFunctionName s_FunctionNames[FunctionNameSlots];
+
+        static const char* const* s_TagNames;
+        static uint32 s_TagNameCount;
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,432 @@
+/**
+ * UniversalSlashingSimulator - Frame Profiler Implementation
+ */
+
+#include "Profiler.h"
+#include "../Logging/Log.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+namespace USS
+{
+    /**
+     * Single-writer ring owned by one thread. The owner publishes with a
+     * release store of WriteCount; readers copy the slots and re-check the
+     * count to discard anything overwritten while they were copying.
+     */
+    struct FProfiler::FThreadBuffer
+    {
+        std::unique_ptr<FProfileEvent[]> Events;
+        std::atomic<uint64> WriteCount;
+        std::atomic<uint64> ReadFloor;      // Events before this were Reset()
+        uint32 ThreadIndex;
+        uint16 Depth;
+
+        explicit FThreadBuffer(uint32 InThreadIndex)
+            : Events(new FProfileEvent[RingCapacity])
+            , WriteCount(0)
+            , ReadFloor(0)
+            , ThreadIndex(InThreadIndex)
+            , Depth(0)
+        {}
+    };
+
+    std::atomic<bool> FProfiler::s_bEnabled(true);
+    const std::chrono::steady_clock::time_point FProfiler::s_Epoch = std::chrono::steady_clock::now();
+
+    namespace
+    {
+        FCriticalSection& GetRegistryLock()
+        {
+            static FCriticalSection Lock;
+            return Lock;
+        }
+
+        // Zone names - indices are zone ids
+        std::vector<std::string>& GetZoneNames()
+        {
+            static std::vector<std::string> Names;
+            return Names;
+        }
+
+        // Hook counter names - indices are counter ids
+        std::vector<std::string>& GetCounterNames()
+        {
+            static std::vector<std::string> Names;
+            return Names;
+        }
+
+        // One cache line per counter so hooks on different threads don't share
+        struct alignas(64) FCounterSlot
+        {
+            std::atomic<uint64> Calls{ 0 };
+            std::atomic<uint64> Cycles{ 0 };
+        };
+
+        FCounterSlot g_Counters[FProfiler::MaxCounters];
+
+        double Percentile(std::vector<uint64>& SortedNs, double Fraction)
+        {
+            if (SortedNs.empty())
+                return 0.0;
+
+            size_t Index = static_cast<size_t>(Fraction * static_cast<double>(SortedNs.size() - 1) + 0.5);
+            return static_cast<double>(SortedNs[std::min(Index, SortedNs.size() - 1)]) / 1000.0;
+        }
+
+        void WriteJsonString(FILE* File, const char* Text)
+        {
+            fputc('"', File);
+            for (const char* c = Text; *c; ++c)
+            {
+                if (*c == '"' || *c == '\\')
+                    fputc('\\', File);
+
+                if (static_cast<unsigned char>(*c) >= 0x20)
+                    fputc(*c, File);
+            }
+            fputc('"', File);
+        }
+    }
+
+    std::vector<std::unique_ptr<FProfiler::FThreadBuffer>>& FProfiler::GetThreadBuffers()
+    {
+        // Buffers outlive their threads so exports still see their events
+        static std::vector<std::unique_ptr<FThreadBuffer>> Buffers;
+        return Buffers;
+    }
+
+    uint16 FProfiler::RegisterZone(const char* Name)
+    {
+        FScopedLock Lock(GetRegistryLock());
+
+        auto& Names = GetZoneNames();
+        std::string ZoneName = Name ? Name : "Unnamed";
+
+        // Same name from two sites (e.g. templates) shares an id
+        for (size_t i = 0; i < Names.size(); ++i)
+        {
+            if (Names[i] == ZoneName)
+                return static_cast<uint16>(i);
+        }
+
+        if (Names.size() >= MaxZones)
+        {
+            USS_WARN("Profiler zone limit reached, '%s' will share the last zone", ZoneName.c_str());
+            return static_cast<uint16>(MaxZones - 1);
+        }
+
+        Names.push_back(ZoneName);
+        return static_cast<uint16>(Names.size() - 1);
+    }
+
+    uint16 FProfiler::RegisterCounter(const char* Name)
+    {
+        FScopedLock Lock(GetRegistryLock());
+
+        auto& Names = GetCounterNames();
+        std::string CounterName = Name ? Name : "Unnamed";
+
+        for (size_t i = 0; i < Names.size(); ++i)
+        {
+            if (Names[i] == CounterName)
+                return static_cast<uint16>(i);
+        }
+
+        if (Names.size() >= MaxCounters)
+        {
+            USS_WARN("Profiler counter limit reached, '%s' won't be counted", CounterName.c_str());
+            return InvalidCounter;
+        }
+
+        Names.push_back(CounterName);
+        return static_cast<uint16>(Names.size() - 1);
+    }
+
+    void FProfiler::AddCounterSample(uint16 CounterId, uint64 Cycles)
+    {
+        if (CounterId >= MaxCounters)
+            return;
+
+        FCounterSlot& Slot = g_Counters[CounterId];
+        Slot.Calls.fetch_add(1, std::memory_order_relaxed);
+        Slot.Cycles.fetch_add(Cycles, std::memory_order_relaxed);
+    }
+
+    std::vector<FProfileCounterSummary> FProfiler::GetCounterSummaries()
+    {
+        std::vector<std::string> Names;
+        {
+            FScopedLock Lock(GetRegistryLock());
+            Names = GetCounterNames();
+        }
+
+        std::vector<FProfileCounterSummary> Summaries;
+
+        for (size_t CounterId = 0; CounterId < Names.size(); ++CounterId)
+        {
+            const FCounterSlot& Slot = g_Counters[CounterId];
+
+            FProfileCounterSummary Summary;
+            Summary.Calls = Slot.Calls.load(std::memory_order_relaxed);
+            if (Summary.Calls == 0)
+                continue;
+
+            Summary.Name = Names[CounterId];
+            Summary.Cycles = Slot.Cycles.load(std::memory_order_relaxed);
+            Summary.CyclesPerCall = static_cast<double>(Summary.Cycles) / static_cast<double>(Summary.Calls);
+            Summaries.push_back(Summary);
+        }
+
+        std::sort(Summaries.begin(), Summaries.end(),
+            [](const FProfileCounterSummary& A, const FProfileCounterSummary& B) { return A.Cycles > B.Cycles; });
+
+        return Summaries;
+    }
+
+    const char* FProfiler::GetZoneName(uint16 ZoneId)
+    {
+        FScopedLock Lock(GetRegistryLock());
+
+        auto& Names = GetZoneNames();
+        return (ZoneId < Names.size()) ? Names[ZoneId].c_str() : "Unknown";
+    }
+
+    FProfiler::FThreadBuffer& FProfiler::GetThreadBuffer()
+    {
+        thread_local FThreadBuffer* t_pBuffer = nullptr;
+
+        if (!t_pBuffer)
+        {
+            FScopedLock Lock(GetRegistryLock());
+
+            auto& Buffers = GetThreadBuffers();
+            Buffers.push_back(std::make_unique<FThreadBuffer>(static_cast<uint32>(Buffers.size())));
+            t_pBuffer = Buffers.back().get();
+        }
+
+        return *t_pBuffer;
+    }
+
+    uint16 FProfiler::BeginZone()
+    {
+        return GetThreadBuffer().Depth++;
+    }
+
+    void FProfiler::EndZone(uint16 ZoneId, uint64 StartNs, uint16 Depth)
+    {
+        uint64 EndNs = NowNs();
+        FThreadBuffer& Buffer = GetThreadBuffer();
+
+        uint64 Count = Buffer.WriteCount.load(std::memory_order_relaxed);
+        FProfileEvent& Event = Buffer.Events[Count % RingCapacity];
+        Event.StartNs = StartNs;
+        Event.EndNs = EndNs;
+        Event.ZoneId = ZoneId;
+        Event.Depth = Depth;
+        Event.ThreadIndex = Buffer.ThreadIndex;
+
+        Buffer.WriteCount.store(Count + 1, std::memory_order_release);
+        Buffer.Depth = Depth;
+    }
+
+    void FProfiler::Reset()
+    {
+        FScopedLock Lock(GetRegistryLock());
+
+        // Owners keep writing from their current count; readers only look
+        // at what was written after this point
+        for (auto& Buffer : GetThreadBuffers())
+        {
+            Buffer->ReadFloor.store(Buffer->WriteCount.load(std::memory_order_acquire), std::memory_order_relaxed);
+        }
+
+        for (FCounterSlot& Slot : g_Counters)
+        {
+            Slot.Calls.store(0, std::memory_order_relaxed);
+            Slot.Cycles.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::vector<FProfileEvent> FProfiler::CollectEvents()
+    {
+        FScopedLock Lock(GetRegistryLock());
+
+        std::vector<FProfileEvent> Events;
+
+        for (auto& Buffer : GetThreadBuffers())
+        {
+            uint64 End = Buffer->WriteCount.load(std::memory_order_acquire);
+            uint64 Begin = (End > RingCapacity) ? End - RingCapacity : 0;
+            Begin = std::max(Begin, Buffer->ReadFloor.load(std::memory_order_relaxed));
+
+            size_t First = Events.size();
+            for (uint64 i = Begin; i < End; ++i)
+            {
+                Events.push_back(Buffer->Events[i % RingCapacity]);
+            }
+
+            // Slots the owner lapped during the copy may be torn - drop them
+            uint64 After = Buffer->WriteCount.load(std::memory_order_acquire);
+            if (After > Begin + RingCapacity)
+            {
+                uint64 Overwritten = std::min<uint64>(After - RingCapacity - Begin, End - Begin);
+                Events.erase(Events.begin() + First, Events.begin() + First + static_cast<size_t>(Overwritten));
+            }
+        }
+
+        std::sort(Events.begin(), Events.end(),
+            [](const FProfileEvent& A, const FProfileEvent& B) { return A.StartNs < B.StartNs; });
+
+        return Events;
+    }
+
+    std::vector<FProfileZoneSummary> FProfiler::GetZoneSummaries()
+    {
+        std::vector<FProfileEvent> Events = CollectEvents();
+
+        std::vector<std::vector<uint64>> Durations;
+        for (const auto& Event : Events)
+        {
+            if (Event.ZoneId >= Durations.size())
+                Durations.resize(Event.ZoneId + 1);
+
+            Durations[Event.ZoneId].push_back(Event.EndNs - Event.StartNs);
+        }
+
+        std::vector<FProfileZoneSummary> Summaries;
+
+        for (size_t ZoneId = 0; ZoneId < Durations.size(); ++ZoneId)
+        {
+            std::vector<uint64>& Samples = Durations[ZoneId];
+            if (Samples.empty())
+                continue;
+
+            std::sort(Samples.begin(), Samples.end());
+
+            uint64 TotalNs = 0;
+            for (uint64 Sample : Samples)
+                TotalNs += Sample;
+
+            FProfileZoneSummary Summary;
+            Summary.Name = GetZoneName(static_cast<uint16>(ZoneId));
+            Summary.Count = static_cast<uint32>(Samples.size());
+            Summary.TotalUs = static_cast<double>(TotalNs) / 1000.0;
+            Summary.MeanUs = Summary.TotalUs / static_cast<double>(Samples.size());
+            Summary.P99Us = Percentile(Samples, 0.99);
+            Summary.MaxUs = static_cast<double>(Samples.back()) / 1000.0;
+            Summaries.push_back(Summary);
+        }
+
+        std::sort(Summaries.begin(), Summaries.end(),
+            [](const FProfileZoneSummary& A, const FProfileZoneSummary& B) { return A.TotalUs > B.TotalUs; });
+
+        return Summaries;
+    }
+
+    EResult FProfiler::ExportChromeTrace(const char* FilePath)
+    {
+        if (!FilePath)
+            return EResult::InvalidParameter;
+
+        FILE* File = fopen(FilePath, "wb");
+        if (!File)
+            return EResult::Failed;
+
+        std::vector<FProfileEvent> Events = CollectEvents();
+
+        fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", File);
+
+        bool bFirst = true;
+        for (const auto& Event : Events)
+        {
+            if (!bFirst)
+                fputc(',', File);
+            bFirst = false;
+
+            // Chrome wants microseconds; keep the sub-microsecond part
+            fputs("\n{\"name\":", File);
+            WriteJsonString(File, GetZoneName(Event.ZoneId));
+            fprintf(File, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                Event.ThreadIndex,
+                static_cast<double>(Event.StartNs) / 1000.0,
+                static_cast<double>(Event.EndNs - Event.StartNs) / 1000.0);
+        }
+
+        // Hook counters as one counter sample each at the end of the trace
+        const double EndUs = static_cast<double>(NowNs()) / 1000.0;
+        for (const auto& Counter : GetCounterSummaries())
+        {
+            if (!bFirst)
+                fputc(',', File);
+            bFirst = false;
+
+            fputs("\n{\"name\":", File);
+            WriteJsonString(File, Counter.Name.c_str());
+            fprintf(File, ",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"calls\":%llu,\"cycles\":%llu}}",
+                EndUs,
+                static_cast<unsigned long long>(Counter.Calls),
+                static_cast<unsigned long long>(Counter.Cycles));
+        }
+
+        fputs("\n]}\n", File);
+        fclose(File);
+
+        USS_LOG("Exported %zu profile events to %s", Events.size(), FilePath);
+        return EResult::Success;
+    }
+
+    EResult FProfiler::ExportBinary(const char* FilePath)
+    {
+        if (!FilePath)
+            return EResult::InvalidParameter;
+
+        FILE* File = fopen(FilePath, "wb");
+        if (!File)
+            return EResult::Failed;
+
+        std::vector<FProfileEvent> Events = CollectEvents();
+
+        std::vector<std::string> Names;
+        {
+            FScopedLock Lock(GetRegistryLock());
+            Names = GetZoneNames();
+        }
+
+        // Header: magic, version, zone count, event count
+        const uint32 Version = 1;
+        uint32 ZoneCount = static_cast<uint32>(Names.size());
+        uint64 EventCount = static_cast<uint64>(Events.size());
+
+        fwrite("USSP", 1, 4, File);
+        fwrite(&Version, sizeof(Version), 1, File);
+        fwrite(&ZoneCount, sizeof(ZoneCount), 1, File);
+        fwrite(&EventCount, sizeof(EventCount), 1, File);
+
+        // Zone table: uint16 length + bytes
+        for (const auto& Name : Names)
+        {
+            uint16 Length = static_cast<uint16>(std::min<size_t>(Name.size(), 0xFFFF));
+            fwrite(&Length, sizeof(Length), 1, File);
+            fwrite(Name.data(), 1, Length, File);
+        }
+
+        // Events, written field by field so the format doesn't depend on padding
+        for (const auto& Event : Events)
+        {
+            fwrite(&Event.StartNs, sizeof(Event.StartNs), 1, File);
+            fwrite(&Event.EndNs, sizeof(Event.EndNs), 1, File);
+            fwrite(&Event.ZoneId, sizeof(Event.ZoneId), 1, File);
+            fwrite(&Event.Depth, sizeof(Event.Depth), 1, File);
+            fwrite(&Event.ThreadIndex, sizeof(Event.ThreadIndex), 1, File);
+        }
+
+        fclose(File);
+
+        USS_LOG("Exported %zu profile events (binary) to %s", Events.size(), FilePath);
+        return EResult::Success;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,260 @@
+/**
+ * UniversalSlashingSimulator - Frame Profiler
+ *
+ * Scoped-zone instrumentation for the STW tick. Each thread records
+ * begin/end timestamps into its own fixed-size ring buffer, so the hot
+ * path is two clock reads and a store with no locking. Recorded events
+ * can be exported as Chrome trace-event JSON (chrome://tracing, Perfetto)
+ * or a compact binary file, and summarized per zone (mean / p99 / max)
+ * over whatever the rings currently hold.
+ *
+ * Zones compile to nothing unless USS_PROFILE is defined:
+ *
+ *     void FMissionManager::Update()
+ *     {
+ *         USS_PROFILE_ZONE("MissionManager::Update");
+ *         ...
+ *     }
+ *
+ * Hook counters are the per-detour counterpart: running call and TSC
+ * cycle totals per hook, cheap enough to leave on every ProcessEvent.
+ * Unlike zones they keep no timeline, so they never drop samples.
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include <atomic>
+#include <chrono>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace USS
+{
+    /**
+     * One completed zone
+     */
+    struct FProfileEvent
+    {
+        uint64 StartNs;         // Since profiler epoch
+        uint64 EndNs;
+        uint16 ZoneId;
+        uint16 Depth;           // Nesting depth on the recording thread
+        uint32 ThreadIndex;
+    };
+
+    /**
+     * Rolling timing summary for one zone
+     */
+    struct FProfileZoneSummary
+    {
+        std::string Name;
+        uint32 Count;
+        double MeanUs;
+        double P99Us;
+        double MaxUs;
+        double TotalUs;
+
+        FProfileZoneSummary()
+            : Count(0)
+            , MeanUs(0.0)
+            , P99Us(0.0)
+            , MaxUs(0.0)
+            , TotalUs(0.0)
+        {}
+    };
+
+    /**
+     * Running totals for one hook counter
+     */
+    struct FProfileCounterSummary
+    {
+        std::string Name;
+        uint64 Calls;
+        uint64 Cycles;
+        double CyclesPerCall;
+
+        FProfileCounterSummary()
+            : Calls(0)
+            , Cycles(0)
+            , CyclesPerCall(0.0)
+        {}
+    };
+
+    /**
+     * Frame Profiler - process-wide, static like Log
+     */
+    class FProfiler
+    {
+    public:
+        // Events kept per thread before the oldest are overwritten
+        static constexpr uint32 RingCapacity = 1 << 16;
+        static constexpr uint16 MaxZones = 1024;
+        static constexpr uint16 MaxCounters = 256;
+        static constexpr uint16 InvalidCounter = 0xFFFF;
+
+        /**
+         * Register a zone name (called once per zone site by the macro)
+         * @return Zone id, stable for the process lifetime
+         */
+        static uint16 RegisterZone(const char* Name);
+        static const char* GetZoneName(uint16 ZoneId);
+
+        /**
+         * Register a hook counter; a name already registered gets its id back
+         * @return Counter id, or InvalidCounter once MaxCounters are in use
+         */
+        static uint16 RegisterCounter(const char* Name);
+
+        static void AddCounterSample(uint16 CounterId, uint64 Cycles);
+
+        // Counters with at least one call, sorted by total cycles descending
+        static std::vector<FProfileCounterSummary> GetCounterSummaries();
+
+        // Recording can be paused at runtime without recompiling
+        static void SetEnabled(bool bEnabled) { s_bEnabled.store(bEnabled, std::memory_order_relaxed); }
+        static bool IsEnabled() { return s_bEnabled.load(std::memory_order_relaxed); }
+
+        // Drop everything recorded so far and zero the counters (threads keep their buffers)
+        static void Reset();
+
+        /**
+         * Per-zone statistics over the events currently in the rings,
+         * sorted by total time descending
+         */
+        static std::vector<FProfileZoneSummary> GetZoneSummaries();
+
+        /**
+         * Export recorded events
+         * Chrome format: {"traceEvents":[{"ph":"X",...}]}
+         * Binary format: "USSP" header, zone name table, packed events
+         */
+        static EResult ExportChromeTrace(const char* FilePath);
+        static EResult ExportBinary(const char* FilePath);
+
+        // Clock shared by zones and exports
+        static uint64 NowNs()
+        {
+            return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - s_Epoch).count());
+        }
+
+        // Counter clock - TSC where available, nanoseconds otherwise
+        static uint64 ReadCycles()
+        {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#else
+            return NowNs();
+#endif
+        }
+
+        // Called by FScopedProfileZone
+        static uint16 BeginZone();
+        static void EndZone(uint16 ZoneId, uint64 StartNs, uint16 Depth);
+
+    private:
+        FProfiler() = default;
+
+        struct FThreadBuffer;
+
+        static FThreadBuffer& GetThreadBuffer();
+        static std::vector<std::unique_ptr<FThreadBuffer>>& GetThreadBuffers();
+        static std::vector<FProfileEvent> CollectEvents();
+
+        static std::atomic<bool> s_bEnabled;
+        static const std::chrono::steady_clock::time_point s_Epoch;
+    };
+
+    /**
+     * RAII zone - prefer the USS_PROFILE_ZONE macro
+     */
+    class FScopedProfileZone
+    {
+    public:
+        explicit FScopedProfileZone(uint16 ZoneId)
+            : m_ZoneId(ZoneId)
+            , m_bActive(FProfiler::IsEnabled())
+            , m_Depth(0)
+            , m_StartNs(0)
+        {
+            if (m_bActive)
+            {
+                m_Depth = FProfiler::BeginZone();
+                m_StartNs = FProfiler::NowNs();
+            }
+        }
+
+        ~FScopedProfileZone()
+        {
+            if (m_bActive)
+                FProfiler::EndZone(m_ZoneId, m_StartNs, m_Depth);
+        }
+
+        FScopedProfileZone(const FScopedProfileZone&) = delete;
+        FScopedProfileZone& operator=(const FScopedProfileZone&) = delete;
+
+    private:
+        uint16 m_ZoneId;
+        bool m_bActive;
+        uint16 m_Depth;
+        uint64 m_StartNs;
+    };
+
+    /**
+     * RAII hook counter - prefer USS_PROFILE_HOOK for fixed names
+     */
+    class FScopedHookCounter
+    {
+    public:
+        explicit FScopedHookCounter(uint16 CounterId)
+            : m_CounterId(CounterId)
+            , m_StartCycles(0)
+        {
+            if (m_CounterId != FProfiler::InvalidCounter && FProfiler::IsEnabled())
+                m_StartCycles = FProfiler::ReadCycles();
+            else
+                m_CounterId = FProfiler::InvalidCounter;
+        }
+
+        ~FScopedHookCounter()
+        {
+            if (m_CounterId != FProfiler::InvalidCounter)
+                FProfiler::AddCounterSample(m_CounterId, FProfiler::ReadCycles() - m_StartCycles);
+        }
+
+        FScopedHookCounter(const FScopedHookCounter&) = delete;
+        FScopedHookCounter& operator=(const FScopedHookCounter&) = delete;
+
+    private:
+        uint16 m_CounterId;
+        uint64 m_StartCycles;
+    };
+
+}
+
+// ============================================================================
+// Zone macros
+// ============================================================================
+
+#define USS_PROFILE_CONCAT_INNER(A, B) A##B
+#define USS_PROFILE_CONCAT(A, B) USS_PROFILE_CONCAT_INNER(A, B)
+
+#ifdef USS_PROFILE
+#define USS_PROFILE_ZONE(Name) \
+    static const ::USS::uint16 USS_PROFILE_CONCAT(UssProfileZoneId_, __LINE__) = ::USS::FProfiler::RegisterZone(Name); \
+    ::USS::FScopedProfileZone USS_PROFILE_CONCAT(UssProfileZone_, __LINE__)(USS_PROFILE_CONCAT(UssProfileZoneId_, __LINE__))
+#define USS_PROFILE_HOOK(Name) \
+    static const ::USS::uint16 USS_PROFILE_CONCAT(UssHookCounterId_, __LINE__) = ::USS::FProfiler::RegisterCounter(Name); \
+    ::USS::FScopedHookCounter USS_PROFILE_CONCAT(UssHookCounter_, __LINE__)(USS_PROFILE_CONCAT(UssHookCounterId_, __LINE__))
+#else
+#define USS_PROFILE_ZONE(Name) ((void)0)
+#define USS_PROFILE_HOOK(Name) ((void)0)
+#endif
\ No newline at end of file
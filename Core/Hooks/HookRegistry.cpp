@@ -0,0 +1,359 @@
+/**
+ * UniversalSlashingSimulator - Hook Registry Implementation
+ */
+
+#include "HookRegistry.h"
+#include "../Logging/Log.h"
+
+namespace USS
+{
+    const char* GetHookStateName(EHookState State)
+    {
+        switch (State)
+        {
+        case EHookState::Registered:    return "Registered";
+        case EHookState::Enabled:       return "Enabled";
+        case EHookState::Disabled:      return "Disabled";
+        case EHookState::CreateFailed:  return "CreateFailed";
+        case EHookState::EnableFailed:  return "EnableFailed";
+        default:                        return "Unknown";
+        }
+    }
+
+    FHookRegistry::FHookRegistry(IHookBackend& Backend)
+        : m_Backend(Backend)
+        , m_BatchCount(0)
+        , m_bInitialized(false)
+    {
+    }
+
+    FHookRegistry::~FHookRegistry()
+    {
+        Shutdown();
+    }
+
+    EResult FHookRegistry::Initialize()
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        if (m_bInitialized)
+            return EResult::AlreadyInitialized;
+
+        int32 Status = m_Backend.Initialize();
+        if (Status != 0)
+        {
+            USS_ERROR("Hook backend initialization failed: %s", m_Backend.GetStatusName(Status));
+            return EResult::Failed;
+        }
+
+        m_bInitialized = true;
+        return EResult::Success;
+    }
+
+    void FHookRegistry::Shutdown()
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        if (!m_bInitialized)
+            return;
+
+        DisableAll();
+
+        for (FHookEntry& Entry : m_Entries)
+        {
+            // Everything that got past creation
+            if (Entry.State != EHookState::Registered && Entry.State != EHookState::CreateFailed)
+                m_Backend.RemoveHook(Entry.Target);
+        }
+
+        int32 Status = m_Backend.Uninitialize();
+        if (Status != 0)
+        {
+            USS_WARN("Hook backend shutdown warning: %s", m_Backend.GetStatusName(Status));
+        }
+
+        m_Entries.clear();
+        m_bInitialized = false;
+    }
+
+    EResult FHookRegistry::RegisterRaw(const char* Name, void* Target, void* Detour, void** OutOriginal)
+    {
+        if (!Name || !Target || !Detour || !OutOriginal)
+        {
+            USS_ERROR("Hook registration '%s' - invalid parameters", Name ? Name : "(null)");
+            return EResult::InvalidParameter;
+        }
+
+        FScopedLock Lock(m_CriticalSection);
+
+        for (const FHookEntry& Entry : m_Entries)
+        {
+            if (Entry.Target == Target || Entry.Name == Name)
+            {
+                USS_ERROR("Hook '%s' at %p conflicts with '%s' at %p", Name, Target, Entry.Name.c_str(), Entry.Target);
+                return EResult::InvalidParameter;
+            }
+        }
+
+        FHookEntry Entry;
+        Entry.Name = Name;
+        Entry.Target = Target;
+        Entry.Detour = Detour;
+        Entry.OutOriginal = OutOriginal;
+        m_Entries.push_back(std::move(Entry));
+
+        return EResult::Success;
+    }
+
+    EResult FHookRegistry::InstallPending()
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        if (!m_bInitialized)
+        {
+            USS_ERROR("FHookRegistry::InstallPending called before Initialize");
+            return EResult::NotInitialized;
+        }
+
+        // Phase 1: create everything - patches nothing, no thread freeze
+        std::vector<FHookEntry*> Batch;
+        int32 Pending = 0;
+
+        for (FHookEntry& Entry : m_Entries)
+        {
+            if (Entry.State != EHookState::Registered)
+                continue;
+
+            ++Pending;
+
+            int32 Status = m_Backend.CreateHook(Entry.Target, Entry.Detour, Entry.OutOriginal);
+            if (Status != 0)
+            {
+                Entry.State = EHookState::CreateFailed;
+                Entry.BackendStatus = Status;
+                continue;
+            }
+
+            Entry.State = EHookState::Disabled;
+            Batch.push_back(&Entry);
+        }
+
+        // Phase 2: one enable pass for the lot
+        ApplyBatch(Batch, true);
+
+        int32 Enabled = 0;
+        for (const FHookEntry* Entry : Batch)
+        {
+            if (Entry->State == EHookState::Enabled)
+                ++Enabled;
+        }
+
+        USS_LOG("Installed %d/%d hooks (%u batches applied)", Enabled, Pending, m_BatchCount);
+
+        if (Enabled < Pending)
+        {
+            LogReport();
+            return EResult::HookFailed;
+        }
+
+        return EResult::Success;
+    }
+
+    EResult FHookRegistry::EnableAll()
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        if (!m_bInitialized)
+            return EResult::NotInitialized;
+
+        std::vector<FHookEntry*> Batch;
+        for (FHookEntry& Entry : m_Entries)
+        {
+            if (Entry.State == EHookState::Disabled)
+                Batch.push_back(&Entry);
+        }
+
+        ApplyBatch(Batch, true);
+        return (GetCount(EHookState::EnableFailed) == 0) ? EResult::Success : EResult::HookFailed;
+    }
+
+    EResult FHookRegistry::DisableAll()
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        if (!m_bInitialized)
+            return EResult::NotInitialized;
+
+        std::vector<FHookEntry*> Batch;
+        for (FHookEntry& Entry : m_Entries)
+        {
+            if (Entry.State == EHookState::Enabled)
+                Batch.push_back(&Entry);
+        }
+
+        ApplyBatch(Batch, false);
+        return (GetCount(EHookState::Enabled) == 0) ? EResult::Success : EResult::HookFailed;
+    }
+
+    void FHookRegistry::ApplyBatch(const std::vector<FHookEntry*>& Batch, bool bEnable)
+    {
+        std::vector<FHookEntry*> Queued;
+        Queued.reserve(Batch.size());
+
+        for (FHookEntry* Entry : Batch)
+        {
+            int32 Status = bEnable ? m_Backend.QueueEnableHook(Entry->Target)
+                                   : m_Backend.QueueDisableHook(Entry->Target);
+            if (Status != 0)
+            {
+                if (bEnable)
+                    Entry->State = EHookState::EnableFailed;
+
+                Entry->BackendStatus = Status;
+                continue;
+            }
+
+            Queued.push_back(Entry);
+        }
+
+        if (Queued.empty())
+            return;
+
+        const EHookState Target = bEnable ? EHookState::Enabled : EHookState::Disabled;
+
+        ++m_BatchCount;
+        int32 Status = m_Backend.ApplyQueued();
+
+        if (Status == 0)
+        {
+            for (FHookEntry* Entry : Queued)
+                Entry->State = Target;
+            return;
+        }
+
+        // The backend stops at the first hook it can't patch, leaving the
+        // rest in either state - settle each one (costs a freeze per hook,
+        // but only on this path)
+        USS_WARN("Batched hook %s failed (%s), retrying %zu hooks individually",
+            bEnable ? "enable" : "disable", m_Backend.GetStatusName(Status), Queued.size());
+
+        for (FHookEntry* Entry : Queued)
+        {
+            int32 HookStatus = bEnable ? m_Backend.EnableHook(Entry->Target)
+                                       : m_Backend.DisableHook(Entry->Target);
+            if (HookStatus == 0)
+            {
+                Entry->State = Target;
+            }
+            else
+            {
+                if (bEnable)
+                    Entry->State = EHookState::EnableFailed;
+
+                Entry->BackendStatus = HookStatus;
+            }
+        }
+    }
+
+    std::vector<FHookEntry> FHookRegistry::GetEntries() const
+    {
+        FScopedLock Lock(m_CriticalSection);
+        return m_Entries;
+    }
+
+    EHookState FHookRegistry::GetState(const char* Name) const
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        const FHookEntry* Entry = FindEntry(Name);
+        return Entry ? Entry->State : EHookState::Registered;
+    }
+
+    int32 FHookRegistry::GetCount(EHookState State) const
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        int32 Count = 0;
+        for (const FHookEntry& Entry : m_Entries)
+        {
+            if (Entry.State == State)
+                ++Count;
+        }
+        return Count;
+    }
+
+    void FHookRegistry::LogReport() const
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        USS_LOG("Hook registry: %zu hooks, %u batches applied", m_Entries.size(), m_BatchCount);
+
+        for (const FHookEntry& Entry : m_Entries)
+        {
+            if (Entry.State == EHookState::CreateFailed || Entry.State == EHookState::EnableFailed)
+            {
+                USS_ERROR("  %-12s %-32s %p (%s)", GetHookStateName(Entry.State), Entry.Name.c_str(),
+                    Entry.Target, m_Backend.GetStatusName(Entry.BackendStatus));
+            }
+            else
+            {
+                USS_LOG("  %-12s %-32s %p", GetHookStateName(Entry.State), Entry.Name.c_str(), Entry.Target);
+            }
+        }
+    }
+
+    FHookEntry* FHookRegistry::FindEntry(const char* Name)
+    {
+        for (FHookEntry& Entry : m_Entries)
+        {
+            if (Name && Entry.Name == Name)
+                return &Entry;
+        }
+        return nullptr;
+    }
+
+    const FHookEntry* FHookRegistry::FindEntry(const char* Name) const
+    {
+        return const_cast<FHookRegistry*>(this)->FindEntry(Name);
+    }
+
+#ifndef _WIN32
+
+    namespace
+    {
+        /**
+         * MinHook is Windows-only. Tools built elsewhere get a registry
+         * whose backend refuses to initialize, so nothing is ever patched.
+         */
+        class FUnsupportedHookBackend : public IHookBackend
+        {
+        public:
+            static constexpr int32 NotSupported = -1;
+
+            int32 Initialize() override { return NotSupported; }
+            int32 Uninitialize() override { return NotSupported; }
+
+            int32 CreateHook(void*, void*, void**) override { return NotSupported; }
+            int32 RemoveHook(void*) override { return NotSupported; }
+
+            int32 EnableHook(void*) override { return NotSupported; }
+            int32 DisableHook(void*) override { return NotSupported; }
+
+            int32 QueueEnableHook(void*) override { return NotSupported; }
+            int32 QueueDisableHook(void*) override { return NotSupported; }
+            int32 ApplyQueued() override { return NotSupported; }
+
+            const char* GetStatusName(int32) const override { return "Hooking not supported on this platform"; }
+        };
+    }
+
+    FHookRegistry& GetHookRegistry()
+    {
+        static FUnsupportedHookBackend Backend;
+        static FHookRegistry Registry(Backend);
+        return Registry;
+    }
+
+#endif
+
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+/**
+ * UniversalSlashingSimulator - Hook Registry
+ *
+ * Collects detours during startup and installs them in one batch: every
+ * hook is created first, then all of them are queued and enabled with a
+ * single ApplyQueued. MinHook suspends and resumes every game thread on
+ * each enable, so N hooks cost one thread freeze instead of N.
+ *
+ * Each hook keeps its own state and backend status for reporting. If the
+ * batch fails part way, the queued hooks are settled one by one so a
+ * single bad target doesn't take the others down with it.
+ *
+ * The registry talks to the hook library through IHookBackend; the
+ * process-wide instance uses MinHook (MinHookBackend.h), and tools can
+ * drive a registry over a fake backend without the game or Windows.
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include <string>
+#include <vector>
+
+namespace USS
+{
+    /**
+     * Hook library operations the registry needs. Methods return the
+     * library's own status code, 0 meaning success.
+     */
+    USS_INTERFACE IHookBackend
+    {
+    public:
+        virtual ~IHookBackend() = default;
+
+        virtual int32 Initialize() = 0;
+        virtual int32 Uninitialize() = 0;
+
+        virtual int32 CreateHook(void* Target, void* Detour, void** OutOriginal) = 0;
+        virtual int32 RemoveHook(void* Target) = 0;
+
+        // Enabling an already enabled hook (and vice versa) succeeds
+        virtual int32 EnableHook(void* Target) = 0;
+        virtual int32 DisableHook(void* Target) = 0;
+
+        virtual int32 QueueEnableHook(void* Target) = 0;
+        virtual int32 QueueDisableHook(void* Target) = 0;
+        virtual int32 ApplyQueued() = 0;
+
+        virtual const char* GetStatusName(int32 Status) const = 0;
+    };
+
+    enum class EHookState : uint8
+    {
+        Registered,     // Waiting for InstallPending
+        Enabled,
+        Disabled,       // Created, detour not active
+        CreateFailed,
+        EnableFailed
+    };
+
+    const char* GetHookStateName(EHookState State);
+
+    struct FHookEntry
+    {
+        std::string Name;
+        void* Target = nullptr;
+        void* Detour = nullptr;
+        void** OutOriginal = nullptr;
+        EHookState State = EHookState::Registered;
+        int32 BackendStatus = 0;    // Last failing backend call, 0 if none
+    };
+
+    class FHookRegistry
+    {
+    public:
+        explicit FHookRegistry(IHookBackend& Backend);
+        ~FHookRegistry();
+
+        USS_NON_COPYABLE(FHookRegistry)
+        USS_NON_MOVABLE(FHookRegistry)
+
+        EResult Initialize();
+
+        // Disables and removes every hook, then releases the backend
+        void Shutdown();
+
+        bool IsInitialized() const { return m_bInitialized; }
+
+        /**
+         * Add a hook to the next InstallPending batch
+         * @param Name - Shown in reports, unique per registry
+         * @param OutOriginal - Receives the trampoline once created
+         */
+        template<typename T>
+        EResult Register(const char* Name, uintptr Target, T Detour, T* OutOriginal)
+        {
+            return RegisterRaw(Name, reinterpret_cast<void*>(Target), reinterpret_cast<void*>(Detour),
+                reinterpret_cast<void**>(OutOriginal));
+        }
+
+        EResult RegisterRaw(const char* Name, void* Target, void* Detour, void** OutOriginal);
+
+        /**
+         * Create every registered hook, then enable them in one batch
+         * @return Success if every pending hook ended up enabled
+         */
+        EResult InstallPending();
+
+        // Batched enable/disable of everything already created
+        EResult EnableAll();
+        EResult DisableAll();
+
+        // Snapshot for reporting
+        std::vector<FHookEntry> GetEntries() const;
+        EHookState GetState(const char* Name) const;
+        int32 GetCount(EHookState State) const;
+
+        // Batches applied so far - one thread freeze each
+        uint32 GetBatchCount() const { return m_BatchCount; }
+
+        // Per-hook state table at Info, failures at Error
+        void LogReport() const;
+
+    private:
+        FHookEntry* FindEntry(const char* Name);
+        const FHookEntry* FindEntry(const char* Name) const;
+
+        // Applies queued changes; on failure settles each hook individually
+        void ApplyBatch(const std::vector<FHookEntry*>& Batch, bool bEnable);
+
+        IHookBackend& m_Backend;
+        mutable FCriticalSection m_CriticalSection;
+        std::vector<FHookEntry> m_Entries;
+        uint32 m_BatchCount;
+        bool m_bInitialized;
+    };
+
+    /**
+     * Process-wide registry over MinHook (defined in MinHookBackend.cpp).
+     * Off Windows the backend fails Initialize, so tools that never
+     * install hooks can still link against it.
+     */
+    FHookRegistry& GetHookRegistry();
+
+}
\ No newline at end of file
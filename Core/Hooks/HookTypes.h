@@ -2,50 +2,45 @@
  * UniversalSlashingSimulator - Hook Types
  *
  * Hooking system using MinHook for function detouring.
- * Requires MinHook library to be linked.
+ * Requires MinHook library to be linked. Off Windows only the registry
+ * wrappers are available (and Initialize fails); the per-hook helpers
+ * are compiled out.
+ *
+ * Startup hooks should go through GetHookRegistry() (HookRegistry.h),
+ * which enables them all in one batch; the per-hook helpers below
+ * suspend every game thread on each call.
  */
 
 #pragma once
 
 #include "../Common.h"
 #include "../Logging/Log.h"
-#include <MinHook.h>
+#include "HookRegistry.h"
 #include <functional>
 #include <vector>
 
+#ifdef _WIN32
+#include <MinHook.h>
+#endif
+
 namespace USS
 {
     using ProcessEventFn = void(*)(void* Object, void* Function, void* Params);
 
     namespace Hook
     {
-        namespace Detail
-        {
-            inline bool g_bInitialized = false;
-            inline FCriticalSection g_CriticalSection;
-        }
-
         /**
-         * Initialize the hook library (MinHook)
+         * Initialize the hook library (MinHook, owned by the hook registry)
          * Must be called before any other Hook functions
          */
         inline EResult Initialize()
         {
-            FScopedLock Lock(Detail::g_CriticalSection);
-
-            if (Detail::g_bInitialized)
-                return EResult::AlreadyInitialized;
-
-            MH_STATUS Status = MH_Initialize();
-            if (Status != MH_OK)
+            EResult Result = GetHookRegistry().Initialize();
+            if (Result == EResult::Success)
             {
-                USS_ERROR("MinHook initialization failed: %s", MH_StatusToString(Status));
-                return EResult::Failed;
+                USS_LOG("MinHook initialized successfully");
             }
-
-            Detail::g_bInitialized = true;
-            USS_LOG("MinHook initialized successfully");
-            return EResult::Success;
+            return Result;
         }
 
         /**
@@ -54,24 +49,13 @@ namespace USS
          */
         inline void Shutdown()
         {
-            FScopedLock Lock(Detail::g_CriticalSection);
-
-            if (!Detail::g_bInitialized)
+            if (!GetHookRegistry().IsInitialized())
                 return;
 
-            MH_DisableHook(MH_ALL_HOOKS);
-
-            MH_STATUS Status = MH_Uninitialize();
-            if (Status != MH_OK)
-            {
-                USS_WARN("MinHook shutdown warning: %s", MH_StatusToString(Status));
-            }
-            else
-            {
-                USS_LOG("MinHook shutdown successfully");
-            }
-
-            Detail::g_bInitialized = false;
+            // Registry hooks are disabled in one batch; MH_Uninitialize
+            // takes care of any created through the helpers below
+            GetHookRegistry().Shutdown();
+            USS_LOG("MinHook shutdown successfully");
         }
 
         /**
@@ -79,11 +63,14 @@ namespace USS
          */
         inline bool IsInitialized()
         {
-            return Detail::g_bInitialized;
+            return GetHookRegistry().IsInitialized();
         }
 
+#ifdef _WIN32
+
         /**
          * Create and enable a hook in one call
+         * Suspends all threads - batch startup hooks through GetHookRegistry()
          * @param Target - Address of function to hook
          * @param Detour - Your detour function
          * @param OutOriginal - Receives pointer to original function (trampoline)
@@ -92,7 +79,7 @@ namespace USS
         template<typename T>
         inline EResult CreateAndEnable(uintptr Target, T Detour, T* OutOriginal)
         {
-            if (!Detail::g_bInitialized)
+            if (!IsInitialized())
             {
                 USS_ERROR("Hook::CreateAndEnable called before Initialize");
                 return EResult::NotInitialized;
@@ -133,7 +120,7 @@ namespace USS
         template<typename T>
         inline EResult Create(uintptr Target, T Detour, T* OutOriginal)
         {
-            if (!Detail::g_bInitialized)
+            if (!IsInitialized())
                 return EResult::NotInitialized;
 
             void* pTarget = reinterpret_cast<void*>(Target);
@@ -156,7 +143,7 @@ namespace USS
          */
         inline EResult Enable(uintptr Target)
         {
-            if (!Detail::g_bInitialized)
+            if (!IsInitialized())
                 return EResult::NotInitialized;
 
             void* pTarget = reinterpret_cast<void*>(Target);
@@ -176,7 +163,7 @@ namespace USS
          */
         inline EResult Disable(uintptr Target)
         {
-            if (!Detail::g_bInitialized)
+            if (!IsInitialized())
                 return EResult::NotInitialized;
 
             void* pTarget = reinterpret_cast<void*>(Target);
@@ -196,7 +183,7 @@ namespace USS
          */
         inline EResult Remove(uintptr Target)
         {
-            if (!Detail::g_bInitialized)
+            if (!IsInitialized())
                 return EResult::NotInitialized;
 
             void* pTarget = reinterpret_cast<void*>(Target);
@@ -219,7 +206,7 @@ namespace USS
          */
         inline EResult EnableAll()
         {
-            if (!Detail::g_bInitialized)
+            if (!IsInitialized())
                 return EResult::NotInitialized;
 
             MH_STATUS Status = MH_EnableHook(MH_ALL_HOOKS);
@@ -231,7 +218,7 @@ namespace USS
          */
         inline EResult DisableAll()
         {
-            if (!Detail::g_bInitialized)
+            if (!IsInitialized())
                 return EResult::NotInitialized;
 
             MH_STATUS Status = MH_DisableHook(MH_ALL_HOOKS);
@@ -243,7 +230,7 @@ namespace USS
          */
         inline EResult QueueEnable(uintptr Target)
         {
-            if (!Detail::g_bInitialized)
+            if (!IsInitialized())
                 return EResult::NotInitialized;
 
             void* pTarget = reinterpret_cast<void*>(Target);
@@ -256,7 +243,7 @@ namespace USS
          */
         inline EResult QueueDisable(uintptr Target)
         {
-            if (!Detail::g_bInitialized)
+            if (!IsInitialized())
                 return EResult::NotInitialized;
 
             void* pTarget = reinterpret_cast<void*>(Target);
@@ -269,12 +256,14 @@ namespace USS
          */
         inline EResult ApplyQueued()
         {
-            if (!Detail::g_bInitialized)
+            if (!IsInitialized())
                 return EResult::NotInitialized;
 
             MH_STATUS Status = MH_ApplyQueued();
             return (Status == MH_OK) ? EResult::Success : EResult::HookFailed;
         }
+
+#endif
     }
 
     // ========================================================================
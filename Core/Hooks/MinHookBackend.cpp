@@ -0,0 +1,73 @@
+/**
+ * UniversalSlashingSimulator - MinHook Backend Implementation
+ */
+
+#ifdef _WIN32
+
+#include "MinHookBackend.h"
+#include <MinHook.h>
+
+namespace USS
+{
+    int32 FMinHookBackend::Initialize()
+    {
+        return MH_Initialize();
+    }
+
+    int32 FMinHookBackend::Uninitialize()
+    {
+        return MH_Uninitialize();
+    }
+
+    int32 FMinHookBackend::CreateHook(void* Target, void* Detour, void** OutOriginal)
+    {
+        return MH_CreateHook(Target, Detour, OutOriginal);
+    }
+
+    int32 FMinHookBackend::RemoveHook(void* Target)
+    {
+        return MH_RemoveHook(Target);
+    }
+
+    int32 FMinHookBackend::EnableHook(void* Target)
+    {
+        MH_STATUS Status = MH_EnableHook(Target);
+        return (Status == MH_ERROR_ENABLED) ? MH_OK : Status;
+    }
+
+    int32 FMinHookBackend::DisableHook(void* Target)
+    {
+        MH_STATUS Status = MH_DisableHook(Target);
+        return (Status == MH_ERROR_DISABLED) ? MH_OK : Status;
+    }
+
+    int32 FMinHookBackend::QueueEnableHook(void* Target)
+    {
+        return MH_QueueEnableHook(Target);
+    }
+
+    int32 FMinHookBackend::QueueDisableHook(void* Target)
+    {
+        return MH_QueueDisableHook(Target);
+    }
+
+    int32 FMinHookBackend::ApplyQueued()
+    {
+        return MH_ApplyQueued();
+    }
+
+    const char* FMinHookBackend::GetStatusName(int32 Status) const
+    {
+        return MH_StatusToString(static_cast<MH_STATUS>(Status));
+    }
+
+    FHookRegistry& GetHookRegistry()
+    {
+        static FMinHookBackend Backend;
+        static FHookRegistry Registry(Backend);
+        return Registry;
+    }
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,38 @@
+/**
+ * UniversalSlashingSimulator - MinHook Backend
+ *
+ * IHookBackend over MinHook. Status codes are MH_STATUS values.
+ */
+
+#pragma once
+
+#include "HookRegistry.h"
+
+namespace USS
+{
+    class FMinHookBackend : public IHookBackend
+    {
+    public:
+        FMinHookBackend() = default;
+        ~FMinHookBackend() override = default;
+
+        USS_NON_COPYABLE(FMinHookBackend)
+        USS_NON_MOVABLE(FMinHookBackend)
+
+        int32 Initialize() override;
+        int32 Uninitialize() override;
+
+        int32 CreateHook(void* Target, void* Detour, void** OutOriginal) override;
+        int32 RemoveHook(void* Target) override;
+
+        int32 EnableHook(void* Target) override;
+        int32 DisableHook(void* Target) override;
+
+        int32 QueueEnableHook(void* Target) override;
+        int32 QueueDisableHook(void* Target) override;
+        int32 ApplyQueued() override;
+
+        const char* GetStatusName(int32 Status) const override;
+    };
+
+}
\ No newline at end of file
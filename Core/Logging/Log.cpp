@@ -3,19 +3,101 @@
  */
 
 #include "Log.h"
+#include <algorithm>
+#include <chrono>
 #include <cstdio>
 #include <ctime>
 
 namespace USS
 {
+    /**
+     * One queued message. Sequence follows the bounded MPMC scheme:
+     * == position when free for that producer, == position + 1 once
+     * published, and is bumped by a lap when the writer releases it.
+     */
+    struct Log::FLogRecord
+    {
+        std::atomic<uint64> Sequence;
+        const FLogSite* Site;   // Set: Message holds an encoded payload
+        int64 TimeUs;           // system_clock, captured by the producer
+        uint32 ThreadId;
+        uint16 Length;
+        ELogLevel Level;
+        char Message[MaxMessageLength];
+    };
+
+    namespace
+    {
+        // Idle writer wakes this often; errors and a filling ring wake it early
+        constexpr int32 WriterIntervalMs = 10;
+
+        // How often throttled sites report what they suppressed
+        constexpr int64 SuppressedReportIntervalUs = 5 * 1000000;
+
+        int64 NowUs()
+        {
+            return std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+        }
+
+        template<typename T>
+        void WriteRaw(std::ofstream& Stream, const T& Value)
+        {
+            Stream.write(reinterpret_cast<const char*>(&Value), sizeof(Value));
+        }
+
+        void WriteVar(std::ofstream& Stream, uint64 Value)
+        {
+            uint8 Bytes[MaxVarIntBytes];
+            Stream.write(reinterpret_cast<const char*>(Bytes), EncodeVarInt(Value, Bytes));
+        }
+
+        void WriteVarString(std::ofstream& Stream, const char* Text, size_t Length)
+        {
+            WriteVar(Stream, Length);
+            Stream.write(Text, Length);
+        }
+
+        // __FILE__ may be a full path
+        const char* GetFileName(const char* Path)
+        {
+            const char* Name = Path ? Path : "";
+            for (const char* c = Name; *c; ++c)
+            {
+                if (*c == '/' || *c == '\\')
+                    Name = c + 1;
+            }
+            return Name;
+        }
+    }
+
     FCriticalSection Log::s_CriticalSection;
     std::ofstream Log::s_FileStream;
-    ELogLevel Log::s_MinLevel = ELogLevel::Info;
+    std::atomic<ELogLevel> Log::s_MinLevel(ELogLevel::Info);
     bool Log::s_bConsoleEnabled = false;
     bool Log::s_bFileEnabled = false;
-    bool Log::s_bInitialized = false;
+    ELogFileFormat Log::s_FileFormat = ELogFileFormat::Text;
+    std::vector<bool> Log::s_SitesWritten;
+    int64 Log::s_LastFileTimeUs = 0;
+    std::atomic<bool> Log::s_bInitialized(false);
+
+    std::atomic<int64> Log::s_CoarseNowUs(0);
+    std::atomic<int64> Log::s_DefaultIntervalUs(1000000 / Log::DefaultSiteRateLimit);
+    std::atomic<int64> Log::s_DefaultBurstUs(1000000 / Log::DefaultSiteRateLimit * (Log::DefaultSiteRateLimit - 1));
+    std::atomic<const FLogSite*> Log::s_ThrottledSites(nullptr);
+
+    Log::FLogRecord Log::s_Records[Log::QueueCapacity];
+    std::atomic<uint64> Log::s_EnqueuePos(0);
+    uint64 Log::s_DequeuePos = 0;
+    std::atomic<uint64> Log::s_DroppedCount(0);
+    uint64 Log::s_ReportedDropped = 0;
 
-    EResult Log::Initialize(bool bEnableConsole, const char* LogFilePath)
+    std::thread Log::s_WriterThread;
+    std::mutex Log::s_WakeMutex;
+    std::condition_variable Log::s_WakeCondition;
+    std::atomic<bool> Log::s_bStopping(false);
+
+    EResult Log::Initialize(bool bEnableConsole, const char* LogFilePath, ELogFileFormat FileFormat)
     {
         FScopedLock Lock(s_CriticalSection);
 
@@ -24,6 +106,7 @@ namespace USS
 
         if (bEnableConsole)
         {
+#ifdef _WIN32
             if (AllocConsole())
             {
                 FILE* pFile = nullptr;
@@ -31,41 +114,98 @@ namespace USS
                 freopen_s(&pFile, "CONOUT$", "w", stderr);
                 s_bConsoleEnabled = true;
             }
+#else
+            // Tools already run with a terminal on stdout
+            s_bConsoleEnabled = true;
+#endif
         }
 
         if (LogFilePath != nullptr)
         {
-            s_FileStream.open(LogFilePath, std::ios::out | std::ios::trunc);
+            std::ios::openmode Mode = std::ios::out | std::ios::trunc;
+            if (FileFormat == ELogFileFormat::Binary)
+                Mode |= std::ios::binary;
+
+            s_FileStream.open(LogFilePath, Mode);
             if (s_FileStream.is_open())
             {
                 s_bFileEnabled = true;
+                s_FileFormat = FileFormat;
+                s_SitesWritten.clear();
+
+                if (FileFormat == ELogFileFormat::Binary)
+                {
+                    s_LastFileTimeUs = NowUs();
+
+                    s_FileStream.write(LogFileMagic, sizeof(LogFileMagic));
+                    WriteRaw(s_FileStream, LogFileVersion);
+                    WriteRaw(s_FileStream, s_LastFileTimeUs);
+                }
             }
         }
 
+        for (uint32 i = 0; i < QueueCapacity; ++i)
+        {
+            s_Records[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+
+        s_EnqueuePos.store(0, std::memory_order_relaxed);
+        s_DequeuePos = 0;
+        s_DroppedCount.store(0, std::memory_order_relaxed);
+        s_ReportedDropped = 0;
+
+        s_CoarseNowUs.store(NowUs(), std::memory_order_relaxed);
+
+        s_bStopping = false;
         s_bInitialized = true;
+
+        s_WriterThread = std::thread(&Log::WriterMain);
+
         return EResult::Success;
     }
 
     void Log::Shutdown()
     {
+        {
+            FScopedLock Lock(s_CriticalSection);
+
+            if (!s_bInitialized)
+                return;
+
+            ReportSuppressed();
+
+            s_bInitialized = false;
+        }
+
+        {
+            std::lock_guard<std::mutex> Wake(s_WakeMutex);
+            s_bStopping = true;
+        }
+
+        s_WakeCondition.notify_one();
+
+        if (s_WriterThread.joinable())
+            s_WriterThread.join();
+
         FScopedLock Lock(s_CriticalSection);
 
-        if (!s_bInitialized)
-            return;
+        // Whatever was queued before the flag flipped
+        Drain();
 
         if (s_bFileEnabled && s_FileStream.is_open())
         {
             s_FileStream.close();
         }
 
+#ifdef _WIN32
         if (s_bConsoleEnabled)
         {
             FreeConsole();
         }
+#endif
 
         s_bConsoleEnabled = false;
         s_bFileEnabled = false;
-        s_bInitialized = false;
     }
 
     void Log::Write(ELogLevel Level, const char* Format, ...)
@@ -78,20 +218,102 @@ namespace USS
 
     void Log::WriteV(ELogLevel Level, const char* Format, va_list Args)
     {
-        if (Level < s_MinLevel)
+        if (Level < s_MinLevel.load(std::memory_order_relaxed))
             return;
 
-        char Buffer[4096];
-        vsnprintf(Buffer, sizeof(Buffer), Format, Args);
-        Buffer[sizeof(Buffer) - 1] = '\0';
+        if (!s_bInitialized.load(std::memory_order_acquire))
+            return;
 
-        WriteInternal(Level, Buffer);
+        if (Level == ELogLevel::Fatal)
+        {
+            // We may be about to die - make room if needed and write it out now
+            va_list Retry;
+            va_copy(Retry, Args);
+
+            if (!Enqueue(Level, Format, Args))
+            {
+                Flush();
+                Enqueue(Level, Format, Retry);
+            }
+
+            va_end(Retry);
+            Flush();
+            return;
+        }
+
+        Enqueue(Level, Format, Args);
     }
 
-    void Log::SetMinLevel(ELogLevel Level)
+    void Log::WriteEncoded(const FLogSite& Site, const uint8* Payload, uint32 Size)
+    {
+        if (Site.Level == ELogLevel::Fatal)
+        {
+            if (!EnqueueEncoded(Site, Payload, Size))
+            {
+                Flush();
+                EnqueueEncoded(Site, Payload, Size);
+            }
+
+            Flush();
+            return;
+        }
+
+        EnqueueEncoded(Site, Payload, Size);
+    }
+
+    void Log::Flush()
     {
         FScopedLock Lock(s_CriticalSection);
-        s_MinLevel = Level;
+
+        if (Drain() > 0 && s_bFileEnabled && s_FileStream.is_open())
+        {
+            s_FileStream.flush();
+        }
+    }
+
+    void Log::SetMinLevel(ELogLevel Level)
+    {
+        s_MinLevel.store(Level, std::memory_order_relaxed);
+    }
+
+    void Log::SetSiteRateLimit(uint32 PerSecond)
+    {
+        const int64 IntervalUs = PerSecond ? 1000000 / PerSecond : 0;
+
+        s_DefaultBurstUs.store(PerSecond ? IntervalUs * (PerSecond - 1) : 0, std::memory_order_relaxed);
+        s_DefaultIntervalUs.store(IntervalUs, std::memory_order_relaxed);
+    }
+
+    void Log::SuppressSite(const FLogSite& Site)
+    {
+        FLogSiteLimiter& Limiter = Site.Limiter;
+        Limiter.Suppressed.fetch_add(1, std::memory_order_relaxed);
+
+        // First suppression - link the site in for ReportSuppressed
+        if (Limiter.bListed.load(std::memory_order_relaxed) || Limiter.bListed.exchange(true))
+            return;
+
+        const FLogSite* Head = s_ThrottledSites.load(std::memory_order_relaxed);
+        do
+        {
+            Limiter.NextListed = Head;
+        } while (!s_ThrottledSites.compare_exchange_weak(Head, &Site,
+                    std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    void Log::ReportSuppressed()
+    {
+        const FLogSite* Site = s_ThrottledSites.load(std::memory_order_acquire);
+
+        for (; Site; Site = Site->Limiter.NextListed)
+        {
+            uint32 Count = Site->Limiter.Suppressed.exchange(0, std::memory_order_relaxed);
+            if (Count == 0)
+                continue;
+
+            Write(Site->Level, "Suppressed %u messages from %s:%u \"%s\"",
+                Count, GetFileName(Site->File), Site->Line, Site->Format);
+        }
     }
 
     const char* Log::GetLevelName(ELogLevel Level)
@@ -108,31 +330,218 @@ namespace USS
         }
     }
 
-    void Log::WriteInternal(ELogLevel Level, const char* Message)
+    Log::FLogRecord* Log::Claim(uint64& OutPos)
     {
-        FScopedLock Lock(s_CriticalSection);
+        uint64 Pos = s_EnqueuePos.load(std::memory_order_relaxed);
 
-        if (!s_bInitialized)
-            return;
+        for (;;)
+        {
+            FLogRecord* Record = &s_Records[Pos & (QueueCapacity - 1)];
+            uint64 Sequence = Record->Sequence.load(std::memory_order_acquire);
+            int64 Diff = static_cast<int64>(Sequence) - static_cast<int64>(Pos);
 
-        time_t Now = time(nullptr);
-        struct tm TimeInfo;
-        localtime_s(&TimeInfo, &Now);
+            if (Diff == 0)
+            {
+                if (s_EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+                {
+                    OutPos = Pos;
+                    return Record;
+                }
+            }
+            else if (Diff < 0)
+            {
+                // Writer is a full lap behind
+                s_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            else
+            {
+                Pos = s_EnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void Log::Publish(FLogRecord* Record, uint64 Pos, ELogLevel Level)
+    {
+        Record->Level = Level;
+        Record->ThreadId = Platform::GetCurrentThreadId();
+        Record->TimeUs = NowUs();
+
+        Record->Sequence.store(Pos + 1, std::memory_order_release);
+
+        // Errors, or the ring a quarter full - don't wait out the idle interval
+        if (Level >= ELogLevel::Error || (Pos & (QueueCapacity / 4 - 1)) == QueueCapacity / 4 - 1)
+        {
+            s_WakeCondition.notify_one();
+        }
+    }
+
+    bool Log::Enqueue(ELogLevel Level, const char* Format, va_list Args)
+    {
+        uint64 Pos = 0;
+        FLogRecord* Record = Claim(Pos);
+        if (!Record)
+            return false;
+
+        int Length = vsnprintf(Record->Message, sizeof(Record->Message), Format, Args);
+        if (Length < 0)
+            Length = 0;
+
+        Record->Site = nullptr;
+        Record->Length = static_cast<uint16>(std::min<int>(Length, static_cast<int>(sizeof(Record->Message) - 1)));
+
+        Publish(Record, Pos, Level);
+        return true;
+    }
+
+    bool Log::EnqueueEncoded(const FLogSite& Site, const uint8* Payload, uint32 Size)
+    {
+        uint64 Pos = 0;
+        FLogRecord* Record = Claim(Pos);
+        if (!Record)
+            return false;
+
+        Size = std::min<uint32>(Size, sizeof(Record->Message));
+        memcpy(Record->Message, Payload, Size);
+
+        Record->Site = &Site;
+        Record->Length = static_cast<uint16>(Size);
 
-        char Timestamp[32];
-        strftime(Timestamp, sizeof(Timestamp), "%H:%M:%S", &TimeInfo);
+        Publish(Record, Pos, Site.Level);
+        return true;
+    }
+
+    int32 Log::Drain()
+    {
+        int32 Count = 0;
+
+        for (;;)
+        {
+            FLogRecord& Record = s_Records[s_DequeuePos & (QueueCapacity - 1)];
+
+            if (Record.Sequence.load(std::memory_order_acquire) != s_DequeuePos + 1)
+                break;
+
+            WriteInternal(Record);
+
+            Record.Sequence.store(s_DequeuePos + QueueCapacity, std::memory_order_release);
+            ++s_DequeuePos;
+            ++Count;
+        }
+
+        uint64 Dropped = s_DroppedCount.load(std::memory_order_relaxed);
+        if (Dropped != s_ReportedDropped)
+        {
+            FLogRecord Notice;
+            Notice.Site = nullptr;
+            Notice.Level = ELogLevel::Warning;
+            Notice.ThreadId = Platform::GetCurrentThreadId();
+            Notice.TimeUs = NowUs();
+            Notice.Length = static_cast<uint16>(snprintf(Notice.Message, sizeof(Notice.Message),
+                "Log queue full, dropped %llu messages",
+                static_cast<unsigned long long>(Dropped - s_ReportedDropped)));
+
+            WriteInternal(Notice);
+            s_ReportedDropped = Dropped;
+            ++Count;
+        }
+
+        return Count;
+    }
+
+    void Log::WriterMain()
+    {
+        int64 LastReportUs = NowUs();
+
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> Wake(s_WakeMutex);
+                s_WakeCondition.wait_for(Wake, std::chrono::milliseconds(WriterIntervalMs),
+                    [] { return s_bStopping.load(); });
+            }
+
+            if (s_bStopping)
+                break;
 
-        // Format: [HH:MM:SS] [LEVEL] Message
-        char FormattedMessage[4200];
-        snprintf(FormattedMessage, sizeof(FormattedMessage),
-            "[%s] [%s] %s\n", Timestamp, GetLevelName(Level), Message);
+            // Rate limiting only needs writer-interval resolution
+            const int64 WakeUs = NowUs();
+            s_CoarseNowUs.store(WakeUs, std::memory_order_relaxed);
 
+            if (WakeUs - LastReportUs >= SuppressedReportIntervalUs)
+            {
+                ReportSuppressed();
+                LastReportUs = WakeUs;
+            }
+
+            // One file flush per batch instead of per line
+            Flush();
+        }
+    }
+
+    uint32 Log::DumpRecent(FLineSink Sink, void* Context)
+    {
+        if (!Sink)
+            return 0;
+
+        const uint64 End = s_EnqueuePos.load(std::memory_order_acquire);
+        const uint64 Begin = (End > QueueCapacity) ? End - QueueCapacity : 0;
+
+        uint32 Count = 0;
+        char Line[MaxMessageLength + 64];
+
+        for (uint64 Pos = Begin; Pos < End; ++Pos)
+        {
+            const FLogRecord& Record = s_Records[Pos & (QueueCapacity - 1)];
+
+            // Published (Pos + 1) or already written out (Pos + capacity)
+            uint64 Sequence = Record.Sequence.load(std::memory_order_acquire);
+            if (Sequence != Pos + 1 && Sequence != Pos + QueueCapacity)
+                continue;
+
+            uint32 Length = RenderLine(Record, Line, sizeof(Line));
+
+            // A producer may have claimed the slot for its next lap meanwhile
+            if (s_EnqueuePos.load(std::memory_order_acquire) > Pos + QueueCapacity)
+                continue;
+
+            Sink(Line, Length, Context);
+            ++Count;
+        }
+
+        return Count;
+    }
+
+    uint32 Log::RenderLine(const FLogRecord& Record, char* Out, uint32 OutSize)
+    {
+        const char* Message = Record.Message;
+        uint32 MessageLength = std::min<uint32>(Record.Length, sizeof(Record.Message));
+
+        // Deferred formatting for call-site records
+        char Rendered[MaxMessageLength];
+        if (Record.Site)
+        {
+            MessageLength = RenderLogMessage(Record.Site->Format,
+                reinterpret_cast<const uint8*>(Record.Message), MessageLength, Rendered, sizeof(Rendered));
+            Message = Rendered;
+        }
+
+        // Format: [HH:MM:SS.mmm] [LEVEL] Message
+        return FormatLogLine(Record.Level, Record.TimeUs, Message, MessageLength, Out, OutSize);
+    }
+
+    void Log::WriteInternal(const FLogRecord& Record)
+    {
+        char FormattedMessage[MaxMessageLength + 64];
+        RenderLine(Record, FormattedMessage, sizeof(FormattedMessage));
+
+#ifdef _WIN32
         if (s_bConsoleEnabled)
         {
             HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
             WORD Color = FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE;
 
-            switch (Level)
+            switch (Record.Level)
             {
             case ELogLevel::Trace:
             case ELogLevel::Debug:
@@ -154,14 +563,67 @@ namespace USS
             printf("%s", FormattedMessage);
             SetConsoleTextAttribute(hConsole, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE);
         }
+#else
+        if (s_bConsoleEnabled)
+        {
+            printf("%s", FormattedMessage);
+        }
+#endif
 
         if (s_bFileEnabled && s_FileStream.is_open())
         {
-            s_FileStream << FormattedMessage;
-            s_FileStream.flush();
+            if (s_FileFormat == ELogFileFormat::Binary)
+                WriteBinaryRecord(Record);
+            else
+                s_FileStream << FormattedMessage;
         }
 
+#ifdef _WIN32
         OutputDebugStringA(FormattedMessage);
+#endif
+    }
+
+    void Log::WriteBinaryRecord(const FLogRecord& Record)
+    {
+        const int64 TimeDelta = Record.TimeUs - s_LastFileTimeUs;
+        s_LastFileTimeUs = Record.TimeUs;
+
+        if (!Record.Site)
+        {
+            WriteRaw(s_FileStream, ELogRecordType::Text);
+            WriteRaw(s_FileStream, Record.Level);
+            WriteVar(s_FileStream, ZigZagEncode(TimeDelta));
+            WriteVar(s_FileStream, Record.ThreadId);
+            WriteVarString(s_FileStream, Record.Message, Record.Length);
+            return;
+        }
+
+        const FLogSite& Site = *Record.Site;
+
+        // Describe each site once, before its first call
+        if (Site.Id >= s_SitesWritten.size())
+            s_SitesWritten.resize(Site.Id + 1, false);
+
+        if (!s_SitesWritten[Site.Id])
+        {
+            const char* File = Site.File ? Site.File : "";
+            const char* Format = Site.Format ? Site.Format : "";
+
+            WriteRaw(s_FileStream, ELogRecordType::Site);
+            WriteVar(s_FileStream, Site.Id);
+            WriteRaw(s_FileStream, Site.Level);
+            WriteVar(s_FileStream, Site.Line);
+            WriteVarString(s_FileStream, Format, strlen(Format));
+            WriteVarString(s_FileStream, File, strlen(File));
+
+            s_SitesWritten[Site.Id] = true;
+        }
+
+        WriteRaw(s_FileStream, ELogRecordType::Call);
+        WriteVar(s_FileStream, Site.Id);
+        WriteVar(s_FileStream, ZigZagEncode(TimeDelta));
+        WriteVar(s_FileStream, Record.ThreadId);
+        WriteVarString(s_FileStream, Record.Message, Record.Length);
     }
 
 }
\ No newline at end of file
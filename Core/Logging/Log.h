@@ -3,13 +3,40 @@
  *
  * Provides thread-safe logging with multiple output targets.
  * Supports console, file, and debug output logging.
+ *
+ * Logging is asynchronous: Write() formats into a slot of a bounded
+ * lock-free MPSC ring and returns, and a background writer thread does
+ * timestamp formatting, console/file/debugger output and one file flush
+ * per batch. If the ring is full the message is dropped and counted
+ * rather than blocking the caller. Fatal messages (and Flush()) drain the
+ * ring on the calling thread so nothing is lost on the way down.
+ *
+ * The USS_LOG family goes through WriteSite(): the format string lives in
+ * a per-call-site FLogSite and only the raw arguments are queued, so
+ * formatting happens on the writer thread. With ELogFileFormat::Binary
+ * the file receives those records unformatted (see LogFormat.h) and
+ * Tools/LogDecoder renders them later.
+ *
+ * Each call site is also rate limited by a token bucket (SetSiteRateLimit,
+ * or USS_LOG_RATE for a per-site rate), checked before any argument is
+ * packed. The writer thread periodically logs how many messages each
+ * throttled site suppressed. Fatal sites and Write() are never limited.
+ * Levels below USS_LOG_COMPILE_LEVEL don't reach here at all - see
+ * Common.h.
  */
 
 #pragma once
 
 #include "../Common.h"
+#include "LogFormat.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <fstream>
 #include <cstdarg>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace USS
 {
@@ -23,13 +50,27 @@ namespace USS
         Fatal
     };
 
+    enum class ELogFileFormat : uint8
+    {
+        Text,       // Rendered lines
+        Binary      // Site/call records, decoded offline
+    };
+
     class Log
     {
     public:
         USS_NON_COPYABLE(Log)
         USS_NON_MOVABLE(Log)
 
-        static EResult Initialize(bool bEnableConsole = true, const char* LogFilePath = nullptr);
+        // Ring geometry - messages longer than a slot are truncated
+        static constexpr uint32 QueueCapacity = 4096;   // Power of two
+        static constexpr uint32 MaxMessageLength = 1000;
+
+        // Per-site messages per second (with a second's worth of burst)
+        static constexpr uint32 DefaultSiteRateLimit = 100;
+
+        static EResult Initialize(bool bEnableConsole = true, const char* LogFilePath = nullptr,
+                                  ELogFileFormat FileFormat = ELogFileFormat::Text);
 
         static void Shutdown();
 
@@ -37,22 +78,140 @@ namespace USS
 
         static void WriteV(ELogLevel Level, const char* Format, va_list Args);
 
+        /**
+         * Deferred-format write for a registered call site (see USS_LOG)
+         * Arguments are packed raw; the writer thread renders them
+         */
+        template<typename... ArgTypes>
+        static void WriteSite(const FLogSite& Site, const ArgTypes&... Args)
+        {
+            if (Site.Level < s_MinLevel.load(std::memory_order_relaxed))
+                return;
+
+            if (!s_bInitialized.load(std::memory_order_acquire))
+                return;
+
+            // Throttled sites stop here, before any argument is packed
+            if (!AdmitSite(Site))
+                return;
+
+            uint8 Payload[MaxMessageLength];
+            uint32 Size = EncodeLogArgs(Payload, sizeof(Payload), Args...);
+            WriteEncoded(Site, Payload, Size);
+        }
+
+        // Write out everything queued so far on the calling thread
+        static void Flush();
+
         static void SetMinLevel(ELogLevel Level);
 
+        /**
+         * Rate limit for call sites without their own (USS_LOG_RATE)
+         * @param PerSecond - 0 disables limiting for those sites
+         */
+        static void SetSiteRateLimit(uint32 PerSecond);
+
         static const char* GetLevelName(ELogLevel Level);
 
+        // Messages lost to a full ring since Initialize()
+        static uint64 GetDroppedCount() { return s_DroppedCount.load(std::memory_order_relaxed); }
+
+        /**
+         * Render the last QueueCapacity records still in the ring - written
+         * out already or not - oldest first. Takes no locks and allocates
+         * nothing, for use from a crash handler.
+         * @return Records passed to Sink
+         */
+        using FLineSink = void(*)(const char* Line, uint32 Length, void* Context);
+        static uint32 DumpRecent(FLineSink Sink, void* Context);
+
     private:
         Log() = default;
         ~Log() = default;
 
-        static void WriteInternal(ELogLevel Level, const char* Message);
+        struct FLogRecord;
+
+        /**
+         * Token-bucket check for a call site
+         * @return false if the message should be suppressed
+         */
+        static bool AdmitSite(const FLogSite& Site)
+        {
+            if (Site.Level == ELogLevel::Fatal)
+                return true;
+
+            FLogSiteLimiter& Limiter = Site.Limiter;
+            int64 IntervalUs = Limiter.IntervalUs;
+            int64 BurstUs = Limiter.BurstUs;
+
+            if (IntervalUs == 0)
+            {
+                IntervalUs = s_DefaultIntervalUs.load(std::memory_order_relaxed);
+                BurstUs = s_DefaultBurstUs.load(std::memory_order_relaxed);
+
+                if (IntervalUs == 0)
+                    return true;
+            }
+
+            const int64 NowUs = s_CoarseNowUs.load(std::memory_order_relaxed);
+            int64 ArrivalUs = Limiter.ArrivalUs.load(std::memory_order_relaxed);
+
+            do
+            {
+                if (ArrivalUs - NowUs > BurstUs)
+                {
+                    SuppressSite(Site);
+                    return false;
+                }
+            } while (!Limiter.ArrivalUs.compare_exchange_weak(ArrivalUs,
+                        std::max(ArrivalUs, NowUs) + IntervalUs, std::memory_order_relaxed));
 
-        static FCriticalSection s_CriticalSection;
+            return true;
+        }
+
+        static void SuppressSite(const FLogSite& Site);
+        static void ReportSuppressed();
+
+        static FLogRecord* Claim(uint64& OutPos);
+        static void Publish(FLogRecord* Record, uint64 Pos, ELogLevel Level);
+        static bool Enqueue(ELogLevel Level, const char* Format, va_list Args);
+        static bool EnqueueEncoded(const FLogSite& Site, const uint8* Payload, uint32 Size);
+        static void WriteEncoded(const FLogSite& Site, const uint8* Payload, uint32 Size);
+        static int32 Drain();   // Caller holds s_CriticalSection
+        static void WriterMain();
+
+        static uint32 RenderLine(const FLogRecord& Record, char* Out, uint32 OutSize);
+        static void WriteInternal(const FLogRecord& Record);
+        static void WriteBinaryRecord(const FLogRecord& Record);
+
+        static FCriticalSection s_CriticalSection;  // Consumer side + outputs
         static std::ofstream s_FileStream;
-        static ELogLevel s_MinLevel;
+        static std::atomic<ELogLevel> s_MinLevel;
         static bool s_bConsoleEnabled;
         static bool s_bFileEnabled;
-        static bool s_bInitialized;
+        static ELogFileFormat s_FileFormat;
+        static std::vector<bool> s_SitesWritten;    // Binary mode, by site id
+        static int64 s_LastFileTimeUs;              // Binary mode delta base
+        static std::atomic<bool> s_bInitialized;
+
+        // Call-site rate limiting
+        static std::atomic<int64> s_CoarseNowUs;            // Advanced by the writer thread
+        static std::atomic<int64> s_DefaultIntervalUs;
+        static std::atomic<int64> s_DefaultBurstUs;
+        static std::atomic<const FLogSite*> s_ThrottledSites;   // Intrusive list via Limiter.NextListed
+
+        // MPSC ring
+        static FLogRecord s_Records[QueueCapacity];
+        static std::atomic<uint64> s_EnqueuePos;
+        static uint64 s_DequeuePos;
+        static std::atomic<uint64> s_DroppedCount;
+        static uint64 s_ReportedDropped;
+
+        // Writer thread
+        static std::thread s_WriterThread;
+        static std::mutex s_WakeMutex;
+        static std::condition_variable s_WakeCondition;
+        static std::atomic<bool> s_bStopping;
     };
 
 }
\ No newline at end of file
@@ -0,0 +1,349 @@
+/**
+ * UniversalSlashingSimulator - Structured Log Format Implementation
+ */
+
+#include "LogFormat.h"
+#include "Log.h"
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+
+namespace USS
+{
+    std::atomic<uint32> FLogSite::s_NextId(0);
+
+    bool DecodeVarInt(const uint8* Data, uint32 Size, uint32& Offset, uint64& OutValue)
+    {
+        uint64 Value = 0;
+
+        for (uint32 Shift = 0; Shift < 64 && Offset < Size; Shift += 7)
+        {
+            uint8 Byte = Data[Offset++];
+            Value |= static_cast<uint64>(Byte & 0x7F) << Shift;
+
+            if (!(Byte & 0x80))
+            {
+                OutValue = Value;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    namespace
+    {
+        /**
+         * Sequential reader over an encoded payload
+         */
+        class FLogArgReader
+        {
+        public:
+            FLogArgReader(const uint8* Payload, uint32 Size)
+                : m_Payload(Payload)
+                , m_Size(Size)
+                , m_Offset(1)
+                , m_Remaining(Size > 0 ? Payload[0] : 0)
+            {}
+
+            // Int values come back as int64 bits, the rest as stored;
+            // OutWidth is the integer width in bits
+            bool Next(ELogArgType& OutType, uint32& OutWidth, uint64& OutBits, const char*& OutString, uint32& OutLength)
+            {
+                if (m_Remaining == 0 || m_Offset >= m_Size)
+                    return false;
+
+                const uint8 Tag = m_Payload[m_Offset++];
+                const uint32 WidthBytes = Tag >> LogArgWidthShift;
+
+                OutType = static_cast<ELogArgType>(Tag & LogArgTypeMask);
+                OutWidth = (WidthBytes > 0 && WidthBytes < 8) ? WidthBytes * 8 : 64;
+
+                switch (OutType)
+                {
+                case ELogArgType::String:
+                {
+                    uint64 Length = 0;
+                    if (!DecodeVarInt(m_Payload, m_Size, m_Offset, Length) || Length > m_Size - m_Offset)
+                        return false;
+
+                    OutString = reinterpret_cast<const char*>(m_Payload + m_Offset);
+                    OutLength = static_cast<uint32>(Length);
+                    m_Offset += OutLength;
+                    break;
+                }
+
+                case ELogArgType::Double:
+                    if (m_Offset + sizeof(OutBits) > m_Size)
+                        return false;
+
+                    memcpy(&OutBits, m_Payload + m_Offset, sizeof(OutBits));
+                    m_Offset += sizeof(OutBits);
+                    break;
+
+                case ELogArgType::Int:
+                    if (!DecodeVarInt(m_Payload, m_Size, m_Offset, OutBits))
+                        return false;
+
+                    OutBits = static_cast<uint64>(ZigZagDecode(OutBits));
+                    break;
+
+                case ELogArgType::UInt:
+                case ELogArgType::Pointer:
+                    if (!DecodeVarInt(m_Payload, m_Size, m_Offset, OutBits))
+                        return false;
+                    break;
+
+                default:
+                    return false;
+                }
+
+                --m_Remaining;
+                return true;
+            }
+
+        private:
+            const uint8* m_Payload;
+            uint32 m_Size;
+            uint32 m_Offset;
+            uint32 m_Remaining;
+        };
+
+        // Reinterpreted at the argument's own width, as printf would
+        int64 AsSigned(ELogArgType Type, uint32 Width, uint64 Bits)
+        {
+            if (Type == ELogArgType::Double)
+            {
+                double Value;
+                memcpy(&Value, &Bits, sizeof(Value));
+                return static_cast<int64>(Value);
+            }
+
+            if (Width < 64)
+                return static_cast<int64>(Bits << (64 - Width)) >> (64 - Width);
+
+            return static_cast<int64>(Bits);
+        }
+
+        uint64 AsUnsigned(ELogArgType Type, uint32 Width, uint64 Bits)
+        {
+            if (Type == ELogArgType::Double)
+                return static_cast<uint64>(AsSigned(Type, Width, Bits));
+
+            if (Width < 64)
+                return Bits & ((uint64(1) << Width) - 1);
+
+            return Bits;
+        }
+
+        // '*' width / precision argument
+        int32 NextInt(FLogArgReader& Reader)
+        {
+            ELogArgType Type;
+            uint32 Width = 64;
+            uint64 Bits = 0;
+            const char* String;
+            uint32 StringLength;
+
+            return Reader.Next(Type, Width, Bits, String, StringLength) ? static_cast<int32>(AsSigned(Type, Width, Bits)) : 0;
+        }
+
+        double AsDouble(ELogArgType Type, uint64 Bits)
+        {
+            if (Type == ELogArgType::Double)
+            {
+                double Value;
+                memcpy(&Value, &Bits, sizeof(Value));
+                return Value;
+            }
+
+            return (Type == ELogArgType::Int) ? static_cast<double>(static_cast<int64>(Bits))
+                                              : static_cast<double>(Bits);
+        }
+    }
+
+    uint32 RenderLogMessage(const char* Format, const uint8* Payload, uint32 PayloadSize,
+                            char* Out, uint32 OutSize)
+    {
+        if (!Out || OutSize == 0)
+            return 0;
+
+        FLogArgReader Reader(Payload, PayloadSize);
+        uint32 Length = 0;
+
+        auto Append = [&](int Written)
+        {
+            if (Written > 0)
+                Length = std::min<uint32>(Length + static_cast<uint32>(Written), OutSize - 1);
+        };
+
+        for (const char* c = Format ? Format : ""; *c && Length < OutSize - 1; ++c)
+        {
+            if (*c != '%')
+            {
+                Out[Length++] = *c;
+                continue;
+            }
+
+            if (c[1] == '%')
+            {
+                Out[Length++] = '%';
+                ++c;
+                continue;
+            }
+
+            // Rebuild the conversion with our own length modifier:
+            // %[flags][width][.precision] + widened type
+            char Spec[48];
+            uint32 SpecLength = 0;
+            Spec[SpecLength++] = '%';
+
+            const char* p = c + 1;
+            while (*p && strchr("-+ #0", *p) && SpecLength < 8)
+                Spec[SpecLength++] = *p++;
+
+            if (*p == '*')
+            {
+                SpecLength += snprintf(Spec + SpecLength, sizeof(Spec) - SpecLength, "%d", NextInt(Reader));
+                ++p;
+            }
+            else
+            {
+                while (*p >= '0' && *p <= '9' && SpecLength < 16)
+                    Spec[SpecLength++] = *p++;
+            }
+
+            int32 Precision = -1;
+            if (*p == '.')
+            {
+                ++p;
+                if (*p == '*')
+                {
+                    Precision = NextInt(Reader);
+                    ++p;
+                }
+                else
+                {
+                    Precision = 0;
+                    while (*p >= '0' && *p <= '9')
+                        Precision = Precision * 10 + (*p++ - '0');
+                }
+            }
+
+            // Source length modifiers are irrelevant - values carry their own width
+            while (*p && strchr("hlLqjztI", *p))
+            {
+                if (*p == 'I' && ((p[1] == '6' && p[2] == '4') || (p[1] == '3' && p[2] == '2')))
+                    p += 2;
+                ++p;
+            }
+
+            const char Conversion = *p;
+            if (!Conversion)
+                break;
+
+            c = p;
+
+            if (Conversion == 'n')
+                continue;
+
+            ELogArgType Type = ELogArgType::Int;
+            uint32 Width = 64;
+            uint64 Bits = 0;
+            const char* String = nullptr;
+            uint32 StringLength = 0;
+
+            if (!Reader.Next(Type, Width, Bits, String, StringLength))
+            {
+                Append(snprintf(Out + Length, OutSize - Length, "<?>"));
+                continue;
+            }
+
+            // Strings always carry a precision, since stored bytes aren't terminated
+            if (Conversion == 's' && Type == ELogArgType::String)
+                Precision = (Precision < 0) ? static_cast<int32>(StringLength) : std::min<int32>(Precision, static_cast<int32>(StringLength));
+
+            if (Precision >= 0)
+                SpecLength += snprintf(Spec + SpecLength, sizeof(Spec) - SpecLength, ".%d", Precision);
+
+            const uint32 Room = OutSize - Length;
+
+            switch (Conversion)
+            {
+            case 'd':
+            case 'i':
+                snprintf(Spec + SpecLength, sizeof(Spec) - SpecLength, "ll%c", Conversion);
+                Append(snprintf(Out + Length, Room, Spec, static_cast<long long>(AsSigned(Type, Width, Bits))));
+                break;
+
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                snprintf(Spec + SpecLength, sizeof(Spec) - SpecLength, "ll%c", Conversion);
+                Append(snprintf(Out + Length, Room, Spec, static_cast<unsigned long long>(AsUnsigned(Type, Width, Bits))));
+                break;
+
+            case 'c':
+                snprintf(Spec + SpecLength, sizeof(Spec) - SpecLength, "c");
+                Append(snprintf(Out + Length, Room, Spec, static_cast<int>(AsSigned(Type, Width, Bits))));
+                break;
+
+            case 'f': case 'F':
+            case 'e': case 'E':
+            case 'g': case 'G':
+            case 'a': case 'A':
+                snprintf(Spec + SpecLength, sizeof(Spec) - SpecLength, "%c", Conversion);
+                Append(snprintf(Out + Length, Room, Spec, AsDouble(Type, Bits)));
+                break;
+
+            case 'p':
+                snprintf(Spec + SpecLength, sizeof(Spec) - SpecLength, "p");
+                Append(snprintf(Out + Length, Room, Spec, reinterpret_cast<void*>(static_cast<uintptr>(Bits))));
+                break;
+
+            case 's':
+                if (Type == ELogArgType::String)
+                {
+                    snprintf(Spec + SpecLength, sizeof(Spec) - SpecLength, "s");
+                    Append(snprintf(Out + Length, Room, Spec, String));
+                }
+                else
+                {
+                    Append(snprintf(Out + Length, Room, "<?>"));
+                }
+                break;
+
+            default:
+                Append(snprintf(Out + Length, Room, "<%%%c?>", Conversion));
+                break;
+            }
+        }
+
+        Out[Length] = '\0';
+        return Length;
+    }
+
+    uint32 FormatLogLine(ELogLevel Level, int64 TimeUs, const char* Message, uint32 MessageLength,
+                         char* Out, uint32 OutSize)
+    {
+        time_t Seconds = static_cast<time_t>(TimeUs / 1000000);
+        int32 Millis = static_cast<int32>((TimeUs / 1000) % 1000);
+
+        struct tm TimeInfo;
+        Platform::LocalTime(Seconds, TimeInfo);
+
+        char Timestamp[32];
+        size_t TimestampLength = strftime(Timestamp, sizeof(Timestamp), "%H:%M:%S", &TimeInfo);
+        snprintf(Timestamp + TimestampLength, sizeof(Timestamp) - TimestampLength, ".%03d", Millis);
+
+        int Written = snprintf(Out, OutSize, "[%s] [%s] %.*s\n",
+            Timestamp, Log::GetLevelName(Level), static_cast<int>(MessageLength), Message);
+
+        if (Written < 0)
+            return 0;
+
+        return std::min<uint32>(static_cast<uint32>(Written), OutSize - 1);
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,297 @@
+/**
+ * UniversalSlashingSimulator - Structured Log Format
+ *
+ * Deferred formatting for the USS_LOG family. Each call site owns a
+ * static FLogSite (format string, level, file/line) registered once with
+ * a process-unique id; a log call only packs its raw arguments into a
+ * small typed payload. The writer thread renders text from site + payload
+ * off the hot path, or - in binary file mode - writes the payload as-is
+ * and leaves rendering to the offline decoder (Tools/LogDecoder).
+ *
+ * Integers are LEB128 varints ("var"), signed ones zigzagged ("svar"),
+ * so a typical call costs a handful of bytes instead of a text line.
+ *
+ * Payload:   uint8 ArgCount, then per argument uint8 tag +
+ *            Int: svar | UInt, Pointer: var | Double: 8 bytes |
+ *            String: var Len + bytes (not terminated)
+ *
+ * The tag's low nibble is the ELogArgType; for Int/UInt the high nibble
+ * is the argument's byte width after integer promotion (4 or 8), so an
+ * int32 -1 still renders as 4294967295 under %u. 0 means 64-bit, which
+ * is also how version 1 files read.
+ *
+ * Binary file layout (.usslog):
+ *   Header   "USSL" uint32 Version, int64 BaseTimeUs
+ *   'S' Site var Id, uint8 Level, var Line,
+ *            var Len + format bytes, var Len + file bytes
+ *   'E' Call var SiteId, svar TimeDeltaUs, var ThreadId,
+ *            var Len + payload bytes
+ *   'T' Text uint8 Level, svar TimeDeltaUs, var ThreadId,
+ *            var Len + message bytes
+ *
+ * TimeDeltaUs is relative to the previous record (the header base for
+ * the first one).
+ *
+ * A site record always precedes the first call record that uses it, so
+ * a log file decodes on its own without the binary that produced it.
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+namespace USS
+{
+    enum class ELogLevel : uint8;
+    struct FLogSite;
+
+    // Binary log file identification
+    constexpr char LogFileMagic[4] = { 'U', 'S', 'S', 'L' };
+    constexpr uint32 LogFileVersion = 2;
+
+    // Binary log record tags
+    enum class ELogRecordType : uint8
+    {
+        Site = 'S',
+        Call = 'E',
+        Text = 'T'
+    };
+
+    // Payload argument tags - one byte before each value
+    enum class ELogArgType : uint8
+    {
+        Int = 1,
+        UInt,
+        Double,
+        Pointer,
+        String
+    };
+
+    constexpr uint8 LogArgTypeMask = 0x0F;
+    constexpr uint32 LogArgWidthShift = 4;
+
+    // Longest LEB128 encoding of a 64-bit value
+    constexpr uint32 MaxVarIntBytes = 10;
+
+    inline uint32 EncodeVarInt(uint64 Value, uint8* Out)
+    {
+        uint32 Count = 0;
+        while (Value >= 0x80)
+        {
+            Out[Count++] = static_cast<uint8>(Value | 0x80);
+            Value >>= 7;
+        }
+        Out[Count++] = static_cast<uint8>(Value);
+        return Count;
+    }
+
+    inline uint64 ZigZagEncode(int64 Value)
+    {
+        return (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63);
+    }
+
+    inline int64 ZigZagDecode(uint64 Value)
+    {
+        return static_cast<int64>(Value >> 1) ^ -static_cast<int64>(Value & 1);
+    }
+
+    /**
+     * Reads a varint at Offset, advancing it
+     * @return false if the buffer ends mid-value
+     */
+    bool DecodeVarInt(const uint8* Data, uint32 Size, uint32& Offset, uint64& OutValue);
+
+    /**
+     * Token-bucket state for one call site, kept as a GCRA "theoretical
+     * arrival time" so admitting a message is a single CAS. Times are in
+     * Log's coarse microsecond clock.
+     */
+    struct FLogSiteLimiter
+    {
+        int64 IntervalUs;                       // 0: use Log's default limit
+        int64 BurstUs;                          // Slack beyond one interval
+        std::atomic<int64> ArrivalUs;
+        std::atomic<uint32> Suppressed;         // Since the last summary
+        std::atomic<bool> bListed;              // Linked into Log's summary list
+        const FLogSite* NextListed;
+
+        explicit FLogSiteLimiter(uint32 PerSecond)
+            : IntervalUs(PerSecond ? 1000000 / PerSecond : 0)
+            , BurstUs(PerSecond ? IntervalUs * (PerSecond - 1) : 0)    // One second's worth
+            , ArrivalUs(0)
+            , Suppressed(0)
+            , bListed(false)
+            , NextListed(nullptr)
+        {}
+    };
+
+    /**
+     * One USS_LOG call site. Lives in a function-local static, so the id
+     * is assigned once on first use and the format pointer stays valid
+     * for the process lifetime.
+     */
+    struct FLogSite
+    {
+        const char* Format;
+        const char* File;
+        uint32 Line;
+        uint32 Id;
+        ELogLevel Level;
+        mutable FLogSiteLimiter Limiter;
+
+        FLogSite(ELogLevel InLevel, const char* InFormat, const char* InFile, uint32 InLine,
+                 uint32 InRatePerSecond = 0)
+            : Format(InFormat)
+            , File(InFile)
+            , Line(InLine)
+            , Id(s_NextId.fetch_add(1, std::memory_order_relaxed))
+            , Level(InLevel)
+            , Limiter(InRatePerSecond)
+        {}
+
+    private:
+        static std::atomic<uint32> s_NextId;
+    };
+
+    /**
+     * Packs typed arguments into a fixed buffer. Arguments that don't fit
+     * are dropped; the renderer prints the missing ones as "<?>".
+     */
+    class FLogArgWriter
+    {
+    public:
+        FLogArgWriter(uint8* Buffer, uint32 Capacity)
+            : m_Buffer(Buffer)
+            , m_Capacity(Capacity)
+            , m_Size(1)
+        {
+            m_Buffer[0] = 0;    // Argument count
+        }
+
+        uint32 GetSize() const { return m_Size; }
+
+        // Int bits are an int64 reinterpreted; Double bits are the IEEE value.
+        // Width is the promoted integer size in bytes (0: full 64 bits)
+        void WriteScalar(ELogArgType Type, uint64 Bits, uint32 Width = 0)
+        {
+            if (m_Size + 1 + MaxVarIntBytes > m_Capacity)
+                return;
+
+            m_Buffer[m_Size++] = static_cast<uint8>(static_cast<uint8>(Type) | (Width << LogArgWidthShift));
+
+            if (Type == ELogArgType::Double)
+            {
+                memcpy(m_Buffer + m_Size, &Bits, sizeof(Bits));
+                m_Size += sizeof(Bits);
+            }
+            else
+            {
+                uint64 Value = (Type == ELogArgType::Int) ? ZigZagEncode(static_cast<int64>(Bits)) : Bits;
+                m_Size += EncodeVarInt(Value, m_Buffer + m_Size);
+            }
+
+            ++m_Buffer[0];
+        }
+
+        void WriteString(const char* Value)
+        {
+            if (!Value)
+                Value = "(null)";
+
+            if (m_Size + 1 + MaxVarIntBytes > m_Capacity)
+                return;
+
+            size_t Length = strlen(Value);
+            size_t Room = m_Capacity - m_Size - 1 - MaxVarIntBytes;
+            uint32 Stored = static_cast<uint32>(Length < Room ? Length : Room);
+
+            m_Buffer[m_Size++] = static_cast<uint8>(ELogArgType::String);
+            m_Size += EncodeVarInt(Stored, m_Buffer + m_Size);
+            memcpy(m_Buffer + m_Size, Value, Stored);
+            m_Size += Stored;
+            ++m_Buffer[0];
+        }
+
+    private:
+        uint8* m_Buffer;
+        uint32 m_Capacity;
+        uint32 m_Size;
+    };
+
+    // ============================================================================
+    // Argument encoding
+    // ============================================================================
+
+    inline void EncodeLogArg(FLogArgWriter& Writer, const char* Value) { Writer.WriteString(Value); }
+    inline void EncodeLogArg(FLogArgWriter& Writer, char* Value) { Writer.WriteString(Value); }
+
+    // Integers reach printf promoted to at least int
+    template<typename T>
+    constexpr uint32 LogArgWidth = sizeof(T) < sizeof(int32) ? sizeof(int32) : sizeof(T);
+
+    template<typename T>
+    inline void EncodeLogArg(FLogArgWriter& Writer, const T& Value)
+    {
+        if constexpr (std::is_enum<T>::value)
+        {
+            EncodeLogArg(Writer, static_cast<typename std::underlying_type<T>::type>(Value));
+        }
+        else if constexpr (std::is_integral<T>::value && std::is_signed<T>::value)
+        {
+            Writer.WriteScalar(ELogArgType::Int, static_cast<uint64>(static_cast<int64>(Value)), LogArgWidth<T>);
+        }
+        else if constexpr (std::is_integral<T>::value)
+        {
+            Writer.WriteScalar(ELogArgType::UInt, static_cast<uint64>(Value), LogArgWidth<T>);
+        }
+        else if constexpr (std::is_floating_point<T>::value)
+        {
+            double AsDouble = static_cast<double>(Value);
+            uint64 Bits;
+            memcpy(&Bits, &AsDouble, sizeof(Bits));
+            Writer.WriteScalar(ELogArgType::Double, Bits);
+        }
+        else if constexpr (std::is_null_pointer<T>::value)
+        {
+            Writer.WriteScalar(ELogArgType::Pointer, 0);
+        }
+        else if constexpr (std::is_pointer<T>::value)
+        {
+            Writer.WriteScalar(ELogArgType::Pointer, static_cast<uint64>(reinterpret_cast<uintptr>(Value)));
+        }
+        else
+        {
+            static_assert(sizeof(T) == 0, "Unsupported log argument type - pass printf-compatible values");
+        }
+    }
+
+    template<typename... ArgTypes>
+    inline uint32 EncodeLogArgs(uint8* Buffer, uint32 Capacity, const ArgTypes&... Args)
+    {
+        FLogArgWriter Writer(Buffer, Capacity);
+        (EncodeLogArg(Writer, Args), ...);
+        return Writer.GetSize();
+    }
+
+    // ============================================================================
+    // Rendering
+    // ============================================================================
+
+    /**
+     * printf-style render of Format against an encoded payload
+     * @return Characters written to Out (always terminated)
+     */
+    uint32 RenderLogMessage(const char* Format, const uint8* Payload, uint32 PayloadSize,
+                            char* Out, uint32 OutSize);
+
+    /**
+     * Final line layout shared by the live writer and the decoder:
+     *   [HH:MM:SS.mmm] [LEVEL] Message\n
+     */
+    uint32 FormatLogLine(ELogLevel Level, int64 TimeUs, const char* Message, uint32 MessageLength,
+                         char* Out, uint32 OutSize);
+
+}
\ No newline at end of file
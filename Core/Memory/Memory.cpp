@@ -1,9 +1,12 @@
 /**
  * UniversalSlashingSimulator - Memory Utilities Implementation
+ *
+ * Platform-independent part: pattern scanning and address math.
  */
 
 #include "Memory.h"
 #include "../Logging/Log.h"
+#include <cstring>
 #include <sstream>
 #include <vector>
 
@@ -12,36 +15,6 @@ namespace USS
     FModuleInfo Memory::s_BaseModule = { 0, 0, nullptr };
     bool Memory::s_bInitialized = false;
 
-    EResult Memory::Initialize()
-    {
-        if (s_bInitialized)
-            return EResult::AlreadyInitialized;
-
-        HMODULE hModule = GetModuleHandle(nullptr);
-        if (!hModule)
-        {
-            USS_ERROR("Failed to get base module handle");
-            return EResult::Failed;
-        }
-
-        MODULEINFO ModInfo = {};
-        if (!GetModuleInformation(GetCurrentProcess(), hModule, &ModInfo, sizeof(ModInfo)))
-        {
-            USS_ERROR("Failed to get module information");
-            return EResult::Failed;
-        }
-
-        s_BaseModule.BaseAddress = reinterpret_cast<uintptr>(ModInfo.lpBaseOfDll);
-        s_BaseModule.Size = ModInfo.SizeOfImage;
-        s_BaseModule.Name = "FortniteClient-Win64-Shipping.exe";
-
-        USS_LOG("Memory initialized - Base: 0x%llX, Size: 0x%llX",
-            s_BaseModule.BaseAddress, s_BaseModule.Size);
-
-        s_bInitialized = true;
-        return EResult::Success;
-    }
-
     const FModuleInfo& Memory::GetBaseModule()
     {
         return s_BaseModule;
@@ -150,22 +123,4 @@ namespace USS
         return Address + InstructionSize + Offset;
     }
 
-    bool Memory::IsValidAddress(uintptr Address)
-    {
-        if (Address == 0)
-            return false;
-
-        MEMORY_BASIC_INFORMATION MemInfo = {};
-        if (VirtualQuery(reinterpret_cast<void*>(Address), &MemInfo, sizeof(MemInfo)) == 0)
-            return false;
-
-        if (MemInfo.State != MEM_COMMIT)
-            return false;
-
-        if (MemInfo.Protect & (PAGE_NOACCESS | PAGE_GUARD))
-            return false;
-
-        return true;
-    }
-
 }
\ No newline at end of file
@@ -4,12 +4,16 @@
  * Provides memory manipulation, pattern scanning, and module
  * information utilities. All pattern scanning is abstracted
  * for future external offset finder integration.
+ *
+ * Pattern scanning lives in Memory.cpp. Module lookup and guarded
+ * access are per platform: MemoryWindows.cpp for the injected DLL,
+ * MemoryLinux.cpp for tools and tests that read synthesized engine
+ * structures in their own process.
  */
 
 #pragma once
 
 #include "../Common.h"
-#include <Psapi.h>
 
 namespace USS
 {
@@ -61,8 +65,17 @@ namespace USS
         template<typename T>
         static bool Write(uintptr Address, const T& Value);
 
+        // Bulk copy - one validity check and one fault guard for the whole range
+        static bool ReadBytes(uintptr Address, void* OutBuffer, size_t Size);
+
+        // Bulk write, lifting page protection for the duration
+        static bool WriteBytes(uintptr Address, const void* Buffer, size_t Size);
+
         static bool IsValidAddress(uintptr Address);
 
+        // Committed code page - tells vtable entries apart from the data after them
+        static bool IsExecutableAddress(uintptr Address);
+
     private:
         Memory() = default;
         ~Memory() = default;
@@ -76,6 +89,7 @@ namespace USS
     template<typename T>
     bool Memory::Read(uintptr Address, T& OutValue)
     {
+#ifdef _WIN32
         if (!IsValidAddress(Address))
             return false;
 
@@ -88,11 +102,15 @@ namespace USS
         {
             return false;
         }
+#else
+        return ReadBytes(Address, &OutValue, sizeof(T));
+#endif
     }
 
     template<typename T>
     bool Memory::Write(uintptr Address, const T& Value)
     {
+#ifdef _WIN32
         DWORD OldProtect;
         if (!VirtualProtect(reinterpret_cast<void*>(Address), sizeof(T), PAGE_EXECUTE_READWRITE, &OldProtect))
             return false;
@@ -109,6 +127,9 @@ namespace USS
 
         VirtualProtect(reinterpret_cast<void*>(Address), sizeof(T), OldProtect, &OldProtect);
         return true;
+#else
+        return WriteBytes(Address, &Value, sizeof(T));
+#endif
     }
 
 }
\ No newline at end of file
@@ -0,0 +1,236 @@
+/**
+ * UniversalSlashingSimulator - Memory Utilities (Linux)
+ *
+ * For tools and tests that read engine structures synthesized in their
+ * own process. Addresses are checked against /proc/self/maps instead of
+ * VirtualQuery, and there's nothing like SEH to fall back on, so the
+ * check is all that stands between a bad pointer and a crash.
+ *
+ * Each thread caches the parsed mappings and only re-reads the file when
+ * an address falls outside all of them or inside a no-access one, so
+ * reads of live memory make no syscalls. A mapping removed after being
+ * cached isn't noticed, so callers must not unmap memory they still read
+ * through here.
+ */
+
+#ifdef __linux__
+
+#include "Memory.h"
+#include "../Logging/Log.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <link.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+
+namespace USS
+{
+    namespace
+    {
+        struct FMapping
+        {
+            uintptr Begin;
+            uintptr End;
+            int Protection;     // PROT_* bits
+        };
+
+        // Every mapping in /proc/self/maps, sorted by address
+        bool ReadMappings(std::vector<FMapping>& OutMappings)
+        {
+            FILE* Maps = fopen("/proc/self/maps", "r");
+            if (!Maps)
+                return false;
+
+            OutMappings.clear();
+            char Line[512];
+
+            while (fgets(Line, sizeof(Line), Maps))
+            {
+                unsigned long long Begin = 0;
+                unsigned long long End = 0;
+                char Perms[5] = {};
+
+                if (sscanf(Line, "%llx-%llx %4s", &Begin, &End, Perms) != 3)
+                    continue;
+
+                FMapping Mapping;
+                Mapping.Begin = static_cast<uintptr>(Begin);
+                Mapping.End = static_cast<uintptr>(End);
+                Mapping.Protection = (Perms[0] == 'r' ? PROT_READ : 0)
+                    | (Perms[1] == 'w' ? PROT_WRITE : 0)
+                    | (Perms[2] == 'x' ? PROT_EXEC : 0);
+                OutMappings.push_back(Mapping);
+            }
+
+            fclose(Maps);
+            return true;
+        }
+
+        const FMapping* LookupMapping(const std::vector<FMapping>& Mappings, uintptr Address)
+        {
+            auto It = std::upper_bound(Mappings.begin(), Mappings.end(), Address,
+                [](uintptr Value, const FMapping& Mapping) { return Value < Mapping.Begin; });
+
+            if (It == Mappings.begin())
+                return nullptr;
+
+            --It;
+            return Address < It->End ? &*It : nullptr;
+        }
+
+        // Per-thread copy of the table, re-read on a miss so memory mapped
+        // since the last read is picked up. No-access entries count as a
+        // miss too: allocators reserve PROT_NONE ranges and mprotect them
+        // into use as the heap grows
+        thread_local std::vector<FMapping> t_Mappings;
+
+        bool FindMapping(uintptr Address, FMapping& OutMapping)
+        {
+            const FMapping* Mapping = LookupMapping(t_Mappings, Address);
+
+            if (!Mapping || Mapping->Protection == 0)
+            {
+                if (!ReadMappings(t_Mappings))
+                    return false;
+
+                Mapping = LookupMapping(t_Mappings, Address);
+                if (!Mapping)
+                    return false;
+            }
+
+            OutMapping = *Mapping;
+            return true;
+        }
+
+        bool IsReadableRange(uintptr Address, size_t Size)
+        {
+            // Null pages and wrapped ranges are never valid
+            if (Address < 0x10000 || Address + Size < Address)
+                return false;
+
+            uintptr Last = Address + Size - 1;
+
+            while (Address <= Last)
+            {
+                FMapping Mapping;
+                if (!FindMapping(Address, Mapping) || !(Mapping.Protection & PROT_READ))
+                    return false;
+
+                // Ranges spanning adjacent mappings check each in turn
+                if (Last < Mapping.End)
+                    return true;
+
+                Address = Mapping.End;
+            }
+
+            return true;
+        }
+
+        int FindMainModule(dl_phdr_info* Info, size_t, void* Data)
+        {
+            // The first entry is the executable itself
+            uintptr Begin = ~static_cast<uintptr>(0);
+            uintptr End = 0;
+
+            for (int i = 0; i < Info->dlpi_phnum; ++i)
+            {
+                const ElfW(Phdr)& Header = Info->dlpi_phdr[i];
+                if (Header.p_type != PT_LOAD)
+                    continue;
+
+                uintptr SegmentBegin = Info->dlpi_addr + Header.p_vaddr;
+                Begin = std::min(Begin, SegmentBegin);
+                End = std::max(End, SegmentBegin + Header.p_memsz);
+            }
+
+            FModuleInfo* OutModule = static_cast<FModuleInfo*>(Data);
+            OutModule->BaseAddress = Begin;
+            OutModule->Size = End > Begin ? End - Begin : 0;
+            return 1;
+        }
+    }
+
+    EResult Memory::Initialize()
+    {
+        if (s_bInitialized)
+            return EResult::AlreadyInitialized;
+
+        FModuleInfo Module = { 0, 0, nullptr };
+        dl_iterate_phdr(FindMainModule, &Module);
+
+        if (Module.Size == 0)
+        {
+            USS_ERROR("Failed to find the main executable's load segments");
+            return EResult::Failed;
+        }
+
+        s_BaseModule.BaseAddress = Module.BaseAddress;
+        s_BaseModule.Size = Module.Size;
+        s_BaseModule.Name = program_invocation_short_name;
+
+        USS_LOG("Memory initialized - Base: 0x%llX, Size: 0x%llX",
+            static_cast<unsigned long long>(s_BaseModule.BaseAddress),
+            static_cast<unsigned long long>(s_BaseModule.Size));
+
+        s_bInitialized = true;
+        return EResult::Success;
+    }
+
+    bool Memory::IsValidAddress(uintptr Address)
+    {
+        return IsReadableRange(Address, 1);
+    }
+
+    bool Memory::IsExecutableAddress(uintptr Address)
+    {
+        FMapping Mapping;
+        return Address != 0 && FindMapping(Address, Mapping) && (Mapping.Protection & PROT_EXEC) != 0;
+    }
+
+    bool Memory::ReadBytes(uintptr Address, void* OutBuffer, size_t Size)
+    {
+        if (!OutBuffer || Size == 0)
+            return false;
+
+        if (!IsReadableRange(Address, Size))
+            return false;
+
+        memcpy(OutBuffer, reinterpret_cast<const void*>(Address), Size);
+        return true;
+    }
+
+    bool Memory::WriteBytes(uintptr Address, const void* Buffer, size_t Size)
+    {
+        if (!Buffer || Size == 0 || Address == 0)
+            return false;
+
+        FMapping Mapping;
+        if (!FindMapping(Address, Mapping) || Address + Size > Mapping.End)
+            return false;
+
+        if (Mapping.Protection & PROT_WRITE)
+        {
+            memcpy(reinterpret_cast<void*>(Address), Buffer, Size);
+            return true;
+        }
+
+        // mprotect works on whole pages
+        const uintptr PageSize = static_cast<uintptr>(sysconf(_SC_PAGESIZE));
+        const uintptr PageBegin = Address & ~(PageSize - 1);
+        const size_t Length = (Address + Size) - PageBegin;
+
+        if (mprotect(reinterpret_cast<void*>(PageBegin), Length, PROT_READ | PROT_WRITE | PROT_EXEC) != 0)
+            return false;
+
+        memcpy(reinterpret_cast<void*>(Address), Buffer, Size);
+
+        mprotect(reinterpret_cast<void*>(PageBegin), Length, Mapping.Protection);
+        return true;
+    }
+
+}
+
+#endif
\ No newline at end of file
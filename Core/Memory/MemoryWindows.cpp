@@ -0,0 +1,125 @@
+/**
+ * UniversalSlashingSimulator - Memory Utilities (Windows)
+ *
+ * Module lookup through PSAPI, page checks through VirtualQuery and
+ * access faults caught with SEH.
+ */
+
+#ifdef _WIN32
+
+#include "Memory.h"
+#include "../Logging/Log.h"
+#include <Psapi.h>
+#include <cstring>
+
+namespace USS
+{
+    EResult Memory::Initialize()
+    {
+        if (s_bInitialized)
+            return EResult::AlreadyInitialized;
+
+        HMODULE hModule = GetModuleHandle(nullptr);
+        if (!hModule)
+        {
+            USS_ERROR("Failed to get base module handle");
+            return EResult::Failed;
+        }
+
+        MODULEINFO ModInfo = {};
+        if (!GetModuleInformation(GetCurrentProcess(), hModule, &ModInfo, sizeof(ModInfo)))
+        {
+            USS_ERROR("Failed to get module information");
+            return EResult::Failed;
+        }
+
+        s_BaseModule.BaseAddress = reinterpret_cast<uintptr>(ModInfo.lpBaseOfDll);
+        s_BaseModule.Size = ModInfo.SizeOfImage;
+        s_BaseModule.Name = "FortniteClient-Win64-Shipping.exe";
+
+        USS_LOG("Memory initialized - Base: 0x%llX, Size: 0x%llX",
+            s_BaseModule.BaseAddress, s_BaseModule.Size);
+
+        s_bInitialized = true;
+        return EResult::Success;
+    }
+
+    bool Memory::IsValidAddress(uintptr Address)
+    {
+        if (Address == 0)
+            return false;
+
+        MEMORY_BASIC_INFORMATION MemInfo = {};
+        if (VirtualQuery(reinterpret_cast<void*>(Address), &MemInfo, sizeof(MemInfo)) == 0)
+            return false;
+
+        if (MemInfo.State != MEM_COMMIT)
+            return false;
+
+        if (MemInfo.Protect & (PAGE_NOACCESS | PAGE_GUARD))
+            return false;
+
+        return true;
+    }
+
+    bool Memory::IsExecutableAddress(uintptr Address)
+    {
+        if (Address == 0)
+            return false;
+
+        MEMORY_BASIC_INFORMATION MemInfo = {};
+        if (VirtualQuery(reinterpret_cast<void*>(Address), &MemInfo, sizeof(MemInfo)) == 0)
+            return false;
+
+        if (MemInfo.State != MEM_COMMIT || (MemInfo.Protect & PAGE_GUARD))
+            return false;
+
+        return (MemInfo.Protect & (PAGE_EXECUTE | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY)) != 0;
+    }
+
+    bool Memory::ReadBytes(uintptr Address, void* OutBuffer, size_t Size)
+    {
+        if (!OutBuffer || Size == 0)
+            return false;
+
+        if (!IsValidAddress(Address))
+            return false;
+
+        __try
+        {
+            memcpy(OutBuffer, reinterpret_cast<const void*>(Address), Size);
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    bool Memory::WriteBytes(uintptr Address, const void* Buffer, size_t Size)
+    {
+        if (!Buffer || Size == 0)
+            return false;
+
+        DWORD OldProtect;
+        if (!VirtualProtect(reinterpret_cast<void*>(Address), Size, PAGE_EXECUTE_READWRITE, &OldProtect))
+            return false;
+
+        bool bWritten = true;
+
+        __try
+        {
+            memcpy(reinterpret_cast<void*>(Address), Buffer, Size);
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            bWritten = false;
+        }
+
+        VirtualProtect(reinterpret_cast<void*>(Address), Size, OldProtect, &OldProtect);
+        return bWritten;
+    }
+
+}
+
+#endif
\ No newline at end of file
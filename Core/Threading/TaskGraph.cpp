@@ -0,0 +1,194 @@
+/**
+ * UniversalSlashingSimulator - Task Graph Implementation
+ */
+
+#include "TaskGraph.h"
+#include "../Logging/Log.h"
+#include <algorithm>
+
+namespace USS
+{
+    int32 FTaskGraph::AddTask(const char* Name, FTaskFunc Func,
+        std::initializer_list<int32> Dependencies, bool bRequired)
+    {
+        // Dependencies can only point backwards, so the graph can't have cycles
+        for (int32 Dependency : Dependencies)
+        {
+            if (Dependency < 0 || Dependency >= static_cast<int32>(m_Tasks.size()))
+            {
+                USS_ERROR("Task %s depends on unknown task %d", Name ? Name : "?", Dependency);
+                return -1;
+            }
+        }
+
+        FTask Task;
+        Task.Name = Name ? Name : "Unnamed";
+        Task.Func = std::move(Func);
+        Task.Dependencies.assign(Dependencies.begin(), Dependencies.end());
+        Task.bRequired = bRequired;
+
+        m_Tasks.push_back(std::move(Task));
+        return static_cast<int32>(m_Tasks.size() - 1);
+    }
+
+    EResult FTaskGraph::Run(FWorkerPool& Pool)
+    {
+        {
+            std::lock_guard<std::mutex> Lock(m_Mutex);
+
+            for (FTask& Task : m_Tasks)
+            {
+                Task.State = ETaskState::Pending;
+                Task.Result = EResult::Success;
+                Task.StartMs = 0.0;
+                Task.DurationMs = 0.0;
+            }
+
+            m_Remaining = static_cast<int32>(m_Tasks.size());
+            m_FirstFailure = EResult::Success;
+            m_RunStart = std::chrono::steady_clock::now();
+        }
+
+        // One lane per worker plus the caller, never more than there are tasks
+        const int32 NumLanes = std::max(1, std::min(Pool.GetWorkerCount() + 1, static_cast<int32>(m_Tasks.size())));
+
+        Pool.ParallelFor(NumLanes, [this](int32) { RunLane(); });
+
+        m_WallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_RunStart).count();
+        return m_FirstFailure;
+    }
+
+    int32 FTaskGraph::ClaimReadyTask()
+    {
+        // Caller holds m_Mutex. Tasks are in dependency order, so one pass
+        // settles every skip that follows from an earlier failure
+        for (size_t i = 0; i < m_Tasks.size(); ++i)
+        {
+            FTask& Task = m_Tasks[i];
+            if (Task.State != ETaskState::Pending)
+                continue;
+
+            bool bReady = true;
+            bool bBlocked = false;
+
+            for (int32 Dependency : Task.Dependencies)
+            {
+                ETaskState DependencyState = m_Tasks[Dependency].State;
+                if (DependencyState == ETaskState::Failed || DependencyState == ETaskState::Skipped)
+                    bBlocked = true;
+                else if (DependencyState != ETaskState::Succeeded)
+                    bReady = false;
+            }
+
+            if (bBlocked)
+            {
+                Task.State = ETaskState::Skipped;
+                --m_Remaining;
+                continue;
+            }
+
+            if (bReady)
+            {
+                Task.State = ETaskState::Running;
+                return static_cast<int32>(i);
+            }
+        }
+
+        return -1;
+    }
+
+    void FTaskGraph::RunLane()
+    {
+        using FClock = std::chrono::steady_clock;
+
+        std::unique_lock<std::mutex> Lock(m_Mutex);
+
+        while (true)
+        {
+            int32 TaskId = ClaimReadyTask();
+
+            if (TaskId < 0)
+            {
+                if (m_Remaining == 0)
+                    break;
+
+                // Everything left is waiting on a running task
+                m_Condition.wait(Lock);
+                continue;
+            }
+
+            FTask& Task = m_Tasks[TaskId];
+            Lock.unlock();
+
+            const FClock::time_point Start = FClock::now();
+            EResult Result = Task.Func ? Task.Func() : EResult::Success;
+            const FClock::time_point End = FClock::now();
+
+            Lock.lock();
+
+            Task.Result = Result;
+            Task.State = (Result == EResult::Success) ? ETaskState::Succeeded : ETaskState::Failed;
+            Task.StartMs = std::chrono::duration<double, std::milli>(Start - m_RunStart).count();
+            Task.DurationMs = std::chrono::duration<double, std::milli>(End - Start).count();
+            --m_Remaining;
+
+            if (Task.State == ETaskState::Failed)
+            {
+                if (Task.bRequired)
+                {
+                    USS_ERROR("Startup task %s failed: %s", Task.Name.c_str(), ResultToString(Result));
+                    if (m_FirstFailure == EResult::Success)
+                        m_FirstFailure = Result;
+                }
+                else
+                {
+                    USS_WARN("Optional startup task %s failed: %s", Task.Name.c_str(), ResultToString(Result));
+                }
+            }
+
+            m_Condition.notify_all();
+        }
+
+        // Skips settled by this lane may have been the last ones
+        m_Condition.notify_all();
+    }
+
+    ETaskState FTaskGraph::GetState(int32 TaskId) const
+    {
+        std::lock_guard<std::mutex> Lock(m_Mutex);
+
+        if (TaskId < 0 || TaskId >= static_cast<int32>(m_Tasks.size()))
+            return ETaskState::Skipped;
+
+        return m_Tasks[TaskId].State;
+    }
+
+    std::vector<FTaskTiming> FTaskGraph::GetTimings() const
+    {
+        std::lock_guard<std::mutex> Lock(m_Mutex);
+
+        std::vector<FTaskTiming> Timings;
+        Timings.reserve(m_Tasks.size());
+
+        for (const FTask& Task : m_Tasks)
+        {
+            Timings.push_back({ Task.Name, Task.State, Task.Result, Task.StartMs, Task.DurationMs });
+        }
+
+        return Timings;
+    }
+
+    void FTaskGraph::LogTimings(const char* Title) const
+    {
+        // Log::Write rather than USS_LOG, which Release compiles out -
+        // slow startup stages matter most in shipped builds
+        Log::Write(ELogLevel::Info, "%s (%.1f ms wall):", Title, m_WallMs);
+
+        for (const FTaskTiming& Timing : GetTimings())
+        {
+            Log::Write(ELogLevel::Info, "  %-20s %-9s start %8.1f ms  took %8.1f ms",
+                Timing.Name.c_str(), GetTaskStateName(Timing.State), Timing.StartMs, Timing.DurationMs);
+        }
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+/**
+ * UniversalSlashingSimulator - Task Graph
+ *
+ * One-shot dependency graph for startup work. Tasks are added with the
+ * ids of the tasks they need, then Run() executes everything on the
+ * worker pool, starting each task as soon as its dependencies succeed,
+ * so independent chains (pattern scans, say) overlap.
+ *
+ * A failed task skips everything that depends on it. Failures of tasks
+ * added with bRequired = false are logged but don't fail Run().
+ *
+ * Every task's start and duration is recorded, and LogTimings() prints
+ * them so slow stages show up in the log, Release builds included.
+ *
+ * Tasks run on pool threads, so like any pool job they must not call
+ * back into the pool.
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include "WorkerPool.h"
+#include <chrono>
+#include <condition_variable>
+#include <initializer_list>
+#include <mutex>
+
+namespace USS
+{
+    enum class ETaskState : uint8
+    {
+        Pending,
+        Running,
+        Succeeded,
+        Failed,
+        Skipped         // A dependency failed or was skipped
+    };
+
+    inline const char* GetTaskStateName(ETaskState State)
+    {
+        switch (State)
+        {
+        case ETaskState::Pending:   return "Pending";
+        case ETaskState::Running:   return "Running";
+        case ETaskState::Succeeded: return "Succeeded";
+        case ETaskState::Failed:    return "Failed";
+        case ETaskState::Skipped:   return "Skipped";
+        default:                    return "Unknown";
+        }
+    }
+
+    struct FTaskTiming
+    {
+        std::string Name;
+        ETaskState State;
+        EResult Result;
+        double StartMs;         // Since Run() started
+        double DurationMs;
+    };
+
+    class FTaskGraph
+    {
+    public:
+        using FTaskFunc = std::function<EResult()>;
+
+        FTaskGraph() = default;
+
+        USS_NON_COPYABLE(FTaskGraph)
+        USS_NON_MOVABLE(FTaskGraph)
+
+        /**
+         * @param Dependencies - Ids returned by earlier AddTask calls
+         * @return Task id, or -1 if a dependency isn't a known task
+         */
+        int32 AddTask(const char* Name, FTaskFunc Func,
+            std::initializer_list<int32> Dependencies = {}, bool bRequired = true);
+
+        /**
+         * Run every task to completion on Pool (inline if it isn't started)
+         * @return First failure of a required task, or Success
+         */
+        EResult Run(FWorkerPool& Pool);
+
+        ETaskState GetState(int32 TaskId) const;
+
+        // One entry per task, in AddTask order
+        std::vector<FTaskTiming> GetTimings() const;
+
+        // Total wall time of the last Run()
+        double GetWallMs() const { return m_WallMs; }
+
+        void LogTimings(const char* Title) const;
+
+    private:
+        struct FTask
+        {
+            std::string Name;
+            FTaskFunc Func;
+            std::vector<int32> Dependencies;
+            bool bRequired = true;
+            ETaskState State = ETaskState::Pending;
+            EResult Result = EResult::Success;
+            double StartMs = 0.0;
+            double DurationMs = 0.0;
+        };
+
+        // Next runnable task, marking tasks behind a failure as skipped; -1 if none
+        int32 ClaimReadyTask();
+
+        void RunLane();
+
+        std::vector<FTask> m_Tasks;
+
+        mutable std::mutex m_Mutex;
+        std::condition_variable m_Condition;
+        int32 m_Remaining = 0;          // Tasks not yet finished or skipped
+        EResult m_FirstFailure = EResult::Success;
+        double m_WallMs = 0.0;
+        std::chrono::steady_clock::time_point m_RunStart;
+    };
+
+}
\ No newline at end of file
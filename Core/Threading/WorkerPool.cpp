@@ -0,0 +1,156 @@
+/**
+ * UniversalSlashingSimulator - Worker Pool Implementation
+ */
+
+#include "WorkerPool.h"
+#include "../Logging/Log.h"
+#include <algorithm>
+
+namespace USS
+{
+    FWorkerPool::FWorkerPool()
+        : m_pJob(nullptr)
+        , m_JobCount(0)
+        , m_NextIndex(0)
+        , m_PendingWorkers(0)
+        , m_Generation(0)
+        , m_bStopping(false)
+    {
+    }
+
+    FWorkerPool::~FWorkerPool()
+    {
+        Shutdown();
+    }
+
+    FWorkerPool& FWorkerPool::Get()
+    {
+        static FWorkerPool Instance;
+        return Instance;
+    }
+
+    EResult FWorkerPool::Initialize(int32 NumWorkers)
+    {
+        std::lock_guard<std::mutex> Submit(m_SubmitMutex);
+
+        if (!m_Workers.empty())
+            return EResult::AlreadyInitialized;
+
+        if (NumWorkers <= 0)
+        {
+            // Leave one hardware thread for the game thread itself
+            int32 HardwareThreads = static_cast<int32>(std::thread::hardware_concurrency());
+            NumWorkers = std::min(std::max(HardwareThreads - 1, 1), 7);
+        }
+
+        m_bStopping = false;
+        m_Workers.reserve(NumWorkers);
+
+        for (int32 i = 0; i < NumWorkers; ++i)
+        {
+            m_Workers.emplace_back(&FWorkerPool::WorkerMain, this);
+        }
+
+        USS_LOG("Worker pool started with %d threads", NumWorkers);
+        return EResult::Success;
+    }
+
+    void FWorkerPool::Shutdown()
+    {
+        std::lock_guard<std::mutex> Submit(m_SubmitMutex);
+
+        if (m_Workers.empty())
+            return;
+
+        {
+            std::lock_guard<std::mutex> Lock(m_Mutex);
+            m_bStopping = true;
+        }
+
+        m_WakeCondition.notify_all();
+
+        for (auto& Worker : m_Workers)
+        {
+            if (Worker.joinable())
+                Worker.join();
+        }
+
+        m_Workers.clear();
+
+        USS_LOG("Worker pool stopped");
+    }
+
+    void FWorkerPool::ParallelFor(int32 Count, const std::function<void(int32)>& Func)
+    {
+        if (Count <= 0)
+            return;
+
+        std::lock_guard<std::mutex> Submit(m_SubmitMutex);
+
+        if (m_Workers.empty() || Count == 1)
+        {
+            for (int32 i = 0; i < Count; ++i)
+                Func(i);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> Lock(m_Mutex);
+            m_pJob = &Func;
+            m_JobCount = Count;
+            m_NextIndex.store(0, std::memory_order_relaxed);
+            m_PendingWorkers = static_cast<int32>(m_Workers.size());
+            ++m_Generation;
+        }
+
+        m_WakeCondition.notify_all();
+
+        // Help out rather than idle
+        RunJob();
+
+        std::unique_lock<std::mutex> Lock(m_Mutex);
+        m_DoneCondition.wait(Lock, [this]() { return m_PendingWorkers == 0; });
+        m_pJob = nullptr;
+    }
+
+    void FWorkerPool::WorkerMain()
+    {
+        uint64 SeenGeneration = 0;
+
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> Lock(m_Mutex);
+                m_WakeCondition.wait(Lock, [&]() { return m_bStopping || m_Generation != SeenGeneration; });
+
+                if (m_bStopping)
+                    return;
+
+                SeenGeneration = m_Generation;
+            }
+
+            RunJob();
+
+            {
+                std::lock_guard<std::mutex> Lock(m_Mutex);
+                if (--m_PendingWorkers == 0)
+                    m_DoneCondition.notify_one();
+            }
+        }
+    }
+
+    void FWorkerPool::RunJob()
+    {
+        // Indices are claimed one at a time; per-player jobs are coarse
+        // enough that contention on the counter doesn't matter
+        for (;;)
+        {
+            int32 Index = m_NextIndex.fetch_add(1, std::memory_order_relaxed);
+            if (Index >= m_JobCount)
+                break;
+
+            (*m_pJob)(Index);
+        }
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+/**
+ * UniversalSlashingSimulator - Worker Pool
+ *
+ * Small fixed-size thread pool for data-parallel work on the game thread's
+ * behalf. The submitting thread joins in and blocks until every index has
+ * run, so callers can treat ParallelFor as a drop-in for a plain loop.
+ *
+ * Jobs must not call back into the pool or touch engine state that isn't
+ * safe to read concurrently; anything with side effects belongs in a
+ * serial pass afterwards.
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace USS
+{
+    class FWorkerPool
+    {
+    public:
+        static FWorkerPool& Get();
+
+        USS_NON_COPYABLE(FWorkerPool)
+        USS_NON_MOVABLE(FWorkerPool)
+
+        /**
+         * Start the worker threads
+         * @param NumWorkers Worker count, 0 = hardware threads - 1 (max 7)
+         */
+        EResult Initialize(int32 NumWorkers = 0);
+        void Shutdown();
+
+        bool IsInitialized() const { return !m_Workers.empty(); }
+        int32 GetWorkerCount() const { return static_cast<int32>(m_Workers.size()); }
+
+        /**
+         * Run Func(Index) for every Index in [0, Count)
+         *
+         * Runs inline when the pool isn't started or there is only one
+         * index. Concurrent callers are serialized.
+         */
+        void ParallelFor(int32 Count, const std::function<void(int32)>& Func);
+
+    private:
+        FWorkerPool();
+        ~FWorkerPool();
+
+        void WorkerMain();
+        void RunJob();
+
+        std::vector<std::thread> m_Workers;
+
+        // One ParallelFor in flight at a time
+        std::mutex m_SubmitMutex;
+
+        // Job state, guarded by m_Mutex except for the index counter
+        std::mutex m_Mutex;
+        std::condition_variable m_WakeCondition;
+        std::condition_variable m_DoneCondition;
+        const std::function<void(int32)>* m_pJob;
+        int32 m_JobCount;
+        std::atomic<int32> m_NextIndex;
+        int32 m_PendingWorkers;
+        uint64 m_Generation;
+        bool m_bStopping;
+    };
+
+    // Convenience function
+    inline FWorkerPool& GetWorkerPool()
+    {
+        return FWorkerPool::Get();
+    }
+
+}
\ No newline at end of file
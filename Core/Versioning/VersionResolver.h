@@ -10,6 +10,10 @@
  * 2. Fall back to CL-based detection via pattern scanning
  * 3. Map CL to known Fortnite/Engine versions
  * 4. Compute feature flags based on version
+ *
+ * The CL table is checked at compile time (sorted, non-overlapping) and
+ * searched by binary search; each row's generation and feature flags are
+ * computed at compile time too, so a lookup never branches on versions.
  */
 
 #pragma once
@@ -49,6 +53,20 @@ namespace USS
 
         static FVersionResolver& Get();
 
+        /**
+         * Resolve a CL against the mapping table without touching the
+         * detected version - for tools mapping CLs from crash reports
+         * @return false if the CL is outside every known range
+         */
+        static bool LookupCL(uint32 CL, FVersionInfo& OutInfo);
+
+        /**
+         * Take the version from a known CL instead of detecting it - for
+         * tools running without a game process
+         * @return InvalidVersion if the CL is outside every known range
+         */
+        EResult OverrideVersion(uint32 CL);
+
     private:
         bool TryDetectFromVersionInfo();
         bool TryDetectFromCL();
@@ -56,22 +74,12 @@ namespace USS
 
         bool MapCLToVersion(uint32 CL);
         void ComputeFeatureFlags();
-        void DetermineGeneration();
 
         FVersionInfo m_VersionInfo;
         bool m_bDetected;
 
-        struct FCLMapping
-        {
-            uint32 CLMin;
-            uint32 CLMax;
-            uint32 EngineMajor;
-            uint32 EngineMinor;
-            double FortniteVersion;
-        };
-
-        static const FCLMapping s_CLMappings[];
-        static const size_t s_CLMappingCount;
+        // Mapping table row the version came from, -1 if none
+        int32 m_MappingIndex;
     };
 
     inline FVersionResolver& GetVersionResolver()
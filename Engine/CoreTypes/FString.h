@@ -25,6 +25,7 @@
 #include "../../Core/Memory/Memory.h"
 #include <string>
 #include <cstdlib>
+#include <cstring>
 
 namespace USS
 {
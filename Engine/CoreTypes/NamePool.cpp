@@ -9,6 +9,19 @@
 
 namespace USS
 {
+    namespace
+    {
+        // Monotonic: a reader that synced late never lowers what another saw
+        void RaiseCount(std::atomic<int32>& Count, int32 NumBlocks)
+        {
+            int32 Current = Count.load(std::memory_order_relaxed);
+            while (Current < NumBlocks &&
+                !Count.compare_exchange_weak(Current, NumBlocks, std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+        }
+    }
+
     //=========================================================================
     // FGNamesArray Implementation (Pre-4.23)
     //=========================================================================
@@ -43,9 +56,19 @@ namespace USS
             return EResult::Failed;
         }
 
+        m_NumElements = CountElements();
+
+        USS_LOG("FGNamesArray initialized: ~%d estimated elements", m_NumElements);
+
+        m_bInitialized = true;
+        return EResult::Success;
+    }
+
+    int32 FGNamesArray::CountElements() const
+    {
         // Estimate number of elements by reading chunks
         // Normally, we'd scan until we find null entries
-        m_NumElements = 0;
+        int32 NumElements = 0;
 
         for (int32 ChunkIdx = 0; ChunkIdx < 128; ++ChunkIdx)
         {
@@ -56,13 +79,19 @@ namespace USS
             if (ChunkPtr == 0)
                 break;
 
-            m_NumElements += ElementsPerChunk;
+            NumElements += ElementsPerChunk;
         }
 
-        USS_LOG("FGNamesArray initialized: ~%d estimated elements", m_NumElements);
+        return NumElements;
+    }
 
-        m_bInitialized = true;
-        return EResult::Success;
+    bool FGNamesArray::Refresh()
+    {
+        if (!m_bInitialized)
+            return false;
+
+        m_NumElements = CountElements();
+        return true;
     }
 
     bool FGNamesArray::GetName(int32 ComparisonIndex, FResolvedName& OutName) const
@@ -98,8 +127,8 @@ namespace USS
         // Name data starts at offset 0x10
         uintptr NameDataAddr = EntryPtr + NameOffset;
 
-        static char AnsiBuffer[1024];
-        static wchar_t WideBuffer[1024];
+        thread_local char AnsiBuffer[1024];
+        thread_local wchar_t WideBuffer[1024];
 
         if (OutName.bIsWide)
         {
@@ -195,21 +224,34 @@ namespace USS
         // uint32 CurrentByteCursor;// 0x0C
         // void* Blocks[8192];      // 0x10
 
-        uint32 CurrentBlock = 0;
-        if (!Memory::Read<uint32>(m_BaseAddress + 0x08, CurrentBlock))
+        if (!SyncBlocks())
         {
             USS_ERROR("Failed to read CurrentBlock from FNamePool");
             return EResult::Failed;
         }
 
-        m_NumBlocks = CurrentBlock + 1;
-
-        USS_LOG("FNamePoolImpl initialized: %d blocks", m_NumBlocks);
+        USS_LOG("FNamePoolImpl initialized: %d blocks", m_NumBlocks.load());
 
         m_bInitialized = true;
         return EResult::Success;
     }
 
+    bool FNamePoolImpl::Refresh()
+    {
+        return m_bInitialized && SyncBlocks();
+    }
+
+    bool FNamePoolImpl::SyncBlocks() const
+    {
+        uint32 CurrentBlock = 0;
+        if (!Memory::Read<uint32>(m_BaseAddress + 0x08, CurrentBlock) ||
+            CurrentBlock >= static_cast<uint32>(MaxBlocks))
+            return false;
+
+        RaiseCount(m_NumBlocks, static_cast<int32>(CurrentBlock) + 1);
+        return true;
+    }
+
     bool FNamePoolImpl::GetName(int32 ComparisonIndex, FResolvedName& OutName) const
     {
         if (!m_bInitialized || ComparisonIndex < 0)
@@ -221,7 +263,9 @@ namespace USS
         int32 BlockIndex = ComparisonIndex >> 16;
         int32 NameOffset = (ComparisonIndex & 0xFFFF) * 2;
 
-        if (BlockIndex >= m_NumBlocks)
+        // A block allocated since the last sync: re-read CurrentBlock once
+        if (BlockIndex >= m_NumBlocks.load(std::memory_order_acquire) &&
+            (!SyncBlocks() || BlockIndex >= m_NumBlocks.load(std::memory_order_acquire)))
             return false;
 
         uintptr BlockPtr = 0;
@@ -248,8 +292,8 @@ namespace USS
 
         uintptr NameDataAddr = EntryAddr + sizeof(uint16);
 
-        static char AnsiBuffer[1024];
-        static wchar_t WideBuffer[1024];
+        thread_local char AnsiBuffer[1024];
+        thread_local wchar_t WideBuffer[1024];
 
         if (OutName.bIsWide)
         {
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "../../Core/Common.h"
+#include <atomic>
 
 namespace USS
 {
@@ -82,10 +83,13 @@ namespace USS
 
         // Check if initialized
         virtual bool IsInitialized() const = 0;
+
+        // Pick up names allocated since Initialize
+        virtual bool Refresh() { return IsInitialized(); }
     };
 
     // GNames array implementation (Pre-4.23)
-    class FGNamesArray : public INamePool
+    class FGNamesArray final : public INamePool
     {
     public:
         FGNamesArray();
@@ -97,8 +101,12 @@ namespace USS
         int32 Num() const override;
         EResult Initialize(uintptr Address) override;
         bool IsInitialized() const override;
+        bool Refresh() override;
 
     private:
+        // Count allocated chunks
+        int32 CountElements() const;
+
         // Internal layout:
         // Chunked indirect array with 0x4000 elements per chunk
         // Access: GNames.Objects[index / 0x4000][index % 0x4000]
@@ -122,7 +130,7 @@ namespace USS
     };
 
     // FNamePool implementation (4.23+)
-    class FNamePoolImpl : public INamePool
+    class FNamePoolImpl final : public INamePool
     {
     public:
         FNamePoolImpl();
@@ -134,6 +142,7 @@ namespace USS
         int32 Num() const override;
         EResult Initialize(uintptr Address) override;
         bool IsInitialized() const override;
+        bool Refresh() override;
 
     private:
         // FNamePool layout (4.23+):
@@ -158,8 +167,11 @@ namespace USS
         static constexpr int32 MaxBlocks = 8192;
         static constexpr uintptr BlocksOffset = 0x10;
 
+        // Raise the cached block count to the live one; false if it can't be read
+        bool SyncBlocks() const;
+
         uintptr m_BaseAddress;
-        int32 m_NumBlocks;
+        mutable std::atomic<int32> m_NumBlocks;
         bool m_bInitialized;
     };
 
@@ -6,9 +6,44 @@
 #include "../../Core/Memory/Memory.h"
 #include "../../Core/Logging/Log.h"
 #include "../../Core/Versioning/VersionResolver.h"
+#include <algorithm>
+#include <cstring>
 
 namespace USS
 {
+    namespace
+    {
+        // Copy one FUObjectItem out of storage the array has already checked
+        void ReadItem(uintptr ItemAddr, FObjectItem& OutItem)
+        {
+            const uint8* Item = reinterpret_cast<const uint8*>(ItemAddr);
+
+            memcpy(&OutItem.Object, Item + 0x00, sizeof(OutItem.Object));
+            memcpy(&OutItem.Flags, Item + 0x08, sizeof(OutItem.Flags));
+            memcpy(&OutItem.ClusterIndex, Item + 0x0C, sizeof(OutItem.ClusterIndex));
+            memcpy(&OutItem.SerialNumber, Item + 0x10, sizeof(OutItem.SerialNumber));
+        }
+
+        // First and last byte of a block GObjects allocates in one piece
+        bool IsValidRange(uintptr Address, size_t Size)
+        {
+            return Address != 0 && Size != 0 &&
+                Memory::IsValidAddress(Address) &&
+                Memory::IsValidAddress(Address + Size - 1);
+        }
+
+        // The engine never shrinks NumElements, and neither do we - two
+        // threads catching up at once keep the larger count
+        void RaiseCount(std::atomic<int32>& Count, int32 NumElements)
+        {
+            int32 Current = Count.load(std::memory_order_relaxed);
+            while (Current < NumElements &&
+                !Count.compare_exchange_weak(Current, NumElements, std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+        }
+    }
+
     //=========================================================================
     // FFixedObjectArray Implementation (UE4.11-4.20)
     //=========================================================================
@@ -18,7 +53,6 @@ namespace USS
         , m_ObjectsPtr(0)
         , m_NumElements(0)
         , m_MaxElements(0)
-        , m_ItemSize(0x18)  // Default: Object(8) + Flags(4) + ClusterIndex(4) + SerialNumber(4)
         , m_bInitialized(false)
     {
     }
@@ -56,14 +90,27 @@ namespace USS
             return EResult::Failed;
         }
 
-        if (!Memory::Read<int32>(TUObjectArrayAddr + 0x0C, m_NumElements))
+        int32 NumElements = 0;
+        if (!Memory::Read<int32>(TUObjectArrayAddr + 0x0C, NumElements))
         {
             USS_ERROR("Failed to read NumElements from FUObjectArray");
             return EResult::Failed;
         }
 
+        // The item array is allocated at MaxElements up front and never
+        // reallocated, so checking it here covers every later item read
+        if (NumElements < 0 || NumElements > m_MaxElements ||
+            !IsValidRange(m_ObjectsPtr, static_cast<size_t>(m_MaxElements) * ItemSize))
+        {
+            USS_ERROR("FUObjectArray item storage is not readable (Objects=0x%llX, MaxElements=%d)",
+                static_cast<unsigned long long>(m_ObjectsPtr), m_MaxElements);
+            return EResult::Failed;
+        }
+
+        m_NumElements.store(NumElements, std::memory_order_release);
+
         USS_LOG("FFixedObjectArray initialized: NumElements=%d, MaxElements=%d",
-            m_NumElements, m_MaxElements);
+            NumElements, m_MaxElements);
 
         m_bInitialized = true;
         return EResult::Success;
@@ -71,50 +118,49 @@ namespace USS
 
     int32 FFixedObjectArray::Num() const
     {
-        return m_NumElements;
+        return m_NumElements.load(std::memory_order_acquire);
     }
 
-    void* FFixedObjectArray::GetByIndex(int32 Index) const
+    bool FFixedObjectArray::GetItemByIndex(int32 Index, FObjectItem& OutItem) const
     {
         if (!IsValidIndex(Index))
-            return nullptr;
-
-        uintptr ItemAddr = m_ObjectsPtr + (Index * m_ItemSize);
-
-        void* Object = nullptr;
-        if (!Memory::Read<void*>(ItemAddr, Object))
-            return nullptr;
+            return false;
 
-        return Object;
+        ReadItem(m_ObjectsPtr + (Index * ItemSize), OutItem);
+        return true;
     }
 
-    bool FFixedObjectArray::GetItemByIndex(int32 Index, FObjectItem& OutItem) const
+    bool FFixedObjectArray::IsValidIndex(int32 Index) const
     {
-        if (!IsValidIndex(Index))
+        if (!m_bInitialized || Index < 0)
             return false;
 
-        uintptr ItemAddr = m_ObjectsPtr + (Index * m_ItemSize);
+        if (Index < m_NumElements.load(std::memory_order_acquire))
+            return true;
 
-        if (!Memory::Read<void*>(ItemAddr + 0x00, OutItem.Object))
-            return false;
-        if (!Memory::Read<int32>(ItemAddr + 0x08, OutItem.Flags))
-            return false;
-        if (!Memory::Read<int32>(ItemAddr + 0x0C, OutItem.ClusterIndex))
-            return false;
-        if (!Memory::Read<int32>(ItemAddr + 0x10, OutItem.SerialNumber))
-            return false;
+        // Past the cached count - the object may just be newer than it
+        return SyncCount() && Index < m_NumElements.load(std::memory_order_acquire);
+    }
 
-        return true;
+    bool FFixedObjectArray::IsInitialized() const
+    {
+        return m_bInitialized;
     }
 
-    bool FFixedObjectArray::IsValidIndex(int32 Index) const
+    bool FFixedObjectArray::Refresh()
     {
-        return m_bInitialized && Index >= 0 && Index < m_NumElements;
+        return m_bInitialized && SyncCount();
     }
 
-    bool FFixedObjectArray::IsInitialized() const
+    bool FFixedObjectArray::SyncCount() const
     {
-        return m_bInitialized;
+        int32 NumElements = 0;
+        if (!Memory::Read<int32>(m_BaseAddress + 0x10 + 0x0C, NumElements) ||
+            NumElements < 0 || NumElements > m_MaxElements)
+            return false;
+
+        RaiseCount(m_NumElements, NumElements);
+        return true;
     }
 
     //=========================================================================
@@ -126,9 +172,9 @@ namespace USS
         , m_ChunksPtr(0)
         , m_NumElements(0)
         , m_MaxElements(0)
-        , m_NumChunks(0)
-        , m_ItemSize(0x18)
+        , m_MaxChunks(0)
         , m_bInitialized(false)
+        , m_NumChunks(0)
     {
     }
 
@@ -166,20 +212,43 @@ namespace USS
             return EResult::Failed;
         }
 
-        if (!Memory::Read<int32>(TUObjectArrayAddr + 0x14, m_NumElements))
+        int32 NumElements = 0;
+        if (!Memory::Read<int32>(TUObjectArrayAddr + 0x14, NumElements))
         {
             USS_ERROR("Failed to read NumElements from FChunkedObjectArray");
             return EResult::Failed;
         }
 
-        if (!Memory::Read<int32>(TUObjectArrayAddr + 0x1C, m_NumChunks))
+        int32 NumChunks = 0;
+        if (!Memory::Read<int32>(TUObjectArrayAddr + 0x1C, NumChunks))
         {
             USS_ERROR("Failed to read NumChunks from FChunkedObjectArray");
             return EResult::Failed;
         }
 
+        if (m_MaxElements < 0)
+        {
+            USS_ERROR("FChunkedObjectArray MaxElements is negative (%d)", m_MaxElements);
+            return EResult::Failed;
+        }
+
+        // Every chunk the array can ever have, so LoadChunks never reallocates
+        m_MaxChunks = (m_MaxElements + ElementsPerChunk - 1) / ElementsPerChunk;
+        m_Chunks = std::make_unique<uintptr[]>(static_cast<size_t>(std::max(m_MaxChunks, 1)));
+        m_NumChunks.store(0, std::memory_order_relaxed);
+
+        if (!LoadChunks(NumChunks))
+        {
+            USS_ERROR("FChunkedObjectArray chunk storage is not readable");
+            return EResult::Failed;
+        }
+
+        // Only ever hand out items from chunks that have been checked
+        const int32 LoadedChunks = m_NumChunks.load(std::memory_order_relaxed);
+        m_NumElements.store(std::min(NumElements, LoadedChunks * ElementsPerChunk), std::memory_order_release);
+
         USS_LOG("FChunkedObjectArray initialized: NumElements=%d, NumChunks=%d",
-            m_NumElements, m_NumChunks);
+            m_NumElements.load(std::memory_order_relaxed), LoadedChunks);
 
         m_bInitialized = true;
         return EResult::Success;
@@ -187,80 +256,84 @@ namespace USS
 
     int32 FChunkedObjectArray::Num() const
     {
-        return m_NumElements;
+        return m_NumElements.load(std::memory_order_acquire);
     }
 
-    void* FChunkedObjectArray::GetByIndex(int32 Index) const
+    bool FChunkedObjectArray::GetItemByIndex(int32 Index, FObjectItem& OutItem) const
     {
         if (!IsValidIndex(Index))
-            return nullptr;
-
-        int32 ChunkIndex = Index / ElementsPerChunk;
-        int32 WithinChunkIndex = Index % ElementsPerChunk;
+            return false;
 
-        // Get chunk pointer
-        uintptr ChunkPtrAddr = m_ChunksPtr + (ChunkIndex * sizeof(uintptr));
-        uintptr ChunkPtr = 0;
+        // m_NumElements never runs past the loaded chunks
+        ReadItem(m_Chunks[Index / ElementsPerChunk] + (Index % ElementsPerChunk) * ItemSize, OutItem);
+        return true;
+    }
 
-        if (!Memory::Read<uintptr>(ChunkPtrAddr, ChunkPtr))
-            return nullptr;
+    bool FChunkedObjectArray::IsValidIndex(int32 Index) const
+    {
+        if (!m_bInitialized || Index < 0)
+            return false;
 
-        if (ChunkPtr == 0)
-            return nullptr;
+        if (Index < m_NumElements.load(std::memory_order_acquire))
+            return true;
 
-        // Get object from chunk
-        uintptr ItemAddr = ChunkPtr + (WithinChunkIndex * m_ItemSize);
+        // Past the cached count - the object may just be newer than it
+        return SyncCount() && Index < m_NumElements.load(std::memory_order_acquire);
+    }
 
-        void* Object = nullptr;
-        if (!Memory::Read<void*>(ItemAddr, Object))
-            return nullptr;
+    bool FChunkedObjectArray::IsInitialized() const
+    {
+        return m_bInitialized;
+    }
 
-        return Object;
+    bool FChunkedObjectArray::Refresh()
+    {
+        return m_bInitialized && SyncCount();
     }
 
-    bool FChunkedObjectArray::GetItemByIndex(int32 Index, FObjectItem& OutItem) const
+    bool FChunkedObjectArray::SyncCount() const
     {
-        if (!IsValidIndex(Index))
+        int32 NumElements = 0;
+        int32 NumChunks = 0;
+        if (!Memory::Read<int32>(m_BaseAddress + 0x10 + 0x14, NumElements) ||
+            !Memory::Read<int32>(m_BaseAddress + 0x10 + 0x1C, NumChunks))
             return false;
 
-        int32 ChunkIndex = Index / ElementsPerChunk;
-        int32 WithinChunkIndex = Index % ElementsPerChunk;
-
-        // Get chunk pointer
-        uintptr ChunkPtrAddr = m_ChunksPtr + (ChunkIndex * sizeof(uintptr));
-        uintptr ChunkPtr = 0;
+        // The engine adds a chunk before it bumps NumElements into it, so
+        // reading the count first means the chunks cover it
+        if (NumChunks > m_NumChunks.load(std::memory_order_acquire))
+        {
+            FScopedLock Lock(m_ChunksLock);
+            if (!LoadChunks(NumChunks))
+                return false;
+        }
 
-        if (!Memory::Read<uintptr>(ChunkPtrAddr, ChunkPtr))
-            return false;
+        const int32 LoadedChunks = m_NumChunks.load(std::memory_order_acquire);
+        RaiseCount(m_NumElements, std::min(NumElements, LoadedChunks * ElementsPerChunk));
+        return true;
+    }
 
-        if (ChunkPtr == 0)
+    bool FChunkedObjectArray::LoadChunks(int32 NumChunks) const
+    {
+        if (NumChunks < 0 || NumChunks > m_MaxChunks)
             return false;
 
-        // Get item from chunk
-        uintptr ItemAddr = ChunkPtr + (WithinChunkIndex * m_ItemSize);
+        // Publish each chunk as soon as it's checked; a reader only indexes
+        // a slot below the count it loaded
+        for (int32 ChunkIndex = m_NumChunks.load(std::memory_order_relaxed); ChunkIndex < NumChunks; ++ChunkIndex)
+        {
+            uintptr ChunkPtr = 0;
+            if (!Memory::Read<uintptr>(m_ChunksPtr + ChunkIndex * sizeof(uintptr), ChunkPtr) ||
+                !IsValidRange(ChunkPtr, ElementsPerChunk * ItemSize))
+                return false;
 
-        if (!Memory::Read<void*>(ItemAddr + 0x00, OutItem.Object))
-            return false;
-        if (!Memory::Read<int32>(ItemAddr + 0x08, OutItem.Flags))
-            return false;
-        if (!Memory::Read<int32>(ItemAddr + 0x0C, OutItem.ClusterIndex))
-            return false;
-        if (!Memory::Read<int32>(ItemAddr + 0x10, OutItem.SerialNumber))
-            return false;
+            m_Chunks[ChunkIndex] = ChunkPtr;
+            m_NumChunks.store(ChunkIndex + 1, std::memory_order_release);
+        }
 
         return true;
     }
 
-    bool FChunkedObjectArray::IsValidIndex(int32 Index) const
-    {
-        return m_bInitialized && Index >= 0 && Index < m_NumElements;
-    }
-
-    bool FChunkedObjectArray::IsInitialized() const
-    {
-        return m_bInitialized;
-    }
-
     //=========================================================================
     // Factory Function
     //=========================================================================
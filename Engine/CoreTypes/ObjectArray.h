@@ -5,11 +5,23 @@
  * object array (GObjects). Implementations differ between:
  * - UE4.11-4.20: Fixed direct array (FUObjectItem*)
  * - UE4.21+: Chunked indirect array (FUObjectItem**)
+ *
+ * The factory picks one implementation per process. Loops over every
+ * object should go through VisitObjectArray(), which branches on the
+ * layout once and hands the loop the concrete (final) class, so the
+ * per-element read is inlined instead of a virtual call.
+ *
+ * The element count is cached. A lookup past it re-reads the live count
+ * (and, for the chunked layout, any new chunks) before giving up, so
+ * objects created after Initialize() resolve without a Refresh().
  */
 
 #pragma once
 
 #include "../../Core/Common.h"
+#include "../../Core/Memory/Memory.h"
+#include <atomic>
+#include <memory>
 
 namespace USS
 {
@@ -26,6 +38,14 @@ namespace USS
         NoStrongReference = 1 << 31,
     };
 
+    // Which implementation sits behind an IObjectArray
+    enum class EObjectArrayLayout : uint8
+    {
+        Fixed,
+        Chunked,
+        Other           // Not one of ours, e.g. a headless stub
+    };
+
     // Object item wrapper (version-agnostic)
     struct FObjectItem
     {
@@ -62,7 +82,9 @@ namespace USS
         // Get object by index (returns UObject*)
         virtual void* GetByIndex(int32 Index) const = 0;
 
-        // Get object item by index
+        // Get object item by index. Item storage is checked once when the
+        // array (or a new chunk) is first seen, so this is a plain copy -
+        // cheap enough to validate a handle on every use.
         virtual bool GetItemByIndex(int32 Index, FObjectItem& OutItem) const = 0;
 
         // Check if index is valid
@@ -73,21 +95,45 @@ namespace USS
 
         // Check if initialized
         virtual bool IsInitialized() const = 0;
+
+        // Re-read the element count from the live array - Num() is a
+        // snapshot otherwise. Only ever grows the count, so it is safe
+        // while other threads read.
+        virtual bool Refresh() { return IsInitialized(); }
+
+        // Lets VisitObjectArray reach the concrete type
+        virtual EObjectArrayLayout GetLayout() const { return EObjectArrayLayout::Other; }
     };
 
     // Fixed object array implementation (UE4.11-4.20)
-    class FFixedObjectArray : public IObjectArray
+    class FFixedObjectArray final : public IObjectArray
     {
     public:
         FFixedObjectArray();
         ~FFixedObjectArray() override = default;
 
         int32 Num() const override;
-        void* GetByIndex(int32 Index) const override;
         bool GetItemByIndex(int32 Index, FObjectItem& OutItem) const override;
         bool IsValidIndex(int32 Index) const override;
         EResult Initialize(uintptr Address) override;
         bool IsInitialized() const override;
+        bool Refresh() override;
+        EObjectArrayLayout GetLayout() const override { return EObjectArrayLayout::Fixed; }
+
+        // Inline so loops over the concrete type compile to a plain read
+        void* GetByIndex(int32 Index) const override
+        {
+            if (!m_bInitialized || Index < 0)
+                return nullptr;
+
+            // Past the cached count, IsValidIndex re-reads the live one
+            if (Index >= m_NumElements.load(std::memory_order_acquire) && !IsValidIndex(Index))
+                return nullptr;
+
+            void* Object = nullptr;
+            Memory::Read<void*>(m_ObjectsPtr + Index * ItemSize, Object);
+            return Object;
+        }
 
     private:
         // Internal layout for fixed array
@@ -101,27 +147,49 @@ namespace USS
         //     int32 NumElements;
         // }
 
+        // FUObjectItem: Object(8) + Flags(4) + ClusterIndex(4) + SerialNumber(4), padded
+        static constexpr size_t ItemSize = 0x18;
+
+        // Raise the cached count to the live one; false if it can't be read
+        bool SyncCount() const;
+
         uintptr m_BaseAddress;
         uintptr m_ObjectsPtr;
-        int32 m_NumElements;
+        mutable std::atomic<int32> m_NumElements;
         int32 m_MaxElements;
-        size_t m_ItemSize;
         bool m_bInitialized;
     };
 
     // Chunked object array implementation (UE4.21+)
-    class FChunkedObjectArray : public IObjectArray
+    class FChunkedObjectArray final : public IObjectArray
     {
     public:
         FChunkedObjectArray();
         ~FChunkedObjectArray() override = default;
 
         int32 Num() const override;
-        void* GetByIndex(int32 Index) const override;
         bool GetItemByIndex(int32 Index, FObjectItem& OutItem) const override;
         bool IsValidIndex(int32 Index) const override;
         EResult Initialize(uintptr Address) override;
         bool IsInitialized() const override;
+        bool Refresh() override;
+        EObjectArrayLayout GetLayout() const override { return EObjectArrayLayout::Chunked; }
+
+        // Inline so loops over the concrete type compile to a plain read
+        void* GetByIndex(int32 Index) const override
+        {
+            if (!m_bInitialized || Index < 0)
+                return nullptr;
+
+            // Past the cached count, IsValidIndex re-reads the live one
+            if (Index >= m_NumElements.load(std::memory_order_acquire) && !IsValidIndex(Index))
+                return nullptr;
+
+            // Chunk pointers were checked once by LoadChunks
+            void* Object = nullptr;
+            Memory::Read<void*>(m_Chunks[Index / ElementsPerChunk] + (Index % ElementsPerChunk) * ItemSize, Object);
+            return Object;
+        }
 
     private:
         // Internal layout for chunked array
@@ -135,16 +203,50 @@ namespace USS
         // }
 
         static constexpr int32 ElementsPerChunk = 64 * 1024;  // 65536
+        static constexpr size_t ItemSize = 0x18;
+
+        // Raise the cached count to the live one, loading new chunks first;
+        // false if the live array can't be read
+        bool SyncCount() const;
+
+        // Read and check chunk pointers up to NumChunks; chunks are never
+        // freed or moved, so each one is only looked at once. Caller holds
+        // m_ChunksLock once the array is shared
+        bool LoadChunks(int32 NumChunks) const;
 
         uintptr m_BaseAddress;
         uintptr m_ChunksPtr;
-        int32 m_NumElements;
+        mutable std::atomic<int32> m_NumElements;
         int32 m_MaxElements;
-        int32 m_NumChunks;
-        size_t m_ItemSize;
+        int32 m_MaxChunks;
         bool m_bInitialized;
+
+        // Sized for MaxChunks up front, so readers never see it move; a
+        // slot is written once, before m_NumChunks is raised past it
+        std::unique_ptr<uintptr[]> m_Chunks;
+        mutable std::atomic<int32> m_NumChunks;
+        mutable FCriticalSection m_ChunksLock;
     };
 
     std::unique_ptr<IObjectArray> CreateObjectArray();
 
+    /**
+     * Call Func(const T& Array) with Array as its concrete class - one
+     * branch per call instead of a virtual call per element. Anything
+     * that isn't one of ours is passed through as the interface.
+     */
+    template<typename Callback>
+    decltype(auto) VisitObjectArray(const IObjectArray& Array, Callback&& Func)
+    {
+        switch (Array.GetLayout())
+        {
+        case EObjectArrayLayout::Fixed:
+            return Func(static_cast<const FFixedObjectArray&>(Array));
+        case EObjectArrayLayout::Chunked:
+            return Func(static_cast<const FChunkedObjectArray&>(Array));
+        default:
+            return Func(Array);
+        }
+    }
+
 }
\ No newline at end of file
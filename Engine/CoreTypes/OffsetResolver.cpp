@@ -68,6 +68,13 @@ namespace USS
             m_Offsets.UStruct.Children = 0x38;
             m_Offsets.UStruct.ChildProperties = 0x00;  // Not present
             m_Offsets.UStruct.PropertiesSize = 0x40;
+
+            // UFunction (UStruct ends at 0x88; RepOffset sits before NumParms)
+            m_Offsets.UFunction.FunctionFlags = 0x88;
+            m_Offsets.UFunction.NumParms = 0x8E;
+            m_Offsets.UFunction.ParmsSize = 0x90;
+            m_Offsets.UFunction.ReturnValueOffset = 0x92;
+            m_Offsets.UFunction.Func = 0xB0;
             break;
 
         case EEngineGeneration::UE4_20_22:
@@ -81,6 +88,12 @@ namespace USS
             m_Offsets.UStruct.Children = 0x38;
             m_Offsets.UStruct.ChildProperties = 0x00;
             m_Offsets.UStruct.PropertiesSize = 0x44;
+
+            m_Offsets.UFunction.FunctionFlags = 0x88;
+            m_Offsets.UFunction.NumParms = 0x8E;
+            m_Offsets.UFunction.ParmsSize = 0x90;
+            m_Offsets.UFunction.ReturnValueOffset = 0x92;
+            m_Offsets.UFunction.Func = 0xB0;
             break;
 
         case EEngineGeneration::UE4_23_24:
@@ -93,6 +106,12 @@ namespace USS
             m_Offsets.UStruct.Children = 0x38;
             m_Offsets.UStruct.ChildProperties = 0x00;
             m_Offsets.UStruct.PropertiesSize = 0x48;
+
+            m_Offsets.UFunction.FunctionFlags = 0x88;
+            m_Offsets.UFunction.NumParms = 0x8E;
+            m_Offsets.UFunction.ParmsSize = 0x90;
+            m_Offsets.UFunction.ReturnValueOffset = 0x92;
+            m_Offsets.UFunction.Func = 0xB0;
             break;
 
         case EEngineGeneration::UE4_25:
@@ -117,6 +136,13 @@ namespace USS
             m_Offsets.FProperty.ElementSize = 0x38;
             m_Offsets.FProperty.Offset = 0x44;
             m_Offsets.FProperty.PropertyFlags = 0x48;
+
+            // UFunction (UStruct ends at 0xB0 with ChildProperties; no RepOffset)
+            m_Offsets.UFunction.FunctionFlags = 0xB0;
+            m_Offsets.UFunction.NumParms = 0xB4;
+            m_Offsets.UFunction.ParmsSize = 0xB6;
+            m_Offsets.UFunction.ReturnValueOffset = 0xB8;
+            m_Offsets.UFunction.Func = 0xD8;
             break;
 
         case EEngineGeneration::UE4_26_27:
@@ -138,6 +164,12 @@ namespace USS
             m_Offsets.FProperty.ElementSize = 0x38;
             m_Offsets.FProperty.Offset = 0x44;
             m_Offsets.FProperty.PropertyFlags = 0x48;
+
+            m_Offsets.UFunction.FunctionFlags = 0xB0;
+            m_Offsets.UFunction.NumParms = 0xB4;
+            m_Offsets.UFunction.ParmsSize = 0xB6;
+            m_Offsets.UFunction.ReturnValueOffset = 0xB8;
+            m_Offsets.UFunction.Func = 0xD8;
             break;
 
         case EEngineGeneration::UE5_0:
@@ -164,6 +196,12 @@ namespace USS
             m_Offsets.FProperty.ElementSize = 0x40;
             m_Offsets.FProperty.Offset = 0x4C;
             m_Offsets.FProperty.PropertyFlags = 0x50;
+
+            m_Offsets.UFunction.FunctionFlags = 0xB0;
+            m_Offsets.UFunction.NumParms = 0xB4;
+            m_Offsets.UFunction.ParmsSize = 0xB6;
+            m_Offsets.UFunction.ReturnValueOffset = 0xB8;
+            m_Offsets.UFunction.Func = 0xD8;
             break;
 
         default:
@@ -217,12 +255,23 @@ namespace USS
             if (strcmp(Name, "PropertyLink") == 0) return 0x50;  // Default PropertyLink offset
             break;
 
+        case EOffsetCategory::UFunction:
+            if (strcmp(Name, "FunctionFlags") == 0) return m_Offsets.UFunction.FunctionFlags;
+            if (strcmp(Name, "NumParms") == 0) return m_Offsets.UFunction.NumParms;
+            if (strcmp(Name, "ParmsSize") == 0) return m_Offsets.UFunction.ParmsSize;
+            if (strcmp(Name, "ReturnValueOffset") == 0) return m_Offsets.UFunction.ReturnValueOffset;
+            if (strcmp(Name, "Func") == 0) return m_Offsets.UFunction.Func;
+            break;
+
         case EOffsetCategory::UProperty:
             // UProperty offsets (pre-4.25)
             if (strcmp(Name, "ArrayDim") == 0) return 0x38;
             if (strcmp(Name, "ElementSize") == 0) return 0x3C;
             if (strcmp(Name, "PropertyFlags") == 0) return 0x40;
             if (strcmp(Name, "Offset_Internal") == 0) return 0x4C;
+            // UBoolProperty tail (sizeof(UProperty) = 0x70)
+            if (strcmp(Name, "ByteOffset") == 0) return 0x71;
+            if (strcmp(Name, "FieldMask") == 0) return 0x73;
             break;
 
         case EOffsetCategory::FField:
@@ -239,6 +288,9 @@ namespace USS
             if (strcmp(Name, "ElementSize") == 0) return 0x3C;
             if (strcmp(Name, "PropertyFlags") == 0) return 0x40;
             if (strcmp(Name, "Offset_Internal") == 0) return 0x4C;
+            // FBoolProperty tail (sizeof(FProperty) = 0x78)
+            if (strcmp(Name, "ByteOffset") == 0) return 0x79;
+            if (strcmp(Name, "FieldMask") == 0) return 0x7B;
             break;
 
         case EOffsetCategory::FFieldClass:
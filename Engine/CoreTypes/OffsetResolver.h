@@ -13,6 +13,7 @@
 
 #include "../../Core/Common.h"
 #include "../../Core/Versioning/VersionInfo.h"
+#include <cstring>
 
 namespace USS
 {
@@ -83,6 +84,15 @@ namespace USS
             int32 Func;            // Native function pointer
         } UFunction;
 
+        // FFrame offsets (script/native call frame)
+        struct
+        {
+            int32 Node;            // UFunction* being executed
+            int32 Object;          // Context object
+            int32 Code;            // Bytecode cursor, null for ProcessEvent calls
+            int32 Locals;          // Parameter block
+        } Frame;
+
         // UProperty offsets (pre-4.25)
         struct
         {
@@ -185,6 +195,12 @@ namespace USS
             UStruct.ChildProperties = 0x00;  // 0 = not present (pre-4.25)
             UStruct.PropertiesSize = 0x40;
             UStruct.MinAlignment = 0x44;
+
+            // FFrame (FOutputDevice base is 0x10, stable across UE4/UE5)
+            Frame.Node = 0x10;
+            Frame.Object = 0x18;
+            Frame.Code = 0x20;
+            Frame.Locals = 0x28;
         }
     };
 
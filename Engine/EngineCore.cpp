@@ -7,6 +7,11 @@
 #include "../Core/Logging/Log.h"
 #include "../Core/Versioning/VersionResolver.h"
 #include "../Core/Hooks/HookTypes.h"
+#include "../Core/Threading/TaskGraph.h"
+#include "Events/NativeHooks.h"
+#include "Events/VTableHooks.h"
+#include "UObject/ObjectPathCache.h"
+#include <cstring>
 
 namespace USS
 {
@@ -14,6 +19,8 @@ namespace USS
         : m_GObjectsAddress(0)
         , m_GNamesAddress(0)
         , m_GWorldAddress(0)
+        , m_WorldClass(nullptr)
+        , m_WorldClassSearchNum(-1)
     {
     }
 
@@ -36,46 +43,33 @@ namespace USS
         USS_LOG("=== UniversalSlashingSimulator Engine Core ===");
         USS_LOG("Initializing engine core...");
 
-        EResult Result = Memory::Initialize();
-        if (Result != EResult::Success)
-        {
-            USS_ERROR("Failed to initialize memory utilities");
-            return Result;
-        }
+        // Everything after version detection only needs the version, so the
+        // three pattern scans and offset resolution run side by side.
+        // The parallel stages scan with Memory::FindPatternIDA, which only
+        // reads the module range the Memory stage set and keeps its state on
+        // the stack. Memcury (PatternScanner) makes no reentrancy promise and
+        // is only called from the Version stage - keep it out of the others
+        FTaskGraph Startup;
 
-        Result = InitializeVersion();
-        if (Result != EResult::Success)
-        {
-            USS_ERROR("Failed to detect version");
-            return Result;
-        }
+        const int32 MemoryTask = Startup.AddTask("Memory", []() { return Memory::Initialize(); });
+        const int32 VersionTask = Startup.AddTask("Version", [this]() { return InitializeVersion(); }, { MemoryTask });
+        const int32 OffsetsTask = Startup.AddTask("Offsets", [this]() { return InitializeOffsets(); }, { VersionTask });
+        const int32 ObjectArrayTask = Startup.AddTask("ObjectArray", [this]() { return InitializeObjectArray(); }, { VersionTask });
+        const int32 NamePoolTask = Startup.AddTask("NamePool", [this]() { return InitializeNamePool(); }, { VersionTask });
 
-        Result = InitializeOffsets();
-        if (Result != EResult::Success)
-        {
-            USS_ERROR("Failed to resolve offsets");
-            return Result;
-        }
+        // GWorld is only needed once a match is running, a miss isn't fatal
+        Startup.AddTask("World", [this]() { return InitializeWorld(); }, { MemoryTask }, false);
 
-        Result = InitializeObjectArray();
-        if (Result != EResult::Success)
-        {
-            USS_ERROR("Failed to initialize object array");
-            return Result;
-        }
+        // Non-fatal, as before the graph - hooks are stubbed until @timmie implements
+        Startup.AddTask("Hooks", [this]() { return InitializeHooks(); }, { OffsetsTask, ObjectArrayTask, NamePoolTask }, false);
 
-        Result = InitializeNamePool();
-        if (Result != EResult::Success)
-        {
-            USS_ERROR("Failed to initialize name pool");
-            return Result;
-        }
+        EResult Result = Startup.Run(GetWorkerPool());
+        Startup.LogTimings("Engine core startup");
 
-        Result = InitializeHooks();
         if (Result != EResult::Success)
         {
-            USS_WARN("Hook initialization returned: %s (@timmie must implement)", ResultToString(Result));
-            // Non-fatal - hooks are stubbed until @timmie implements
+            USS_ERROR("Engine core initialization failed");
+            return Result;
         }
 
         m_Status.bFullyInitialized = true;
@@ -84,6 +78,27 @@ namespace USS
         return EResult::Success;
     }
 
+    EResult FEngineCore::InitializeWithTables(std::unique_ptr<IObjectArray> ObjectArray, std::unique_ptr<INamePool> NamePool)
+    {
+        if (m_Status.bFullyInitialized)
+            return EResult::AlreadyInitialized;
+
+        if (!ObjectArray || !ObjectArray->IsInitialized() || !NamePool || !NamePool->IsInitialized())
+            return EResult::InvalidParameter;
+
+        m_pObjectArray = std::move(ObjectArray);
+        m_pNamePool = std::move(NamePool);
+
+        m_Status.bVersionResolved = GetVersionResolver().IsVersionDetected();
+        m_Status.bOffsetsResolved = GetOffsetResolver().IsResolved();
+        m_Status.bObjectArrayInitialized = true;
+        m_Status.bNamePoolInitialized = true;
+        m_Status.bFullyInitialized = true;
+
+        USS_LOG("Engine core initialized with external tables");
+        return EResult::Success;
+    }
+
     void FEngineCore::Shutdown()
     {
         if (!m_Status.bFullyInitialized)
@@ -91,11 +106,22 @@ namespace USS
 
         USS_LOG("Shutting down engine core...");
 
-        Hook::Shutdown();
+        if (m_Status.bHooksInitialized)
+        {
+            GetNativeHooks().UnhookAll();
+            GetVTableHooks().Shutdown();
+            Hook::Shutdown();
+        }
+
+        // Cached paths are keyed by index into the array going away
+        GetObjectPathCache().Clear();
 
         m_pNamePool.reset();
         m_pObjectArray.reset();
 
+        m_WorldClass.store(nullptr, std::memory_order_relaxed);
+        m_WorldClassSearchNum.store(-1, std::memory_order_relaxed);
+
         m_Status = FEngineCoreStatus();
 
         USS_LOG("Engine core shutdown complete");
@@ -192,6 +218,18 @@ namespace USS
         return EResult::Success;
     }
 
+    EResult FEngineCore::InitializeWorld()
+    {
+        m_GWorldAddress = FindGWorldAddress();
+        if (m_GWorldAddress == 0)
+            return EResult::PatternNotFound;
+
+        USS_LOG("GWorld at 0x%llX", m_GWorldAddress);
+
+        m_Status.bWorldResolved = true;
+        return EResult::Success;
+    }
+
     EResult FEngineCore::InitializeHooks()
     {
         USS_LOG("Initializing hooks (STUB - @timmie must implement with Memcury/MinHook)...");
@@ -203,7 +241,16 @@ namespace USS
         }
 
         // TODO: @timmie creates ProcessEvent hook here
-        // See HookTypes.h for implementation guide
+        // See HookTypes.h for implementation guide. Either detour the shared
+        // ProcessEvent, or pass the slot from PatternScanner::FindProcessEvent
+        // to GetVTableHooks().Initialize() to only intercept attached objects
+        // Register with GetHookRegistry().Register(...) so every hook above
+        // goes live in the single batch below
+
+        if (Result == EResult::Success)
+        {
+            GetHookRegistry().InstallPending();
+        }
 
         m_Status.bHooksInitialized = true;
         return EResult::Success;
@@ -313,17 +360,31 @@ namespace USS
         if (!m_pObjectArray || !FullName)
             return UObjectWrapper();
 
-        // Simple linear search - in production would use hash
-        int32 Num = m_pObjectArray->Num();
+        // Linear, but against cached paths - each name in an outer chain
+        // is decoded once per session, not once per object per call
+        const char* Space = strchr(FullName, ' ');
+        if (!Space)
+            return UObjectWrapper();
+
+        const std::string_view Path(Space + 1);
+        FObjectPathCache& PathCache = GetObjectPathCache();
+
+        const int32 Num = m_pObjectArray->Num();
         for (int32 i = 0; i < Num; ++i)
         {
-            void* Obj = m_pObjectArray->GetByIndex(i);
-            if (Obj)
-            {
-                UObjectWrapper Wrapper(Obj);
-                if (Wrapper.GetFullName() == FullName)
-                    return Wrapper;
-            }
+            std::string_view Cached = PathCache.GetPathName(i);
+            if (!Cached.empty() && (Cached != Path || PathCache.GetFullName(i) != FullName))
+                continue;
+
+            UObjectWrapper Wrapper(m_pObjectArray->GetByIndex(i));
+            if (!Wrapper.GetRaw())
+                continue;
+
+            // Outer chain the cache can't follow - build the name directly
+            if (Cached.empty() && Wrapper.GetFullName() != FullName)
+                continue;
+
+            return Wrapper;
         }
 
         return UObjectWrapper();
@@ -334,16 +395,25 @@ namespace USS
         if (!m_pObjectArray || !Name)
             return UObjectWrapper();
 
-        int32 Num = m_pObjectArray->Num();
+        const std::string_view Target(Name);
+        FObjectPathCache& PathCache = GetObjectPathCache();
+
+        const int32 Num = m_pObjectArray->Num();
         for (int32 i = 0; i < Num; ++i)
         {
-            void* Obj = m_pObjectArray->GetByIndex(i);
-            if (Obj)
-            {
-                UObjectWrapper Wrapper(Obj);
-                if (Wrapper.GetName() == Name)
-                    return Wrapper;
-            }
+            std::string_view Cached = PathCache.GetName(i);
+            if (!Cached.empty() && Cached != Target)
+                continue;
+
+            UObjectWrapper Wrapper(m_pObjectArray->GetByIndex(i));
+            if (!Wrapper.GetRaw())
+                continue;
+
+            // Outer chain the cache can't follow - decode the name directly
+            if (Cached.empty() && Wrapper.GetName() != Target)
+                continue;
+
+            return Wrapper;
         }
 
         return UObjectWrapper();
@@ -354,24 +424,27 @@ namespace USS
         if (!m_pObjectArray || !ClassName)
             return UClassWrapper();
 
-        // Search for Class with matching name
-        std::string TargetName = ClassName;
-        int32 Num = m_pObjectArray->Num();
+        // Name first - it's a cached compare, IsA walks the class chain
+        const std::string_view Target(ClassName);
+        FObjectPathCache& PathCache = GetObjectPathCache();
 
+        const int32 Num = m_pObjectArray->Num();
         for (int32 i = 0; i < Num; ++i)
         {
-            void* Obj = m_pObjectArray->GetByIndex(i);
-            if (Obj)
-            {
-                UObjectWrapper Wrapper(Obj);
-
-                // Check if this is a UClass
-                if (Wrapper.IsA("Class"))
-                {
-                    if (Wrapper.GetName() == TargetName)
-                        return UClassWrapper(Obj);
-                }
-            }
+            std::string_view Cached = PathCache.GetName(i);
+            if (!Cached.empty() && Cached != Target)
+                continue;
+
+            UObjectWrapper Wrapper(m_pObjectArray->GetByIndex(i));
+            if (!Wrapper.GetRaw())
+                continue;
+
+            // Outer chain the cache can't follow - decode the name directly
+            if (Cached.empty() && Wrapper.GetName() != Target)
+                continue;
+
+            if (Wrapper.IsA("Class"))
+                return UClassWrapper(Wrapper.GetRaw());
         }
 
         return UClassWrapper();
@@ -384,25 +457,22 @@ namespace USS
         if (!m_pObjectArray)
             return nullptr;
 
-        int32 Num = m_pObjectArray->Num();
-        for (int32 i = 0; i < Num; ++i)
+        void* Found = nullptr;
+        ForEachObject([&](UObjectWrapper Wrapper) -> bool
         {
-            void* Obj = m_pObjectArray->GetByIndex(i);
-            if (Obj)
+            std::string ClassName = Wrapper.GetObjectClassName();
+
+            // Look for FortPlayerController or FortPlayerControllerAthena
+            if (ClassName.find("FortPlayerController") != std::string::npos &&
+                ClassName.find("_C") != std::string::npos)
             {
-                UObjectWrapper Wrapper(Obj);
-                std::string ClassName = Wrapper.GetObjectClassName();
-
-                // Look for FortPlayerController or FortPlayerControllerAthena
-                if (ClassName.find("FortPlayerController") != std::string::npos &&
-                    ClassName.find("_C") != std::string::npos)
-                {
-                    return Obj;
-                }
+                Found = Wrapper.GetRaw();
+                return false;
             }
-        }
+            return true;
+        });
 
-        return nullptr;
+        return Found;
     }
 
     void* FEngineCore::GetWorld() const
@@ -415,6 +485,44 @@ namespace USS
         return World;
     }
 
+    void* FEngineCore::GetObjectWorld(void* Object) const
+    {
+        if (!Object || !m_pObjectArray)
+            return nullptr;
+
+        void* WorldClass = m_WorldClass.load(std::memory_order_acquire);
+        if (!WorldClass)
+        {
+            // UWorld may not be loaded yet - search again only once new
+            // objects have appeared, not on every call. Racing threads at
+            // worst both search and store the same class
+            const int32 Num = m_pObjectArray->Num();
+            if (m_WorldClassSearchNum.exchange(Num, std::memory_order_relaxed) == Num)
+                return nullptr;
+
+            WorldClass = FindClass("World").GetRaw();
+            if (!WorldClass)
+                return nullptr;
+
+            m_WorldClass.store(WorldClass, std::memory_order_release);
+        }
+
+        // Actors sit at Actor -> Level -> World; components and subobjects
+        // add a level or two. Cap the walk in case of a corrupt outer chain.
+        constexpr int32 MaxDepth = 8;
+
+        UObjectWrapper Current(Object);
+        for (int32 Depth = 0; Depth < MaxDepth && Current.IsValid(); ++Depth)
+        {
+            if (GetObjectClass(Current.GetRaw()) == WorldClass)
+                return Current.GetRaw();
+
+            Current = Current.GetOuter();
+        }
+
+        return nullptr;
+    }
+
     std::string FEngineCore::GetObjectName(void* Object) const
     {
         if (!Object)
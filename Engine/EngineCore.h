@@ -14,6 +14,7 @@
 #include "CoreTypes/NamePool.h"
 #include "CoreTypes/OffsetResolver.h"
 #include "UObject/UObjectWrapper.h"
+#include <atomic>
 #include <string>
 
 namespace USS
@@ -25,6 +26,7 @@ namespace USS
         bool bOffsetsResolved;
         bool bObjectArrayInitialized;
         bool bNamePoolInitialized;
+        bool bWorldResolved;
         bool bHooksInitialized;
         bool bFullyInitialized;
 
@@ -33,6 +35,7 @@ namespace USS
             , bOffsetsResolved(false)
             , bObjectArrayInitialized(false)
             , bNamePoolInitialized(false)
+            , bWorldResolved(false)
             , bHooksInitialized(false)
             , bFullyInitialized(false)
         {}
@@ -51,6 +54,13 @@ namespace USS
         // Initialize engine core (all subsystems)
         EResult Initialize();
 
+        /**
+         * Adopt readers built outside the startup path, e.g. over a mock
+         * engine image in a tool. Skips memory, pattern scanning and hooks;
+         * version and offsets are whatever the resolvers currently hold.
+         */
+        EResult InitializeWithTables(std::unique_ptr<IObjectArray> ObjectArray, std::unique_ptr<INamePool> NamePool);
+
         // Shutdown engine core
         void Shutdown();
 
@@ -74,6 +84,7 @@ namespace USS
         // Player/World utilities
         void* FindLocalPlayerController() const;
         void* GetWorld() const;
+        void* GetObjectWorld(void* Object) const;  // Walks the outer chain to the owning UWorld
 
         // Object name utilities
         std::string GetObjectName(void* Object) const;
@@ -84,34 +95,39 @@ namespace USS
         // Offset resolver access
         IOffsetResolver& GetOffsetResolver() const;
 
-        // Object iteration
+        // Object iteration - the loop is instantiated per array layout, so
+        // reading each element is not a virtual call
         template<typename Callback>
         void ForEachObject(Callback&& Func) const
         {
             if (!m_pObjectArray)
                 return;
 
-            int32 Num = m_pObjectArray->Num();
-            for (int32 i = 0; i < Num; ++i)
+            VisitObjectArray(*m_pObjectArray, [&Func](const auto& Array)
             {
-                void* Obj = m_pObjectArray->GetByIndex(i);
-                if (Obj)
+                int32 Num = Array.Num();
+                for (int32 i = 0; i < Num; ++i)
                 {
-                    if (!Func(UObjectWrapper(Obj)))
-                        break;  // Callback returned false, stop iteration
+                    void* Obj = Array.GetByIndex(i);
+                    if (Obj)
+                    {
+                        if (!Func(UObjectWrapper(Obj)))
+                            break;  // Callback returned false, stop iteration
+                    }
                 }
-            }
+            });
         }
 
     private:
         FEngineCore();
         ~FEngineCore();
 
-        // Initialization steps
+        // Initialization steps, run as a dependency graph by Initialize()
         EResult InitializeVersion();
         EResult InitializeOffsets();
         EResult InitializeObjectArray();
         EResult InitializeNamePool();
+        EResult InitializeWorld();
         EResult InitializeHooks();
 
         // Find addresses via patterns
@@ -127,6 +143,11 @@ namespace USS
         uintptr m_GObjectsAddress;
         uintptr m_GNamesAddress;
         uintptr m_GWorldAddress;
+
+        // UWorld class, resolved by GetObjectWorld() from any thread.
+        // Only a hit is cached; a miss is retried once GObjects has grown
+        mutable std::atomic<void*> m_WorldClass;
+        mutable std::atomic<int32> m_WorldClassSearchNum;
     };
 
     // Convenience function
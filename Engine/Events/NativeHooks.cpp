@@ -0,0 +1,184 @@
+/**
+ * UniversalSlashingSimulator - Native Hooks Implementation
+ */
+
+#include "NativeHooks.h"
+#include "../../Core/Hooks/HookRegistry.h"
+#include "../../Core/Logging/Log.h"
+#include "../../Core/Memory/Memory.h"
+#include "../CoreTypes/OffsetResolver.h"
+#include "../EngineCore.h"
+
+namespace USS
+{
+    int32 FNativeHooks::s_FrameCodeOffset = 0x20;
+    int32 FNativeHooks::s_FrameLocalsOffset = 0x28;
+
+    FNativeHooks& FNativeHooks::Get()
+    {
+        static FNativeHooks Instance;
+        return Instance;
+    }
+
+    void* FNativeHooks::FindFunction(const char* FunctionPath) const
+    {
+        if (!FunctionPath)
+            return nullptr;
+
+        void* Function = GetEngineCore().FindObject(FunctionPath).GetRaw();
+        if (!Function)
+            USS_ERROR("Native hook target not found: %s", FunctionPath);
+
+        return Function;
+    }
+
+    EResult FNativeHooks::Install(const char* Name, void* Function, size_t ParamsSize,
+        FNativeFuncPtr Thunk, FNativeFuncPtr* OutOriginal)
+    {
+        if (!Name || !Function || !Thunk || !OutOriginal)
+            return EResult::InvalidParameter;
+
+        const FOffsetTable& Offsets = GetOffsetResolver().GetOffsets();
+        if (Offsets.UFunction.Func == 0 || Offsets.UFunction.FunctionFlags == 0 || Offsets.UFunction.ParmsSize == 0)
+        {
+            USS_ERROR("Native hook %s: UFunction offsets not resolved for this version", Name);
+            return EResult::NotSupported;
+        }
+
+        UFunctionWrapper Wrapper(Function);
+
+        if ((Wrapper.GetFunctionFlags() & FUNC_Native) == 0)
+        {
+            USS_ERROR("Native hook %s: not a native function", Name);
+            return EResult::InvalidParameter;
+        }
+
+        // A smaller struct is fine (trailing params unused), a larger one reads past the block
+        if (ParamsSize > Wrapper.GetParmsSize())
+        {
+            USS_ERROR("Native hook %s: params struct is %zu bytes, function takes %u",
+                Name, ParamsSize, static_cast<uint32>(Wrapper.GetParmsSize()));
+            return EResult::InvalidParameter;
+        }
+
+        FScopedLock Lock(m_CriticalSection);
+
+        for (const FNativeHookEntry& Entry : m_Entries)
+        {
+            if (Entry.Function == Function)
+            {
+                USS_ERROR("Native hook %s: %s already hooks this function", Name, Entry.Name.c_str());
+                return EResult::AlreadyInitialized;
+            }
+        }
+
+        FNativeFuncPtr Original = reinterpret_cast<FNativeFuncPtr>(Wrapper.GetNativeFunc());
+        if (!Original)
+        {
+            USS_ERROR("Native hook %s: function has no native thunk", Name);
+            return EResult::InvalidState;
+        }
+
+        // The thunk keeps one original; binding it to a second function would lose the first
+        if (*OutOriginal && *OutOriginal != Original)
+        {
+            USS_ERROR("Native hook %s: handler is already bound to another function", Name);
+            return EResult::InvalidState;
+        }
+
+        s_FrameCodeOffset = Offsets.Frame.Code;
+        s_FrameLocalsOffset = Offsets.Frame.Locals;
+
+        // Original must be in place before the first call can reach the thunk
+        *OutOriginal = Original;
+
+        uintptr FuncField = reinterpret_cast<uintptr>(Function) + Offsets.UFunction.Func;
+        if (!Memory::Write<FNativeFuncPtr>(FuncField, Thunk))
+        {
+            USS_ERROR("Native hook %s: failed to write Func at 0x%llX", Name, FuncField);
+            return EResult::HookFailed;
+        }
+
+        FNativeHookEntry Entry;
+        Entry.Name = Name;
+        Entry.Function = Function;
+        Entry.Original = Original;
+        Entry.Thunk = Thunk;
+        m_Entries.push_back(std::move(Entry));
+
+        USS_LOG("Native hook %s installed (Func %p -> %p)", Name,
+            reinterpret_cast<void*>(Original), reinterpret_cast<void*>(Thunk));
+        return EResult::Success;
+    }
+
+    EResult FNativeHooks::RegisterVirtual(const char* Name, void* Object, int32 Index, void* Detour, void** OutOriginal)
+    {
+        if (!Name || !Object || Index < 0 || !Detour)
+            return EResult::InvalidParameter;
+
+        const FOffsetTable& Offsets = GetOffsetResolver().GetOffsets();
+
+        uintptr Vtable = 0;
+        if (!Memory::Read<uintptr>(reinterpret_cast<uintptr>(Object) + Offsets.UObject.Vtable, Vtable) || !Vtable)
+        {
+            USS_ERROR("Virtual hook %s: object %p has no vtable", Name, Object);
+            return EResult::InvalidState;
+        }
+
+        uintptr Target = 0;
+        if (!Memory::Read<uintptr>(Vtable + Index * sizeof(void*), Target) || !Target)
+        {
+            USS_ERROR("Virtual hook %s: vtable slot %d unreadable", Name, Index);
+            return EResult::InvalidState;
+        }
+
+        return GetHookRegistry().RegisterRaw(Name, reinterpret_cast<void*>(Target), Detour, OutOriginal);
+    }
+
+    void FNativeHooks::UnhookAll()
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        if (m_Entries.empty())
+            return;
+
+        const int32 FuncOffset = GetOffsetResolver().GetOffsets().UFunction.Func;
+
+        // Thunks keep their original, so a call already inside one still completes
+        for (const FNativeHookEntry& Entry : m_Entries)
+        {
+            uintptr FuncField = reinterpret_cast<uintptr>(Entry.Function) + FuncOffset;
+            if (!Memory::Write<FNativeFuncPtr>(FuncField, Entry.Original))
+                USS_ERROR("Native hook %s: failed to restore Func", Entry.Name.c_str());
+        }
+
+        USS_LOG("Removed %zu native hooks", m_Entries.size());
+        m_Entries.clear();
+    }
+
+    bool FNativeHooks::IsHooked(void* Function) const
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        for (const FNativeHookEntry& Entry : m_Entries)
+        {
+            if (Entry.Function == Function)
+                return true;
+        }
+
+        return false;
+    }
+
+    int32 FNativeHooks::GetCount() const
+    {
+        FScopedLock Lock(m_CriticalSection);
+        return static_cast<int32>(m_Entries.size());
+    }
+
+    std::vector<FNativeHookEntry> FNativeHooks::GetEntries() const
+    {
+        FScopedLock Lock(m_CriticalSection);
+        return m_Entries;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,190 @@
+/**
+ * UniversalSlashingSimulator - Native Hooks
+ *
+ * Typed hooks on individual UFunctions, below ProcessEvent. Instead of
+ * parsing every ProcessEvent call by name, a hot event gets its own
+ * detour on the function's exec thunk and arrives in a C++ handler with
+ * its parameter struct already laid out.
+ *
+ * Two ways in:
+ * - HookFunction() swaps UFunction::Func for a generated thunk. It is a
+ *   single pointer write on the UFunction, so no code is patched and no
+ *   threads are suspended, and only that one UFunction is affected even
+ *   when several share the same exec thunk.
+ * - HookVirtual() detours a vtable slot through the hook registry, for
+ *   engine virtuals that never go through a UFunction. It goes live on
+ *   the next GetHookRegistry().InstallPending() batch.
+ *
+ * Handlers only see calls made through ProcessEvent, where the frame's
+ * Locals is the finished parameter block. Calls from Blueprint bytecode
+ * still have their arguments on the script stream and go straight to
+ * the original.
+ *
+ * With USS_PROFILE each thunk counts its calls and cycles under the hook
+ * name (FProfiler::GetCounterSummaries).
+ *
+ * Install before ProcessEvent traffic starts: FSTWGameMode drops hooked
+ * functions from its generic path, but decides that on first sighting.
+ *
+ * Example:
+ *
+ *   struct FOnDamagedParms { float Damage; ... };   // Per-version layout
+ *
+ *   bool OnDamaged(void* Object, FOnDamagedParms& Parms) { ...; return true; }
+ *
+ *   GetNativeHooks().HookFunction<FOnDamagedParms, &OnDamaged>(
+ *       "Function FortniteGame.FortPawn.OnDamageServer");
+ */
+
+#pragma once
+
+#include "../../Core/Common.h"
+#include "../../Core/Diagnostics/Profiler.h"
+#include <string>
+#include <vector>
+
+namespace USS
+{
+    /**
+     * UFunction::Func signature. Pre-4.20 builds store a UObject member
+     * function pointer instead, which has the same x64 calling convention.
+     */
+    using FNativeFuncPtr = void(*)(void* Context, void* Stack, void* Result);
+
+    // EFunctionFlags::FUNC_Native
+    constexpr uint32 FUNC_Native = 0x00000400;
+
+    struct FNativeHookEntry
+    {
+        std::string Name;
+        void* Function = nullptr;           // UFunction*
+        FNativeFuncPtr Original = nullptr;
+        FNativeFuncPtr Thunk = nullptr;
+    };
+
+    class FNativeHooks
+    {
+    public:
+        USS_NON_COPYABLE(FNativeHooks)
+        USS_NON_MOVABLE(FNativeHooks)
+
+        static FNativeHooks& Get();
+
+        /**
+         * Route a native UFunction into a typed handler
+         * @param TParams - Parameter struct matching the function's ParmsSize layout
+         * @param Handler - Runs before the original; return false to skip it
+         *                  (only for functions without a return value)
+         * @param FunctionPath - Full name, e.g. "Function Engine.Actor.ReceiveTick"
+         */
+        template<typename TParams, bool(*Handler)(void* Object, TParams& Params)>
+        EResult HookFunction(const char* FunctionPath);
+
+        template<typename TParams, bool(*Handler)(void* Object, TParams& Params)>
+        EResult HookFunction(const char* Name, void* Function);
+
+        /**
+         * Detour vtable[Index] of Object's class through the hook registry
+         * Goes live on the next GetHookRegistry().InstallPending()
+         */
+        template<typename T>
+        EResult HookVirtual(const char* Name, void* Object, int32 Index, T Detour, T* OutOriginal)
+        {
+            return RegisterVirtual(Name, Object, Index, reinterpret_cast<void*>(Detour),
+                reinterpret_cast<void**>(OutOriginal));
+        }
+
+        // Puts every swapped Func pointer back
+        void UnhookAll();
+
+        // True if Function's Func pointer is ours - ProcessEvent routing can drop it
+        bool IsHooked(void* Function) const;
+
+        int32 GetCount() const;
+        std::vector<FNativeHookEntry> GetEntries() const;
+
+        // Frame accessors for thunks; offsets are cached by Install
+        static void* GetFrameCode(void* Stack)
+        {
+            return *reinterpret_cast<void**>(static_cast<uint8*>(Stack) + s_FrameCodeOffset);
+        }
+
+        static void* GetFrameLocals(void* Stack)
+        {
+            return *reinterpret_cast<void**>(static_cast<uint8*>(Stack) + s_FrameLocalsOffset);
+        }
+
+    private:
+        FNativeHooks() = default;
+        ~FNativeHooks() = default;
+
+        /**
+         * Per (TParams, Handler) detour. The original is per instantiation,
+         * so one handler can only be bound to one UFunction.
+         */
+        template<typename TParams, bool(*Handler)(void* Object, TParams& Params)>
+        struct TNativeThunk
+        {
+            static inline FNativeFuncPtr s_Original = nullptr;
+            static inline uint16 s_CounterId = FProfiler::InvalidCounter;
+
+            static void Call(void* Context, void* Stack, void* Result)
+            {
+#ifdef USS_PROFILE
+                FScopedHookCounter Counter(s_CounterId);
+#endif
+
+                // Script callers leave Code pointing at their own bytecode
+                if (!GetFrameCode(Stack))
+                {
+                    TParams* Params = static_cast<TParams*>(GetFrameLocals(Stack));
+                    if (Params && !Handler(Context, *Params))
+                        return;
+                }
+
+                s_Original(Context, Stack, Result);
+            }
+        };
+
+        void* FindFunction(const char* FunctionPath) const;
+
+        EResult Install(const char* Name, void* Function, size_t ParamsSize,
+            FNativeFuncPtr Thunk, FNativeFuncPtr* OutOriginal);
+
+        EResult RegisterVirtual(const char* Name, void* Object, int32 Index, void* Detour, void** OutOriginal);
+
+        mutable FCriticalSection m_CriticalSection;
+        std::vector<FNativeHookEntry> m_Entries;
+
+        static int32 s_FrameCodeOffset;
+        static int32 s_FrameLocalsOffset;
+    };
+
+    inline FNativeHooks& GetNativeHooks()
+    {
+        return FNativeHooks::Get();
+    }
+
+    //=========================================================================
+    // Template Implementations
+    //=========================================================================
+
+    template<typename TParams, bool(*Handler)(void* Object, TParams& Params)>
+    EResult FNativeHooks::HookFunction(const char* FunctionPath)
+    {
+        return HookFunction<TParams, Handler>(FunctionPath, FindFunction(FunctionPath));
+    }
+
+    template<typename TParams, bool(*Handler)(void* Object, TParams& Params)>
+    EResult FNativeHooks::HookFunction(const char* Name, void* Function)
+    {
+        using FThunk = TNativeThunk<TParams, Handler>;
+
+        EResult Result = Install(Name, Function, sizeof(TParams), &FThunk::Call, &FThunk::s_Original);
+        if (Result == EResult::Success)
+            FThunk::s_CounterId = FProfiler::RegisterCounter(Name);
+
+        return Result;
+    }
+
+}
\ No newline at end of file
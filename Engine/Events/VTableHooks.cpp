@@ -0,0 +1,257 @@
+/**
+ * UniversalSlashingSimulator - VTable Hooks Implementation
+ */
+
+#include "VTableHooks.h"
+#include "../../Core/Logging/Log.h"
+#include "../../Core/Memory/Memory.h"
+#include "../EngineCore.h"
+
+namespace USS
+{
+    namespace
+    {
+        // Header slots ahead of the clone's first entry
+        constexpr int32 CloneHeaderSlots = 2;
+
+        // Largest vtable we'll copy; actor classes sit in the low hundreds
+        constexpr int32 MaxVTableSlots = 1024;
+    }
+
+    int32 FVTableHooks::s_ProcessEventIndex = 0;
+    ProcessEventFn FVTableHooks::s_Detour = nullptr;
+
+    FVTableHooks& FVTableHooks::Get()
+    {
+        static FVTableHooks Instance;
+        return Instance;
+    }
+
+    EResult FVTableHooks::Initialize(int32 ProcessEventIndex, ProcessEventFn Detour)
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        if (s_Detour)
+            return EResult::AlreadyInitialized;
+
+        if (ProcessEventIndex <= 0 || ProcessEventIndex >= MaxVTableSlots || !Detour)
+            return EResult::InvalidParameter;
+
+        s_ProcessEventIndex = ProcessEventIndex;
+        s_Detour = Detour;
+
+        USS_LOG("VTable hooks initialized (ProcessEvent slot %d)", ProcessEventIndex);
+        return EResult::Success;
+    }
+
+    void FVTableHooks::Shutdown()
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        if (!s_Detour)
+            return;
+
+        int32 Restored = 0;
+
+        for (const auto& Pair : m_Attached)
+        {
+            void** Clone = Pair.second;
+
+            // Only objects still on our clone - anything else was destroyed
+            // or reused since, and its vptr is no longer ours to touch
+            if (!IsOnClone(Pair.first, Clone))
+                continue;
+
+            if (Memory::Write<void**>(reinterpret_cast<uintptr>(Pair.first), static_cast<void**>(Clone[-2])))
+                ++Restored;
+        }
+
+        USS_LOG("VTable hooks shut down (%d/%zu objects restored, %zu clones)",
+            Restored, m_Attached.size(), m_Clones.size());
+
+        m_Attached.clear();
+
+        // Clones stay allocated, see header; later Initialize builds new ones
+        m_Clones.clear();
+        s_Detour = nullptr;
+    }
+
+    EResult FVTableHooks::Attach(void* Object)
+    {
+        if (!Object)
+            return EResult::InvalidParameter;
+
+        FScopedLock Lock(m_CriticalSection);
+
+        if (!s_Detour)
+            return EResult::NotInitialized;
+
+        void** Current = nullptr;
+        if (!Memory::Read<void**>(reinterpret_cast<uintptr>(Object), Current) || !Current)
+            return EResult::InvalidState;
+
+        auto It = m_Attached.find(Object);
+        if (It != m_Attached.end())
+        {
+            if (Current == It->second)
+                return EResult::Success;
+
+            // Address reused by a new object since we last saw it
+            m_Attached.erase(It);
+        }
+
+        // Already on one of our clones, e.g. a copy of an attached object
+        if (Current[s_ProcessEventIndex] == reinterpret_cast<void*>(s_Detour))
+        {
+            m_Attached.emplace(Object, Current);
+            return EResult::Success;
+        }
+
+        void** Clone = GetOrCreateClone(Current);
+        if (!Clone)
+            return EResult::Failed;
+
+        // One aligned pointer store - a concurrent virtual call sees either table
+        *static_cast<void***>(Object) = Clone;
+        m_Attached.emplace(Object, Clone);
+
+        return EResult::Success;
+    }
+
+    int32 FVTableHooks::AttachClass(const char* ClassName)
+    {
+        if (!IsInitialized() || !ClassName)
+            return 0;
+
+        UClassWrapper Class = GetEngineCore().FindClass(ClassName);
+        if (!Class.IsValid())
+        {
+            USS_WARN("VTable hooks: class %s not found", ClassName);
+            return 0;
+        }
+
+        int32 Attached = 0;
+
+        GetEngineCore().ForEachObject([&](UObjectWrapper Object) -> bool
+        {
+            if (Object.IsA(Class) && Attach(Object.GetRaw()) == EResult::Success)
+                ++Attached;
+            return true;
+        });
+
+        USS_LOG("VTable hooks: attached %d %s objects", Attached, ClassName);
+        return Attached;
+    }
+
+    void FVTableHooks::Detach(void* Object)
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        auto It = m_Attached.find(Object);
+        if (It == m_Attached.end())
+            return;
+
+        void** Clone = It->second;
+        m_Attached.erase(It);
+
+        if (IsOnClone(Object, Clone))
+            *static_cast<void***>(Object) = static_cast<void**>(Clone[-2]);
+    }
+
+    int32 FVTableHooks::PruneDetached()
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        int32 Pruned = 0;
+
+        for (auto It = m_Attached.begin(); It != m_Attached.end();)
+        {
+            if (IsOnClone(It->first, It->second))
+            {
+                ++It;
+                continue;
+            }
+
+            It = m_Attached.erase(It);
+            ++Pruned;
+        }
+
+        return Pruned;
+    }
+
+    bool FVTableHooks::IsOnClone(void* Object, void** Clone)
+    {
+        void** Current = nullptr;
+        return Memory::Read<void**>(reinterpret_cast<uintptr>(Object), Current) && Current == Clone;
+    }
+
+    bool FVTableHooks::IsAttached(void* Object) const
+    {
+        FScopedLock Lock(m_CriticalSection);
+        return m_Attached.find(Object) != m_Attached.end();
+    }
+
+    int32 FVTableHooks::GetAttachedCount() const
+    {
+        FScopedLock Lock(m_CriticalSection);
+        return static_cast<int32>(m_Attached.size());
+    }
+
+    int32 FVTableHooks::GetCloneCount() const
+    {
+        FScopedLock Lock(m_CriticalSection);
+        return static_cast<int32>(m_Clones.size());
+    }
+
+    void** FVTableHooks::GetOrCreateClone(void** NativeVTable)
+    {
+        auto It = m_Clones.find(NativeVTable);
+        if (It != m_Clones.end())
+            return It->second;
+
+        int32 NumSlots = CountSlots(NativeVTable);
+        if (NumSlots <= s_ProcessEventIndex)
+        {
+            USS_ERROR("VTable hooks: vtable %p has %d slots, ProcessEvent is %d",
+                NativeVTable, NumSlots, s_ProcessEventIndex);
+            return nullptr;
+        }
+
+        void** Block = new void*[CloneHeaderSlots + NumSlots];
+        void** Clone = Block + CloneHeaderSlots;
+
+        Clone[-2] = NativeVTable;
+        Clone[-1] = NativeVTable[-1];   // RTTI complete object locator, for dynamic_cast/typeid
+        memcpy(Clone, NativeVTable, NumSlots * sizeof(void*));
+        Clone[s_ProcessEventIndex] = reinterpret_cast<void*>(s_Detour);
+
+        m_Clones.emplace(NativeVTable, Clone);
+
+        USS_LOG("VTable hooks: cloned vtable %p (%d slots)", NativeVTable, NumSlots);
+        return Clone;
+    }
+
+    int32 FVTableHooks::CountSlots(void** NativeVTable) const
+    {
+        const FModuleInfo& Module = Memory::GetBaseModule();
+        const uintptr Begin = Module.BaseAddress;
+        const uintptr End = Module.BaseAddress + Module.Size;
+
+        int32 NumSlots = 0;
+        while (NumSlots < MaxVTableSlots)
+        {
+            uintptr Entry = 0;
+            if (!Memory::Read<uintptr>(reinterpret_cast<uintptr>(NativeVTable + NumSlots), Entry))
+                break;
+
+            // The next vtable's RTTI pointer also lands in the module, but not in code
+            if (Entry < Begin || Entry >= End || !Memory::IsExecutableAddress(Entry))
+                break;
+
+            ++NumSlots;
+        }
+
+        return NumSlots;
+    }
+
+}
\ No newline at end of file
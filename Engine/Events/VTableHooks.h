@@ -0,0 +1,116 @@
+/**
+ * UniversalSlashingSimulator - VTable Hooks
+ *
+ * Per-object ProcessEvent interception. Instead of detouring the one
+ * UObject::ProcessEvent every object shares, the native vtable of each
+ * class we care about is cloned once with our detour in the ProcessEvent
+ * slot, and only the objects we attach are pointed at the clone. Every
+ * other object in the process keeps calling the native ProcessEvent and
+ * never enters our code.
+ *
+ * Clone layout (slots are void*):
+ *
+ *   [0] native vtable   [1] RTTI locator   [2...] native slots, ours at ProcessEventIndex
+ *                                           ^ object vptr
+ *
+ * so the detour finds the native ProcessEvent through the object's own
+ * vptr with no lookup or lock. Objects have to be attached explicitly:
+ * new objects are constructed with the native vtable.
+ *
+ * Clones are never freed - a call may still be running through one after
+ * its object is detached - which costs a few KB per intercepted class.
+ */
+
+#pragma once
+
+#include "../../Core/Common.h"
+#include "../../Core/Hooks/HookTypes.h"
+#include <unordered_map>
+#include <vector>
+
+namespace USS
+{
+    class FVTableHooks
+    {
+    public:
+        USS_NON_COPYABLE(FVTableHooks)
+        USS_NON_MOVABLE(FVTableHooks)
+
+        static FVTableHooks& Get();
+
+        /**
+         * @param ProcessEventIndex - vtable slot, as from PatternScanner::FindProcessEvent
+         * @param Detour - Shared by every clone; calls GetOriginal(Object) to continue
+         */
+        EResult Initialize(int32 ProcessEventIndex, ProcessEventFn Detour);
+
+        // Moves every still-attached object back to its native vtable
+        void Shutdown();
+
+        bool IsInitialized() const { return s_Detour != nullptr; }
+
+        // Point Object at the clone of its native vtable, cloning on first use
+        EResult Attach(void* Object);
+
+        // Attach every live object that is or derives from ClassName
+        int32 AttachClass(const char* ClassName);
+
+        void Detach(void* Object);
+        bool IsAttached(void* Object) const;
+
+        /**
+         * Forget objects that are no longer on our clone - destroyed, or
+         * their address reused by an object with the native vtable
+         * @return Records dropped
+         */
+        int32 PruneDetached();
+
+        int32 GetAttachedCount() const;
+        int32 GetCloneCount() const;
+
+        /**
+         * Native ProcessEvent for Object, for the detour to forward to.
+         * Also correct for an object detached while the call was in flight.
+         */
+        static ProcessEventFn GetOriginal(void* Object)
+        {
+            void** VTable = *static_cast<void***>(Object);
+            void* Slot = VTable[s_ProcessEventIndex];
+
+            if (Slot == reinterpret_cast<void*>(s_Detour))
+                Slot = static_cast<void**>(VTable[-2])[s_ProcessEventIndex];
+
+            return reinterpret_cast<ProcessEventFn>(Slot);
+        }
+
+    private:
+        FVTableHooks() = default;
+        ~FVTableHooks() = default;
+
+        // Clone for a native vtable, built on first request
+        void** GetOrCreateClone(void** NativeVTable);
+
+        // Slots up to the first entry that isn't game module code
+        int32 CountSlots(void** NativeVTable) const;
+
+        // Object's vptr is still Clone (and the memory still readable)
+        static bool IsOnClone(void* Object, void** Clone);
+
+        mutable FCriticalSection m_CriticalSection;
+
+        // Native vtable -> clone
+        std::unordered_map<void**, void**> m_Clones;
+
+        // Object -> clone it was pointed at
+        std::unordered_map<void*, void**> m_Attached;
+
+        static int32 s_ProcessEventIndex;
+        static ProcessEventFn s_Detour;
+    };
+
+    inline FVTableHooks& GetVTableHooks()
+    {
+        return FVTableHooks::Get();
+    }
+
+}
\ No newline at end of file
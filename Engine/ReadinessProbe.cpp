@@ -0,0 +1,135 @@
+/**
+ * UniversalSlashingSimulator - Readiness Probe Implementation
+ */
+
+#include "ReadinessProbe.h"
+#include "EngineCore.h"
+#include "../Core/Logging/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace USS
+{
+    FReadinessProbe::FReadinessProbe(const FReadinessConfig& Config)
+        : m_Config(Config)
+        , m_ClassFound(Config.RequiredClasses.size(), false)
+    {
+    }
+
+    bool FReadinessProbe::Poll()
+    {
+        FEngineCore& Core = GetEngineCore();
+        IObjectArray* Objects = Core.GetObjectArray();
+
+        ++m_Status.Polls;
+
+        // GObjects grows in bursts while packages load; a count that holds
+        // across polls means the loading has at least paused
+        if (!Objects || !Objects->Refresh())
+        {
+            m_Status.UnchangedPolls = 0;
+            m_Status.bObjectsStable = false;
+            return false;
+        }
+
+        const int32 Count = Objects->Num();
+        if (Count > 0 && Count == m_Status.ObjectCount)
+            ++m_Status.UnchangedPolls;
+        else
+            m_Status.UnchangedPolls = 0;
+
+        m_Status.ObjectCount = Count;
+        m_Status.bObjectsStable = m_Status.UnchangedPolls >= m_Config.StablePolls;
+
+        // Without a GWorld pattern there's nothing to check
+        m_Status.bWorldReady = !m_Config.bRequireWorld
+            || !Core.GetStatus().bWorldResolved
+            || Core.GetWorld() != nullptr;
+
+        if (!m_Status.bObjectsStable || !m_Status.bWorldReady)
+            return false;
+
+        FindRequiredClasses();
+
+        m_Status.bReady = m_Status.ClassesFound == static_cast<int32>(m_ClassFound.size());
+        return m_Status.bReady;
+    }
+
+    void FReadinessProbe::FindRequiredClasses()
+    {
+        if (m_Status.ClassesFound == static_cast<int32>(m_ClassFound.size()))
+            return;
+
+        FEngineCore& Core = GetEngineCore();
+
+        // Names allocated since startup would otherwise fail to resolve
+        if (INamePool* Names = Core.GetNamePool())
+            Names->Refresh();
+
+        Core.ForEachObject([this](UObjectWrapper Object) -> bool
+        {
+            // Decode the name once per object; only a match pays for IsA
+            std::string Name = Object.GetName();
+
+            for (size_t i = 0; i < m_ClassFound.size(); ++i)
+            {
+                if (m_ClassFound[i] || Name != m_Config.RequiredClasses[i])
+                    continue;
+
+                if (Object.IsA("Class"))
+                {
+                    m_ClassFound[i] = true;
+                    ++m_Status.ClassesFound;
+                }
+            }
+
+            return m_Status.ClassesFound < static_cast<int32>(m_ClassFound.size());
+        });
+    }
+
+    EResult FReadinessProbe::Wait()
+    {
+        using FClock = std::chrono::steady_clock;
+
+        if (!GetEngineCore().IsInitialized())
+            return EResult::NotInitialized;
+
+        if (m_Config.bRequireWorld && !GetEngineCore().GetStatus().bWorldResolved)
+            USS_WARN("GWorld address unknown, readiness won't wait for a world");
+
+        const FClock::time_point Start = FClock::now();
+        int32 IntervalMs = std::max(m_Config.InitialIntervalMs, 1);
+
+        for (;;)
+        {
+            const bool bReady = Poll();
+            const int64 ElapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(FClock::now() - Start).count();
+
+            if (bReady)
+            {
+                USS_LOG("Game ready after %lld ms (%d polls, %d objects)",
+                    static_cast<long long>(ElapsedMs), m_Status.Polls, m_Status.ObjectCount);
+                return EResult::Success;
+            }
+
+            if (ElapsedMs >= m_Config.TimeoutMs)
+            {
+                USS_WARN("Game not ready after %lld ms: objects %d (%s), world %s, classes %d/%zu",
+                    static_cast<long long>(ElapsedMs),
+                    m_Status.ObjectCount,
+                    m_Status.bObjectsStable ? "stable" : "changing",
+                    m_Status.bWorldReady ? "ready" : "missing",
+                    m_Status.ClassesFound,
+                    m_ClassFound.size());
+                return EResult::Timeout;
+            }
+
+            const int64 SleepMs = std::min<int64>(IntervalMs, m_Config.TimeoutMs - ElapsedMs);
+            std::this_thread::sleep_for(std::chrono::milliseconds(SleepMs));
+
+            IntervalMs = std::min(IntervalMs * 2, std::max(m_Config.MaxIntervalMs, 1));
+        }
+    }
+
+}
\ No newline at end of file
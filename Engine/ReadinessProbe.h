@@ -0,0 +1,95 @@
+/**
+ * UniversalSlashingSimulator - Readiness Probe
+ *
+ * Decides when the game has finished booting far enough for the STW
+ * systems to attach, instead of sleeping for a fixed time. Each poll
+ * checks, cheapest first:
+ * - The GObjects count has stopped changing between polls
+ * - GWorld is non-null (skipped if its pattern wasn't found)
+ * - Every required class is loaded
+ *
+ * The class check is a full object walk, so it only runs once the cheap
+ * signals pass. Polls back off exponentially up to a cap.
+ *
+ * Requires an initialized engine core.
+ */
+
+#pragma once
+
+#include "../Core/Common.h"
+#include <string>
+#include <vector>
+
+namespace USS
+{
+    struct FReadinessConfig
+    {
+        int32 TimeoutMs;
+        int32 InitialIntervalMs;
+        int32 MaxIntervalMs;        // Backoff doubles the interval up to this
+        int32 StablePolls;          // Polls in a row with an unchanged object count
+        bool bRequireWorld;
+        std::vector<std::string> RequiredClasses;
+
+        FReadinessConfig()
+            : TimeoutMs(60000)
+            , InitialIntervalMs(50)
+            , MaxIntervalMs(1000)
+            , StablePolls(2)
+            , bRequireWorld(true)
+        {}
+    };
+
+    struct FReadinessStatus
+    {
+        int32 Polls;
+        int32 ObjectCount;
+        int32 UnchangedPolls;
+        bool bObjectsStable;
+        bool bWorldReady;
+        int32 ClassesFound;
+        bool bReady;
+
+        FReadinessStatus()
+            : Polls(0)
+            , ObjectCount(0)
+            , UnchangedPolls(0)
+            , bObjectsStable(false)
+            , bWorldReady(false)
+            , ClassesFound(0)
+            , bReady(false)
+        {}
+    };
+
+    class FReadinessProbe
+    {
+    public:
+        explicit FReadinessProbe(const FReadinessConfig& Config);
+
+        /**
+         * Check every signal once
+         * @return True once all of them pass
+         */
+        bool Poll();
+
+        /**
+         * Poll with backoff until ready or Config.TimeoutMs passes
+         * @return Success, Timeout, or NotInitialized without an engine core
+         */
+        EResult Wait();
+
+        const FReadinessStatus& GetStatus() const { return m_Status; }
+
+    private:
+        // One walk over GObjects for every class not seen yet
+        void FindRequiredClasses();
+
+        FReadinessConfig m_Config;
+        FReadinessStatus m_Status;
+
+        // Parallel to m_Config.RequiredClasses - classes never unload, so
+        // a class found once isn't searched for again
+        std::vector<bool> m_ClassFound;
+    };
+
+}
\ No newline at end of file
@@ -52,6 +52,8 @@ namespace USS
         , m_UProperty_PropertyFlagsOffset(0)
         , m_UProperty_OffsetOffset(0)
         , m_UProperty_NextOffset(0)
+        , m_UBoolProperty_ByteOffsetOffset(0)
+        , m_UBoolProperty_FieldMaskOffset(0)
         , m_bInitialized(false)
     {
     }
@@ -77,16 +79,20 @@ namespace USS
         m_UProperty_ElementSizeOffset = Offsets.GetOffset("UProperty", "ElementSize");
         m_UProperty_PropertyFlagsOffset = Offsets.GetOffset("UProperty", "PropertyFlags");
         m_UProperty_OffsetOffset = Offsets.GetOffset("UProperty", "Offset_Internal");
-
-        // Use defaults if not resolved
-        if (m_ChildrenOffset == 0) m_ChildrenOffset = 0x48;      // Typical for UE4.19
-        if (m_PropertyLinkOffset == 0) m_PropertyLinkOffset = 0x50;
-        if (m_SuperStructOffset == 0) m_SuperStructOffset = 0x40;
-        if (m_UProperty_NextOffset == 0) m_UProperty_NextOffset = 0x30;
-        if (m_UProperty_ArrayDimOffset == 0) m_UProperty_ArrayDimOffset = 0x38;
-        if (m_UProperty_ElementSizeOffset == 0) m_UProperty_ElementSizeOffset = 0x3C;
-        if (m_UProperty_PropertyFlagsOffset == 0) m_UProperty_PropertyFlagsOffset = 0x40;
-        if (m_UProperty_OffsetOffset == 0) m_UProperty_OffsetOffset = 0x4C;
+        m_UBoolProperty_ByteOffsetOffset = Offsets.GetOffset("UProperty", "ByteOffset");
+        m_UBoolProperty_FieldMaskOffset = Offsets.GetOffset("UProperty", "FieldMask");
+
+        // Use defaults if not resolved (resolver returns -1 before it has run)
+        if (m_ChildrenOffset <= 0) m_ChildrenOffset = 0x48;      // Typical for UE4.19
+        if (m_PropertyLinkOffset <= 0) m_PropertyLinkOffset = 0x50;
+        if (m_SuperStructOffset <= 0) m_SuperStructOffset = 0x40;
+        if (m_UProperty_NextOffset <= 0) m_UProperty_NextOffset = 0x30;
+        if (m_UProperty_ArrayDimOffset <= 0) m_UProperty_ArrayDimOffset = 0x38;
+        if (m_UProperty_ElementSizeOffset <= 0) m_UProperty_ElementSizeOffset = 0x3C;
+        if (m_UProperty_PropertyFlagsOffset <= 0) m_UProperty_PropertyFlagsOffset = 0x40;
+        if (m_UProperty_OffsetOffset <= 0) m_UProperty_OffsetOffset = 0x4C;
+        if (m_UBoolProperty_ByteOffsetOffset <= 0) m_UBoolProperty_ByteOffsetOffset = 0x71;
+        if (m_UBoolProperty_FieldMaskOffset <= 0) m_UBoolProperty_FieldMaskOffset = 0x73;
 
         USS_LOG("UProperty iterator offsets:");
         USS_LOG("  UStruct::Children = 0x%X", m_ChildrenOffset);
@@ -221,6 +227,12 @@ namespace USS
         Memory::Read<uint64>(PropAddr + m_UProperty_PropertyFlagsOffset, OutInfo.PropertyFlags);
         Memory::Read<int32>(PropAddr + m_UProperty_OffsetOffset, OutInfo.Offset);
 
+        if (OutInfo.Type == EPropertyType::BoolProperty)
+        {
+            Memory::Read<uint8>(PropAddr + m_UBoolProperty_ByteOffsetOffset, OutInfo.BoolByteOffset);
+            Memory::Read<uint8>(PropAddr + m_UBoolProperty_FieldMaskOffset, OutInfo.BoolFieldMask);
+        }
+
         return true;
     }
 
@@ -309,6 +321,8 @@ namespace USS
         , m_FProperty_ElementSizeOffset(0)
         , m_FProperty_PropertyFlagsOffset(0)
         , m_FProperty_OffsetOffset(0)
+        , m_FBoolProperty_ByteOffsetOffset(0)
+        , m_FBoolProperty_FieldMaskOffset(0)
         , m_FFieldClass_NameOffset(0)
         , m_bInitialized(false)
     {
@@ -339,22 +353,26 @@ namespace USS
         m_FProperty_ElementSizeOffset = Offsets.GetOffset("FProperty", "ElementSize");
         m_FProperty_PropertyFlagsOffset = Offsets.GetOffset("FProperty", "PropertyFlags");
         m_FProperty_OffsetOffset = Offsets.GetOffset("FProperty", "Offset_Internal");
+        m_FBoolProperty_ByteOffsetOffset = Offsets.GetOffset("FProperty", "ByteOffset");
+        m_FBoolProperty_FieldMaskOffset = Offsets.GetOffset("FProperty", "FieldMask");
 
         // FFieldClass offset
         m_FFieldClass_NameOffset = Offsets.GetOffset("FFieldClass", "Name");
 
         // Use defaults if not resolved (typical for FN Chapter 2+)
-        if (m_ChildPropertiesOffset == 0) m_ChildPropertiesOffset = 0x50;
-        if (m_SuperStructOffset == 0) m_SuperStructOffset = 0x40;
-        if (m_FField_ClassOffset == 0) m_FField_ClassOffset = 0x00;
-        if (m_FField_OwnerOffset == 0) m_FField_OwnerOffset = 0x08;
-        if (m_FField_NextOffset == 0) m_FField_NextOffset = 0x20;
-        if (m_FField_NameOffset == 0) m_FField_NameOffset = 0x28;
-        if (m_FProperty_ArrayDimOffset == 0) m_FProperty_ArrayDimOffset = 0x38;
-        if (m_FProperty_ElementSizeOffset == 0) m_FProperty_ElementSizeOffset = 0x3C;
-        if (m_FProperty_PropertyFlagsOffset == 0) m_FProperty_PropertyFlagsOffset = 0x40;
-        if (m_FProperty_OffsetOffset == 0) m_FProperty_OffsetOffset = 0x4C;
-        if (m_FFieldClass_NameOffset == 0) m_FFieldClass_NameOffset = 0x00;
+        if (m_ChildPropertiesOffset <= 0) m_ChildPropertiesOffset = 0x50;
+        if (m_SuperStructOffset <= 0) m_SuperStructOffset = 0x40;
+        if (m_FField_ClassOffset <= 0) m_FField_ClassOffset = 0x00;
+        if (m_FField_OwnerOffset <= 0) m_FField_OwnerOffset = 0x08;
+        if (m_FField_NextOffset <= 0) m_FField_NextOffset = 0x20;
+        if (m_FField_NameOffset <= 0) m_FField_NameOffset = 0x28;
+        if (m_FProperty_ArrayDimOffset <= 0) m_FProperty_ArrayDimOffset = 0x38;
+        if (m_FProperty_ElementSizeOffset <= 0) m_FProperty_ElementSizeOffset = 0x3C;
+        if (m_FProperty_PropertyFlagsOffset <= 0) m_FProperty_PropertyFlagsOffset = 0x40;
+        if (m_FProperty_OffsetOffset <= 0) m_FProperty_OffsetOffset = 0x4C;
+        if (m_FBoolProperty_ByteOffsetOffset <= 0) m_FBoolProperty_ByteOffsetOffset = 0x79;
+        if (m_FBoolProperty_FieldMaskOffset <= 0) m_FBoolProperty_FieldMaskOffset = 0x7B;
+        if (m_FFieldClass_NameOffset <= 0) m_FFieldClass_NameOffset = 0x00;
 
         USS_LOG("FField property iterator offsets:");
         USS_LOG("  UStruct::ChildProperties = 0x%X", m_ChildPropertiesOffset);
@@ -498,6 +516,12 @@ namespace USS
         Memory::Read<int32>(FieldAddr + m_FProperty_OffsetOffset, RawOffset);
         OutInfo.Offset = RawOffset;
 
+        if (OutInfo.Type == EPropertyType::BoolProperty)
+        {
+            Memory::Read<uint8>(FieldAddr + m_FBoolProperty_ByteOffsetOffset, OutInfo.BoolByteOffset);
+            Memory::Read<uint8>(FieldAddr + m_FBoolProperty_FieldMaskOffset, OutInfo.BoolFieldMask);
+        }
+
         return true;
     }
 
@@ -102,6 +102,11 @@ namespace USS
         // For object properties
         void* PropertyClass;            // UClass* for object references
 
+        // For bool properties - bitfield bools share a byte at Offset +
+        // BoolByteOffset, a native bool has a FieldMask of 0xFF
+        uint8 BoolByteOffset;
+        uint8 BoolFieldMask;
+
         FPropertyInfo()
             : Type(EPropertyType::Unknown)
             , Offset(0)
@@ -113,6 +118,8 @@ namespace USS
             , InnerStruct(nullptr)
             , InnerProperty(nullptr)
             , PropertyClass(nullptr)
+            , BoolByteOffset(0)
+            , BoolFieldMask(0xFF)
         {}
 
         bool IsValid() const { return PropertyPtr != nullptr; }
@@ -256,8 +263,11 @@ namespace USS
      * - PropertyFlags : uint64
      * - Offset_Internal : int32
      * - ...
+     *
+     * UBoolProperty appends FieldSize, ByteOffset, ByteMask and FieldMask,
+     * one byte each.
      */
-    class FUPropertyIterator : public IPropertyIterator
+    class FUPropertyIterator final : public IPropertyIterator
     {
     public:
         FUPropertyIterator();
@@ -290,6 +300,10 @@ namespace USS
         int32 m_UProperty_OffsetOffset;
         int32 m_UProperty_NextOffset;   // UField::Next
 
+        // Offsets within UBoolProperty
+        int32 m_UBoolProperty_ByteOffsetOffset;
+        int32 m_UBoolProperty_FieldMaskOffset;
+
         bool m_bInitialized;
     };
 
@@ -317,8 +331,10 @@ namespace USS
      * - PropertyFlags : EPropertyFlags
      * - Offset_Internal : uint16 (changed from int32!)
      * - ...
+     *
+     * FBoolProperty appends the same four bytes as UBoolProperty.
      */
-    class FFFieldPropertyIterator : public IPropertyIterator
+    class FFFieldPropertyIterator final : public IPropertyIterator
     {
     public:
         FFFieldPropertyIterator();
@@ -355,6 +371,10 @@ namespace USS
         int32 m_FProperty_PropertyFlagsOffset;
         int32 m_FProperty_OffsetOffset;
 
+        // Offsets within FBoolProperty
+        int32 m_FBoolProperty_ByteOffsetOffset;
+        int32 m_FBoolProperty_FieldMaskOffset;
+
         // FFieldClass contains class name
         int32 m_FFieldClass_NameOffset;
 
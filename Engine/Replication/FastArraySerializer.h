@@ -179,7 +179,7 @@ namespace USS
      *     int32 ReplicationKey;
      *     int32 MostRecentArrayReplicationKey;
      */
-    class FLegacyFastArraySerializer : public IFastArraySerializer
+    class FLegacyFastArraySerializer final : public IFastArraySerializer
     {
     public:
         FLegacyFastArraySerializer();
@@ -239,7 +239,7 @@ namespace USS
      *         int32 ReplicationKey;
      *         int32 MostRecentArrayReplicationKey;
      */
-    class FNewFastArraySerializer : public IFastArraySerializer
+    class FNewFastArraySerializer final : public IFastArraySerializer
     {
     public:
         FNewFastArraySerializer();
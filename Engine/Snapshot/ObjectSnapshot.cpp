@@ -0,0 +1,398 @@
+/**
+ * UniversalSlashingSimulator - Object Snapshot Implementation
+ */
+
+#include "ObjectSnapshot.h"
+#include "../EngineCore.h"
+#include "../Reflection/PropertyIterator.h"
+#include "../../Core/Logging/Log.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+namespace USS
+{
+    namespace
+    {
+        uint64 AlignSection(uint64 Offset)
+        {
+            return (Offset + 7) & ~static_cast<uint64>(7);
+        }
+
+        // NUL-terminated strings, each stored once
+        class FStringTable
+        {
+        public:
+            uint32 Add(const std::string& Value)
+            {
+                auto It = m_Offsets.find(Value);
+                if (It != m_Offsets.end())
+                    return It->second;
+
+                const uint32 Offset = static_cast<uint32>(m_Data.size());
+                m_Data.append(Value.c_str(), Value.size() + 1);
+                m_Offsets.emplace(Value, Offset);
+                return Offset;
+            }
+
+            const std::string& GetData() const { return m_Data; }
+
+        private:
+            std::string m_Data;
+            std::unordered_map<std::string, uint32> m_Offsets;
+        };
+
+        bool IsSectionInBounds(uint64 Offset, int32 Count, size_t RecordSize, size_t FileSize)
+        {
+            if (Count < 0 || Offset % 8 != 0 || Offset > FileSize)
+                return false;
+
+            return static_cast<uint64>(Count) * RecordSize <= FileSize - Offset;
+        }
+
+        bool IsIndexOrNone(int32 Index, int32 Num)
+        {
+            return Index >= -1 && Index < Num;
+        }
+    }
+
+    FObjectSnapshot::FObjectSnapshot()
+        : m_Size(0)
+    {
+    }
+
+    //=========================================================================
+    // Capture
+    //=========================================================================
+
+    EResult FObjectSnapshot::Capture()
+    {
+        FEngineCore& Core = GetEngineCore();
+        const IObjectArray* Array = Core.GetObjectArray();
+
+        if (!Array || !Array->IsInitialized() || !Core.GetNamePool())
+            return EResult::NotInitialized;
+
+        IPropertyIterator& PropertyIterator = GetPropertyIterator();
+        if (!PropertyIterator.IsInitialized() && PropertyIterator.Initialize() != EResult::Success)
+            return EResult::NotInitialized;
+
+        const bool bUseFField = Core.GetVersionInfo().bUseFField;
+        const int32 NumObjects = Array->Num();
+
+        std::vector<FSnapshotObject> Objects(NumObjects);
+        std::vector<FSnapshotName> Names;
+        std::vector<FSnapshotStruct> Structs;
+        std::vector<FSnapshotProperty> Properties;
+        FStringTable Strings;
+
+        std::unordered_map<int32, int32> NameRecords;
+        std::unordered_map<void*, bool> StructClasses;
+
+        // Only trust an index that leads back to the same object
+        auto IndexOf = [Array](void* Object) -> int32
+        {
+            if (!Object)
+                return -1;
+
+            const int32 Index = UObjectWrapper(Object).GetInternalIndex();
+            return Array->GetByIndex(Index) == Object ? Index : -1;
+        };
+
+        auto AddName = [&](int32 ComparisonIndex) -> int32
+        {
+            auto It = NameRecords.find(ComparisonIndex);
+            if (It != NameRecords.end())
+                return It->second;
+
+            FSnapshotName Record;
+            Record.ComparisonIndex = ComparisonIndex;
+            Record.String = Strings.Add(Core.GetNameFromIndex(ComparisonIndex));
+
+            const int32 RecordIndex = static_cast<int32>(Names.size());
+            Names.push_back(Record);
+            NameRecords.emplace(ComparisonIndex, RecordIndex);
+            return RecordIndex;
+        };
+
+        // A class whose super chain reaches Struct, cached per class
+        auto IsStructClass = [&StructClasses](void* Class) -> bool
+        {
+            auto It = StructClasses.find(Class);
+            if (It != StructClasses.end())
+                return It->second;
+
+            bool bIsStruct = false;
+            UClassWrapper Current(Class);
+
+            // Bounded in case a torn chain loops
+            for (int32 Depth = 0; Current.IsValid() && Depth < 64; ++Depth)
+            {
+                if (Current.GetName() == "Struct")
+                {
+                    bIsStruct = true;
+                    break;
+                }
+
+                Current = Current.GetSuperClass();
+            }
+
+            StructClasses.emplace(Class, bIsStruct);
+            return bIsStruct;
+        };
+
+        for (int32 i = 0; i < NumObjects; ++i)
+        {
+            FSnapshotObject& Record = Objects[i];
+            Record.Address = 0;
+            Record.Class = -1;
+            Record.Outer = -1;
+            Record.Name = AddName(0);
+            Record.NameNumber = 0;
+            Record.ObjectFlags = 0;
+            Record.InternalFlags = 0;
+            Record.SerialNumber = 0;
+            Record.Struct = -1;
+
+            FObjectItem Item;
+            if (!Array->GetItemByIndex(i, Item) || !Item.Object)
+                continue;
+
+            UObjectWrapper Object(Item.Object);
+            if (!Object.IsValid())
+                continue;
+
+            const FNameWrapper Name = Object.GetFName();
+            void* Class = Object.GetClass().GetRaw();
+
+            Record.Address = reinterpret_cast<uintptr>(Item.Object);
+            Record.Class = IndexOf(Class);
+            Record.Outer = IndexOf(Object.GetOuter().GetRaw());
+            Record.Name = AddName(Name.GetComparisonIndex());
+            Record.NameNumber = Name.GetNumber();
+            Record.ObjectFlags = Object.GetObjectFlags();
+            Record.InternalFlags = Item.Flags;
+            Record.SerialNumber = Item.SerialNumber;
+
+            if (!Class || !IsStructClass(Class))
+                continue;
+
+            UStructWrapper Struct(Item.Object);
+
+            FSnapshotStruct StructRecord;
+            StructRecord.Object = i;
+            StructRecord.Super = IndexOf(Struct.GetSuperStruct().GetRaw());
+            StructRecord.PropertiesSize = Struct.GetPropertiesSize();
+            StructRecord.FirstProperty = static_cast<int32>(Properties.size());
+
+            PropertyIterator.ForEachProperty(Item.Object, [&](const FPropertyInfo& Info)
+            {
+                FSnapshotProperty Property;
+                Property.Name = Strings.Add(Info.Name);
+                Property.ClassName = Strings.Add(Info.ClassName);
+                Property.Offset = Info.Offset;
+                Property.ElementSize = Info.ElementSize;
+                Property.ArrayDim = Info.ArrayDim;
+                Property.Object = bUseFField ? -1 : IndexOf(Info.PropertyPtr);
+                Property.PropertyFlags = Info.PropertyFlags;
+
+                Properties.push_back(Property);
+                return true;
+            }, false);
+
+            StructRecord.NumProperties = static_cast<int32>(Properties.size()) - StructRecord.FirstProperty;
+
+            Record.Struct = static_cast<int32>(Structs.size());
+            Structs.push_back(StructRecord);
+        }
+
+        // Lay the sections out behind the header
+        FObjectSnapshotHeader Header;
+        memset(&Header, 0, sizeof(Header));
+        memcpy(Header.Magic, ObjectSnapshotMagic, sizeof(Header.Magic));
+        Header.FormatVersion = ObjectSnapshotFormatVersion;
+        Header.FortniteCL = Core.GetVersionInfo().FortniteCL;
+        Header.NumObjects = NumObjects;
+        Header.NumNames = static_cast<int32>(Names.size());
+        Header.NumStructs = static_cast<int32>(Structs.size());
+        Header.NumProperties = static_cast<int32>(Properties.size());
+        Header.StringsSize = static_cast<uint32>(Strings.GetData().size());
+
+        uint64 Offset = AlignSection(sizeof(Header));
+        Header.ObjectsOffset = Offset;
+        Offset = AlignSection(Offset + Objects.size() * sizeof(FSnapshotObject));
+        Header.NamesOffset = Offset;
+        Offset = AlignSection(Offset + Names.size() * sizeof(FSnapshotName));
+        Header.StructsOffset = Offset;
+        Offset = AlignSection(Offset + Structs.size() * sizeof(FSnapshotStruct));
+        Header.PropertiesOffset = Offset;
+        Offset = AlignSection(Offset + Properties.size() * sizeof(FSnapshotProperty));
+        Header.StringsOffset = Offset;
+        Offset += Header.StringsSize;
+
+        m_Size = static_cast<size_t>(Offset);
+        m_Data.assign((m_Size + 7) / 8, 0);
+
+        uint8* Data = reinterpret_cast<uint8*>(m_Data.data());
+        memcpy(Data, &Header, sizeof(Header));
+
+        if (!Objects.empty())
+            memcpy(Data + Header.ObjectsOffset, Objects.data(), Objects.size() * sizeof(FSnapshotObject));
+        if (!Names.empty())
+            memcpy(Data + Header.NamesOffset, Names.data(), Names.size() * sizeof(FSnapshotName));
+        if (!Structs.empty())
+            memcpy(Data + Header.StructsOffset, Structs.data(), Structs.size() * sizeof(FSnapshotStruct));
+        if (!Properties.empty())
+            memcpy(Data + Header.PropertiesOffset, Properties.data(), Properties.size() * sizeof(FSnapshotProperty));
+        if (Header.StringsSize > 0)
+            memcpy(Data + Header.StringsOffset, Strings.GetData().data(), Header.StringsSize);
+
+        USS_LOG("Captured object snapshot: %d objects, %d names, %d structs, %d properties (%zu KB)",
+            Header.NumObjects, Header.NumNames, Header.NumStructs, Header.NumProperties, m_Size / 1024);
+
+        return EResult::Success;
+    }
+
+    //=========================================================================
+    // File I/O
+    //=========================================================================
+
+    EResult FObjectSnapshot::Save(const char* FilePath) const
+    {
+        if (!FilePath)
+            return EResult::InvalidParameter;
+
+        if (!IsValid())
+            return EResult::InvalidState;
+
+        FILE* File = fopen(FilePath, "wb");
+        if (!File)
+            return EResult::Failed;
+
+        const bool bWritten = fwrite(m_Data.data(), 1, m_Size, File) == m_Size;
+        fclose(File);
+
+        if (!bWritten)
+            return EResult::Failed;
+
+        USS_LOG("Saved object snapshot to %s", FilePath);
+        return EResult::Success;
+    }
+
+    EResult FObjectSnapshot::Load(const char* FilePath)
+    {
+        if (!FilePath)
+            return EResult::InvalidParameter;
+
+        m_Data.clear();
+        m_Size = 0;
+
+        FILE* File = fopen(FilePath, "rb");
+        if (!File)
+            return EResult::Failed;
+
+        fseek(File, 0, SEEK_END);
+        const long FileSize = ftell(File);
+        fseek(File, 0, SEEK_SET);
+
+        if (FileSize < static_cast<long>(sizeof(FObjectSnapshotHeader)))
+        {
+            fclose(File);
+            USS_ERROR("%s is too small to be an object snapshot", FilePath);
+            return EResult::Failed;
+        }
+
+        m_Size = static_cast<size_t>(FileSize);
+        m_Data.assign((m_Size + 7) / 8, 0);
+
+        const bool bRead = fread(m_Data.data(), 1, m_Size, File) == m_Size;
+        fclose(File);
+
+        EResult Result = bRead ? Validate() : EResult::Failed;
+        if (Result != EResult::Success)
+        {
+            USS_ERROR("%s is not a usable object snapshot: %s", FilePath, ResultToString(Result));
+            m_Data.clear();
+            m_Size = 0;
+            return Result;
+        }
+
+        [[maybe_unused]] const FObjectSnapshotHeader& Header = GetHeader();
+        USS_LOG("Loaded object snapshot %s: CL %u, %d objects, %d structs",
+            FilePath, Header.FortniteCL, Header.NumObjects, Header.NumStructs);
+
+        return EResult::Success;
+    }
+
+    EResult FObjectSnapshot::Validate() const
+    {
+        const FObjectSnapshotHeader& Header = GetHeader();
+
+        if (memcmp(Header.Magic, ObjectSnapshotMagic, sizeof(Header.Magic)) != 0)
+            return EResult::Failed;
+
+        if (Header.FormatVersion != ObjectSnapshotFormatVersion)
+            return EResult::InvalidVersion;
+
+        // Every section inside the file, strings NUL-terminated at the end
+        if (!IsSectionInBounds(Header.ObjectsOffset, Header.NumObjects, sizeof(FSnapshotObject), m_Size)
+            || !IsSectionInBounds(Header.NamesOffset, Header.NumNames, sizeof(FSnapshotName), m_Size)
+            || !IsSectionInBounds(Header.StructsOffset, Header.NumStructs, sizeof(FSnapshotStruct), m_Size)
+            || !IsSectionInBounds(Header.PropertiesOffset, Header.NumProperties, sizeof(FSnapshotProperty), m_Size)
+            || Header.StringsOffset > m_Size
+            || Header.StringsSize > m_Size - Header.StringsOffset
+            || (Header.StringsSize > 0 && GetString(Header.StringsSize - 1)[0] != '\0'))
+        {
+            return EResult::Failed;
+        }
+
+        // Then every reference, so readers can index without checking
+        for (int32 i = 0; i < Header.NumObjects; ++i)
+        {
+            const FSnapshotObject& Object = GetObjectRecord(i);
+
+            if (!IsIndexOrNone(Object.Class, Header.NumObjects)
+                || !IsIndexOrNone(Object.Outer, Header.NumObjects)
+                || Object.Name < 0 || Object.Name >= Header.NumNames
+                || !IsIndexOrNone(Object.Struct, Header.NumStructs))
+            {
+                return EResult::Failed;
+            }
+        }
+
+        for (int32 i = 0; i < Header.NumNames; ++i)
+        {
+            if (GetNameRecord(i).String >= Header.StringsSize)
+                return EResult::Failed;
+        }
+
+        for (int32 i = 0; i < Header.NumStructs; ++i)
+        {
+            const FSnapshotStruct& Struct = GetStructRecord(i);
+
+            if (Struct.Object < 0 || Struct.Object >= Header.NumObjects
+                || !IsIndexOrNone(Struct.Super, Header.NumObjects)
+                || Struct.FirstProperty < 0 || Struct.NumProperties < 0
+                || Struct.FirstProperty > Header.NumProperties - Struct.NumProperties)
+            {
+                return EResult::Failed;
+            }
+        }
+
+        for (int32 i = 0; i < Header.NumProperties; ++i)
+        {
+            const FSnapshotProperty& Property = GetPropertyRecord(i);
+
+            if (Property.Name >= Header.StringsSize
+                || Property.ClassName >= Header.StringsSize
+                || !IsIndexOrNone(Property.Object, Header.NumObjects))
+            {
+                return EResult::Failed;
+            }
+        }
+
+        return EResult::Success;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,150 @@
+/**
+ * UniversalSlashingSimulator - Object Snapshot
+ *
+ * Captures GObjects, the names its objects use and the layout of every
+ * struct in it into one flat file, so lookup and layout problems can be
+ * looked at away from a live game. FMockEngineImage replays a snapshot
+ * through the real IObjectArray/INamePool readers on any platform.
+ *
+ * The file is the in-memory form byte for byte: a header, then arrays of
+ * fixed-size records in 8-byte aligned sections. Everything is addressed
+ * by index or by offset from the start of the file, never by pointer, so
+ * a mapped file can be read in place. Objects keep their GObjects index;
+ * the original addresses are only kept to match up with logs and dumps.
+ */
+
+#pragma once
+
+#include "../../Core/Common.h"
+#include <vector>
+
+namespace USS
+{
+    constexpr char ObjectSnapshotMagic[4] = { 'U', 'S', 'S', 'O' };
+    constexpr uint32 ObjectSnapshotFormatVersion = 1;
+
+    struct FObjectSnapshotHeader
+    {
+        char Magic[4];
+        uint32 FormatVersion;
+        uint32 FortniteCL;          // Layout the snapshot was taken with
+        int32 NumObjects;
+        int32 NumNames;
+        int32 NumStructs;
+        int32 NumProperties;
+        uint32 StringsSize;
+
+        // Section offsets from the start of the file
+        uint64 ObjectsOffset;
+        uint64 NamesOffset;
+        uint64 StructsOffset;
+        uint64 PropertiesOffset;
+        uint64 StringsOffset;
+    };
+
+    // One GObjects slot; Address is 0 for a free slot
+    struct FSnapshotObject
+    {
+        uint64 Address;
+        int32 Class;                // Object index, -1 for none
+        int32 Outer;                // Object index, -1 for none
+        int32 Name;                 // Name record index
+        int32 NameNumber;
+        int32 ObjectFlags;
+        int32 InternalFlags;        // FUObjectItem flags (EInternalObjectFlags)
+        int32 SerialNumber;
+        int32 Struct;               // Struct record index, -1 if not a UStruct
+    };
+
+    // A comparison index and its string
+    struct FSnapshotName
+    {
+        int32 ComparisonIndex;
+        uint32 String;              // Offset into the string section
+    };
+
+    struct FSnapshotStruct
+    {
+        int32 Object;               // Object index
+        int32 Super;                // Object index, -1 for none
+        int32 PropertiesSize;
+        int32 FirstProperty;        // Own properties, in declaration order
+        int32 NumProperties;
+    };
+
+    struct FSnapshotProperty
+    {
+        uint32 Name;                // Offset into the string section
+        uint32 ClassName;           // e.g. "IntProperty"
+        int32 Offset;
+        int32 ElementSize;
+        int32 ArrayDim;
+        int32 Object;               // Object index of a UProperty, -1 for an FProperty
+        uint64 PropertyFlags;
+    };
+
+    static_assert(sizeof(FObjectSnapshotHeader) == 72, "Snapshot header layout changed");
+    static_assert(sizeof(FSnapshotObject) == 40, "Snapshot object layout changed");
+    static_assert(sizeof(FSnapshotName) == 8, "Snapshot name layout changed");
+    static_assert(sizeof(FSnapshotStruct) == 20, "Snapshot struct layout changed");
+    static_assert(sizeof(FSnapshotProperty) == 32, "Snapshot property layout changed");
+
+    class FObjectSnapshot
+    {
+    public:
+        FObjectSnapshot();
+
+        USS_NON_COPYABLE(FObjectSnapshot)
+
+        /**
+         * Snapshot the engine core's object array, names and struct
+         * layouts, replacing whatever this holds. Reads the live array
+         * without stopping the game, so objects created meanwhile may or
+         * may not make it in.
+         */
+        EResult Capture();
+
+        EResult Save(const char* FilePath) const;
+
+        // Read and check a file written by Save
+        EResult Load(const char* FilePath);
+
+        bool IsValid() const { return !m_Data.empty(); }
+
+        // Valid until the next Capture or Load
+        const void* GetData() const { return m_Data.data(); }
+        size_t GetSize() const { return m_Size; }
+
+        // Record access - indices are not range checked, Load already
+        // checked every index stored in the file
+        const FObjectSnapshotHeader& GetHeader() const { return *Section<FObjectSnapshotHeader>(0); }
+        const FSnapshotObject& GetObjectRecord(int32 Index) const { return Section<FSnapshotObject>(GetHeader().ObjectsOffset)[Index]; }
+        const FSnapshotName& GetNameRecord(int32 Index) const { return Section<FSnapshotName>(GetHeader().NamesOffset)[Index]; }
+        const FSnapshotStruct& GetStructRecord(int32 Index) const { return Section<FSnapshotStruct>(GetHeader().StructsOffset)[Index]; }
+        const FSnapshotProperty& GetPropertyRecord(int32 Index) const { return Section<FSnapshotProperty>(GetHeader().PropertiesOffset)[Index]; }
+
+        const char* GetString(uint32 Offset) const
+        {
+            return reinterpret_cast<const char*>(m_Data.data()) + GetHeader().StringsOffset + Offset;
+        }
+
+        const char* GetObjectName(int32 Index) const
+        {
+            return GetString(GetNameRecord(GetObjectRecord(Index).Name).String);
+        }
+
+    private:
+        template<typename T>
+        const T* Section(uint64 Offset) const
+        {
+            return reinterpret_cast<const T*>(reinterpret_cast<const uint8*>(m_Data.data()) + Offset);
+        }
+
+        EResult Validate() const;
+
+        // uint64 storage keeps every section 8-byte aligned
+        std::vector<uint64> m_Data;
+        size_t m_Size;
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,292 @@
+/**
+ * UniversalSlashingSimulator - Object Path Cache Implementation
+ */
+
+#include "ObjectPathCache.h"
+#include "UObjectWrapper.h"
+#include "../EngineCore.h"
+#include <algorithm>
+#include <cstring>
+
+namespace USS
+{
+    namespace
+    {
+        constexpr size_t ArenaBlockSize = 256 * 1024;
+
+        // Longer than any real outer chain; stops a corrupt cycle
+        constexpr int32 MaxOuterDepth = 256;
+    }
+
+    FObjectPathCache& FObjectPathCache::Get()
+    {
+        static FObjectPathCache Instance;
+        return Instance;
+    }
+
+    FObjectPathCache::FObjectPathCache()
+        : m_NumEntries(0)
+        , m_BlockUsed(0)
+        , m_BlockSize(0)
+        , m_ArenaSize(0)
+    {
+    }
+
+    std::string_view FObjectPathCache::GetPathName(int32 Index)
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        const FEntry* Entry = Resolve(Index);
+        return Entry ? std::string_view(Entry->Path, Entry->PathLength) : std::string_view();
+    }
+
+    std::string_view FObjectPathCache::GetFullName(int32 Index)
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        const FEntry* Entry = Resolve(Index);
+        if (!Entry)
+            return std::string_view();
+
+        if (!Entry->Full)
+        {
+            void* Class = UObjectWrapper(Entry->Object).GetClass().GetRaw();
+
+            // The class's own name is the tail of its cached path. Resolving
+            // it can grow m_Entries, so entries are looked up again after.
+            const int32 ClassIndex = Class ? IndexOf(Class) : -1;
+            const FEntry* ClassEntry = (ClassIndex >= 0) ? Resolve(ClassIndex) : nullptr;
+
+            std::string ClassName;
+            if (ClassEntry)
+                ClassName.assign(ClassEntry->Path + ClassEntry->NameOffset, ClassEntry->PathLength - ClassEntry->NameOffset);
+            else
+                ClassName = Class ? UObjectWrapper(Class).GetName() : "Unknown";
+
+            FEntry& Built = m_Entries[Index];
+            Built.Full = Store(ClassName, ' ', std::string_view(Built.Path, Built.PathLength));
+            Built.FullLength = static_cast<uint32>(ClassName.size()) + 1 + Built.PathLength;
+            Entry = &Built;
+        }
+
+        return std::string_view(Entry->Full, Entry->FullLength);
+    }
+
+    std::string_view FObjectPathCache::GetName(int32 Index)
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        const FEntry* Entry = Resolve(Index);
+        if (!Entry)
+            return std::string_view();
+
+        return std::string_view(Entry->Path + Entry->NameOffset, Entry->PathLength - Entry->NameOffset);
+    }
+
+    std::string_view FObjectPathCache::GetPathName(void* Object)
+    {
+        const int32 Index = IndexOf(Object);
+        return (Index >= 0) ? GetPathName(Index) : std::string_view();
+    }
+
+    std::string_view FObjectPathCache::GetFullName(void* Object)
+    {
+        const int32 Index = IndexOf(Object);
+        return (Index >= 0) ? GetFullName(Index) : std::string_view();
+    }
+
+    void FObjectPathCache::Clear()
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        m_Entries.clear();
+        m_Entries.shrink_to_fit();
+        m_Blocks.clear();
+        m_NumEntries = 0;
+        m_BlockUsed = 0;
+        m_BlockSize = 0;
+        m_ArenaSize = 0;
+    }
+
+    size_t FObjectPathCache::GetNumEntries() const
+    {
+        FScopedLock Lock(m_CriticalSection);
+        return m_NumEntries;
+    }
+
+    size_t FObjectPathCache::GetArenaSize() const
+    {
+        FScopedLock Lock(m_CriticalSection);
+        return m_ArenaSize;
+    }
+
+    FObjectPathCache::FEntry* FObjectPathCache::Find(int32 Index, const FObjectItem& Item)
+    {
+        if (Index >= static_cast<int32>(m_Entries.size()))
+            return nullptr;
+
+        FEntry& Entry = m_Entries[Index];
+        if (!Entry.Path || Entry.Object != Item.Object || Entry.SerialNumber != Item.SerialNumber)
+            return nullptr;
+
+        // Without a serial, pointer equality can't tell a new object at a
+        // reused address from the old one. The slot holds the object, so
+        // its header is live - read it directly, this runs on every hit
+        if (Entry.SerialNumber == 0)
+        {
+            const auto& Offsets = GetOffsetResolver().GetOffsets();
+            const uint8* Header = static_cast<const uint8*>(Item.Object);
+
+            int32 Name[2];
+            void* Outer;
+            memcpy(Name, Header + Offsets.UObject.Name, sizeof(Name));
+            memcpy(&Outer, Header + Offsets.UObject.Outer, sizeof(Outer));
+
+            if (FNameWrapper(Name[0], Name[1]) != Entry.Name || Outer != Entry.Outer)
+                return nullptr;
+        }
+
+        return &Entry;
+    }
+
+    FObjectPathCache::FEntry* FObjectPathCache::Resolve(int32 Index)
+    {
+        IObjectArray* Array = GetEngineCore().GetObjectArray();
+        if (!Array)
+            return nullptr;
+
+        FObjectItem Item;
+        if (!Array->GetItemByIndex(Index, Item) || !Item.Object)
+            return nullptr;
+
+        if (FEntry* Cached = Find(Index, Item))
+            return Cached;
+
+        // Walk up to the first outer that is already cached, or the top
+        // of the chain, then build paths back down from there
+        FObjectItem Chain[MaxOuterDepth];
+        void* ChainOuters[MaxOuterDepth];
+        int32 ChainIndices[MaxOuterDepth];
+        int32 Depth = 0;
+        int32 ParentIndex = -1;
+        int32 MaxIndex = Index;
+
+        int32 Current = Index;
+        while (true)
+        {
+            if (Depth == MaxOuterDepth)
+                return nullptr;
+
+            Chain[Depth] = Item;
+            ChainIndices[Depth] = Current;
+            ++Depth;
+
+            void* Outer = UObjectWrapper(Item.Object).GetOuter().GetRaw();
+            ChainOuters[Depth - 1] = Outer;
+            if (!Outer)
+                break;
+
+            Current = IndexOf(Outer);
+            if (Current < 0 || !Array->GetItemByIndex(Current, Item))
+                return nullptr;
+
+            MaxIndex = std::max(MaxIndex, Current);
+
+            if (Find(Current, Item))
+            {
+                ParentIndex = Current;
+                break;
+            }
+        }
+
+        if (MaxIndex >= static_cast<int32>(m_Entries.size()))
+        {
+            // Size to the array up front so a full walk grows this once
+            m_Entries.resize(std::max<size_t>(MaxIndex + 1, Array->Num()), FEntry());
+        }
+
+        for (int32 i = Depth - 1; i >= 0; --i)
+        {
+            const FNameWrapper FName = UObjectWrapper(Chain[i].Object).GetFName();
+            const std::string Name = FName.GetFullName();
+            FEntry& Entry = m_Entries[ChainIndices[i]];
+
+            if (!Entry.Path)
+                ++m_NumEntries;
+
+            if (ParentIndex >= 0)
+            {
+                const FEntry& Parent = m_Entries[ParentIndex];
+                Entry.Path = Store(std::string_view(Parent.Path, Parent.PathLength), '.', Name);
+                Entry.NameOffset = Parent.PathLength + 1;
+            }
+            else
+            {
+                Entry.Path = Store(std::string_view(), '\0', Name);
+                Entry.NameOffset = 0;
+            }
+
+            Entry.Object = Chain[i].Object;
+            Entry.Outer = ChainOuters[i];
+            Entry.Name = FName;
+            Entry.SerialNumber = Chain[i].SerialNumber;
+            Entry.PathLength = Entry.NameOffset + static_cast<uint32>(Name.size());
+            Entry.Full = nullptr;
+            Entry.FullLength = 0;
+
+            ParentIndex = ChainIndices[i];
+        }
+
+        return &m_Entries[Index];
+    }
+
+    int32 FObjectPathCache::IndexOf(void* Object) const
+    {
+        IObjectArray* Array = GetEngineCore().GetObjectArray();
+        if (!Array || !Object)
+            return -1;
+
+        const int32 Index = UObjectWrapper(Object).GetInternalIndex();
+
+        FObjectItem Item;
+        if (!Array->GetItemByIndex(Index, Item) || Item.Object != Object)
+            return -1;
+
+        return Index;
+    }
+
+    const char* FObjectPathCache::Store(std::string_view First, char Separator, std::string_view Second)
+    {
+        const size_t Length = First.size() + (Separator ? 1 : 0) + Second.size();
+        const size_t Size = Length + 1;
+
+        if (m_Blocks.empty() || m_BlockUsed + Size > m_BlockSize)
+        {
+            m_BlockSize = std::max(ArenaBlockSize, Size);
+            m_Blocks.push_back(std::make_unique<char[]>(m_BlockSize));
+            m_BlockUsed = 0;
+            m_ArenaSize += m_BlockSize;
+        }
+
+        char* Data = m_Blocks.back().get() + m_BlockUsed;
+        m_BlockUsed += Size;
+
+        char* Out = Data;
+        if (!First.empty())
+        {
+            memcpy(Out, First.data(), First.size());
+            Out += First.size();
+        }
+
+        if (Separator)
+            *Out++ = Separator;
+
+        if (!Second.empty())
+            memcpy(Out, Second.data(), Second.size());
+
+        Out[Second.size()] = '\0';
+
+        return Data;
+    }
+
+}
\ No newline at end of file
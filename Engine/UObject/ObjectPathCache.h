@@ -0,0 +1,105 @@
+/**
+ * UniversalSlashingSimulator - Object Path Cache
+ *
+ * Path and full names for objects in GObjects, built once per object and
+ * kept for the rest of the session. An object's path is its outer's
+ * cached path plus its own name, so every name in an outer chain is
+ * decoded once no matter how many objects live under it.
+ *
+ * Entries are keyed by GObjects index and checked against the slot's
+ * object pointer and serial number on every lookup, so a slot reused by
+ * a new object is rebuilt rather than served stale. Most objects never
+ * get a serial number, though (see WeakObjectHandle.h), and a new object
+ * allocated at the old address then looks identical. For entries built
+ * with serial 0 a hit also re-reads the object's FName and outer and
+ * rebuilds the entry if either changed.
+ *
+ * Strings live in an arena that only grows; the returned views stay
+ * valid until Clear(), which EngineCore calls on shutdown.
+ */
+
+#pragma once
+
+#include "../../Core/Common.h"
+#include "../CoreTypes/ObjectArray.h"
+#include "UObjectWrapper.h"
+#include <string_view>
+
+namespace USS
+{
+    class FObjectPathCache
+    {
+    public:
+        USS_NON_COPYABLE(FObjectPathCache)
+        USS_NON_MOVABLE(FObjectPathCache)
+
+        static FObjectPathCache& Get();
+
+        /**
+         * "Outer.Outer.Name" for the object at a GObjects index
+         * @return Empty if the slot is free or its outer chain can't be
+         *         resolved through the object array
+         */
+        std::string_view GetPathName(int32 Index);
+
+        // "ClassName Outer.Outer.Name", composed on first request
+        std::string_view GetFullName(int32 Index);
+
+        // The object's own name - the tail of its path
+        std::string_view GetName(int32 Index);
+
+        // Same, for an object pointer - one read for its InternalIndex
+        std::string_view GetPathName(void* Object);
+        std::string_view GetFullName(void* Object);
+
+        // Drop every entry and the arena; invalidates all returned views
+        void Clear();
+
+        size_t GetNumEntries() const;
+        size_t GetArenaSize() const;
+
+    private:
+        FObjectPathCache();
+        ~FObjectPathCache() = default;
+
+        struct FEntry
+        {
+            void* Object;
+            void* Outer;
+            FNameWrapper Name;      // Re-checked on a hit when SerialNumber is 0
+            int32 SerialNumber;
+            uint32 PathLength;
+            uint32 NameOffset;      // Own name, after the outer's path
+            uint32 FullLength;
+            const char* Path;       // Null until built
+            const char* Full;       // Null until first GetFullName
+        };
+
+        // Cached entry for Index, building it and any uncached outers
+        FEntry* Resolve(int32 Index);
+
+        // Entry for Index if it was built for the object now in the slot
+        FEntry* Find(int32 Index, const FObjectItem& Item);
+
+        // GObjects index of Object, checked against the array
+        int32 IndexOf(void* Object) const;
+
+        const char* Store(std::string_view First, char Separator, std::string_view Second);
+
+        mutable FCriticalSection m_CriticalSection;
+        std::vector<FEntry> m_Entries;
+        size_t m_NumEntries;
+
+        // Blocks are never reallocated, so views into them stay put
+        std::vector<std::unique_ptr<char[]>> m_Blocks;
+        size_t m_BlockUsed;
+        size_t m_BlockSize;
+        size_t m_ArenaSize;
+    };
+
+    inline FObjectPathCache& GetObjectPathCache()
+    {
+        return FObjectPathCache::Get();
+    }
+
+}
\ No newline at end of file
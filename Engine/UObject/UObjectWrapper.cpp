@@ -3,24 +3,19 @@
  */
 
 #include "UObjectWrapper.h"
+#include "ObjectPathCache.h"
 #include "../../Core/Memory/Memory.h"
 #include "../../Core/Versioning/VersionResolver.h"
 #include "../CoreTypes/OffsetResolver.h"
+#include "../EngineCore.h"
 #include <sstream>
 
 namespace USS
 {
-    // Static name pool instance (lazy initialized)
-    static std::unique_ptr<INamePool> g_pNamePool;
-
+    // The pool EngineCore found and initialized - null until then
     static INamePool* GetNamePoolInstance()
     {
-        if (!g_pNamePool)
-        {
-            g_pNamePool = CreateNamePool();
-            // Note: Initialization happens separately via EngineCore
-        }
-        return g_pNamePool.get();
+        return GetEngineCore().GetNamePool();
     }
 
     //=========================================================================
@@ -152,6 +147,10 @@ namespace USS
         if (!IsValid())
             return "";
 
+        std::string_view Cached = GetObjectPathCache().GetFullName(m_pObject);
+        if (!Cached.empty())
+            return std::string(Cached);
+
         UClassWrapper Class = GetClass();
         std::string ClassName = Class.IsValid() ? Class.GetName() : "Unknown";
 
@@ -163,6 +162,11 @@ namespace USS
         if (!IsValid())
             return "";
 
+        std::string_view Cached = GetObjectPathCache().GetPathName(m_pObject);
+        if (!Cached.empty())
+            return std::string(Cached);
+
+        // Not reachable through GObjects - walk the outer chain directly
         std::string Path;
         UObjectWrapper Current = GetOuter();
 
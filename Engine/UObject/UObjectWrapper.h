@@ -86,10 +86,11 @@ namespace USS
         // Get object name as string
         std::string GetName() const;
 
-        // Get full path name (Outer.Outer.Name)
+        // Get full name (ClassName Outer.Outer.Name)
         std::string GetFullName() const;
 
-        // Get path name (/Path/To/Object)
+        // Get path name (Outer.Outer.Name) - both are served from
+        // FObjectPathCache for objects in GObjects
         std::string GetPathName() const;
 
         // Get class name (name of the UClass)
@@ -0,0 +1,141 @@
+/**
+ * UniversalSlashingSimulator - Weak Object Handle
+ *
+ * A cached UObject reference that notices when the object is gone. The
+ * handle keeps the object's GObjects slot and serial number, the same
+ * pair FWeakObjectPtr uses, and checks them against the live slot on
+ * every use. That is one item copy and a compare - no VirtualQuery - and
+ * unlike an address check it is not fooled by a new object reusing the
+ * old one's memory. Objects spawned after the array was initialized
+ * resolve too: a slot past the cached count makes the array re-read the
+ * live one.
+ *
+ * The engine only gives an object a serial number once something takes
+ * a weak pointer to it, and USS never writes one itself. A handle taken
+ * while the serial is still 0 checks that the slot holds the same address
+ * and isn't pending kill or unreachable - and, because UE hands freed
+ * slots and memory back out LIFO, that the object there still has the
+ * FName and class it had when the handle was taken, as FObjectPathCache
+ * does for its serial-0 entries.
+ */
+
+#pragma once
+
+#include "UObjectWrapper.h"
+#include "../EngineCore.h"
+#include <cstring>
+
+namespace USS
+{
+    template<typename T = UObjectWrapper>
+    class TWeakObjectHandle
+    {
+    public:
+        TWeakObjectHandle()
+            : m_pObject(nullptr)
+            , m_Index(-1)
+            , m_SerialNumber(0)
+            , m_pClass(nullptr)
+        {
+        }
+
+        /**
+         * Resolve Object's slot now. Takes a null handle if the object is
+         * not in the engine core's object array.
+         */
+        explicit TWeakObjectHandle(void* Object)
+            : TWeakObjectHandle()
+        {
+            IObjectArray* Array = GetEngineCore().GetObjectArray();
+            if (!Object || !Array)
+                return;
+
+            const int32 Index = UObjectWrapper(Object).GetInternalIndex();
+
+            FObjectItem Item;
+            if (!Array->GetItemByIndex(Index, Item) || Item.Object != Object)
+                return;
+
+            m_pObject = Object;
+            m_Index = Index;
+            m_SerialNumber = Item.SerialNumber;
+
+            if (m_SerialNumber == 0)
+                ReadHeader(Object, m_Name, m_pClass);
+        }
+
+        explicit TWeakObjectHandle(const UObjectWrapper& Object)
+            : TWeakObjectHandle(Object.GetRaw())
+        {
+        }
+
+        // The object is still the one this handle was taken for
+        bool IsValid() const
+        {
+            if (m_Index < 0)
+                return false;
+
+            IObjectArray* Array = GetEngineCore().GetObjectArray();
+
+            FObjectItem Item;
+            if (!Array || !Array->GetItemByIndex(m_Index, Item))
+                return false;
+
+            if (Item.Object != m_pObject || Item.IsPendingKill() || Item.IsUnreachable())
+                return false;
+
+            if (m_SerialNumber != 0)
+                return Item.SerialNumber == m_SerialNumber;
+
+            // A new object at the old slot and address - only its header differs
+            FNameWrapper Name;
+            void* Class;
+            ReadHeader(m_pObject, Name, Class);
+            return Item.SerialNumber == 0 && Name == m_Name && Class == m_pClass;
+        }
+
+        explicit operator bool() const { return IsValid(); }
+
+        // Wrapped object, or an empty wrapper once it has gone away
+        T Get() const { return IsValid() ? T(m_pObject) : T(); }
+
+        // Pointer the handle was taken for, unchecked - for identity and
+        // for handing back to code that does its own checks
+        void* GetRaw() const { return m_pObject; }
+
+        int32 GetIndex() const { return m_Index; }
+        int32 GetSerialNumber() const { return m_SerialNumber; }
+
+        void Reset() { *this = TWeakObjectHandle(); }
+
+        bool operator==(const TWeakObjectHandle& Other) const
+        {
+            return m_pObject == Other.m_pObject && m_Index == Other.m_Index && m_SerialNumber == Other.m_SerialNumber;
+        }
+
+        bool operator!=(const TWeakObjectHandle& Other) const { return !(*this == Other); }
+
+    private:
+        // The slot holds the object, so its header is live - read it
+        // directly, this runs on every use
+        static void ReadHeader(const void* Object, FNameWrapper& OutName, void*& OutClass)
+        {
+            const auto& Offsets = GetOffsetResolver().GetOffsets();
+            const uint8* Header = static_cast<const uint8*>(Object);
+
+            int32 Name[2];
+            memcpy(Name, Header + Offsets.UObject.Name, sizeof(Name));
+            memcpy(&OutClass, Header + Offsets.UObject.Class, sizeof(OutClass));
+            OutName = FNameWrapper(Name[0], Name[1]);
+        }
+
+        void* m_pObject;
+        int32 m_Index;
+        int32 m_SerialNumber;
+
+        // Identity for serial-0 handles
+        FNameWrapper m_Name;
+        void* m_pClass;
+    };
+
+}
\ No newline at end of file
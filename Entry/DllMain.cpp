@@ -9,7 +9,8 @@
  * 3. Initialize logging
  * 4. Parse command-line arguments
  * 5. Initialize engine core
- * 6. Initialize STW systems (GameMode, Missions, Inventory, Building)
+ * 6. Wait for the game to load (ReadinessProbe)
+ * 7. Initialize STW systems (GameMode, Missions, Inventory, Building)
  *
  * Command-Line Arguments (USS-specific):
  * -USS_Mission=<MissionBlueprint>    Mission blueprint to load
@@ -21,17 +22,24 @@
  * -USS_NoInventory                   Disable inventory
  * -USS_NoBuilding                    Disable building
  * -USS_Debug                         Enable debug mode
+ * -USS_BinaryLog                     Write USS_Log.usslog (decode with USSLogDecoder)
+ * -USS_ReadyTimeout=<ms>             Max wait for the game to load (default 60000)
+ * -USS_DumpObjects=<Path>            Snapshot GObjects to Path once loaded (replay with USSBench -snapshot)
  */
 
 #include "../Core/Common.h"
 #include "../Core/Logging/Log.h"
 #include "../Core/Diagnostics/CrashHandler.h"
+#include "../Core/Threading/WorkerPool.h"
 #include "../Engine/EngineCore.h"
+#include "../Engine/ReadinessProbe.h"
+#include "../Engine/Snapshot/ObjectSnapshot.h"
 #include "../STW/GameMode/STWGameMode.h"
 #include "../STW/Missions/MissionManager.h"
 #include "../STW/Inventory/InventoryManager.h"
 #include "../STW/Building/BuildingManager.h"
 #include "../Core/Memory/PatternScanner.h"
+#include <chrono>
 #include <string>
 #include <sstream>
 
@@ -211,18 +219,21 @@ namespace USS
     DWORD WINAPI InitializationThread(LPVOID lpParam)
     {
         // Initialize logging first
-        EResult Result = Log::Initialize(true, "USS_Log.txt");
+        const bool bBinaryLog = HasCommandLineArg("-USS_BinaryLog");
+        EResult Result = bBinaryLog
+            ? Log::Initialize(true, "USS_Log.usslog", ELogFileFormat::Binary)
+            : Log::Initialize(true, "USS_Log.txt");
         if (Result != EResult::Success)
         {
             MessageBoxA(nullptr, "Failed to initialize logging", "USS Error", MB_ICONERROR);
             return 1;
         }
 
-        /*Result = FCrashHandler::Initialize();
+        Result = FCrashHandler::Initialize();
         if (Result != EResult::Success)
         {
             USS_WARN("Failed to initialize crash handler - crashes may not be logged");
-        }*/
+        }
 
         USS_LOG("========================================");
         USS_LOG("  UniversalSlashingSimulator v0.1.0");
@@ -230,10 +241,12 @@ namespace USS
         USS_LOG("========================================");
         USS_LOG("");
 
-        // Wait for game to be ready
-        // TODO: find trigger in log, perhaps we need a way to trick the game into going to the STW lobby in headless?
-        USS_LOG("Waiting for game initialization...");
-        Sleep(5000);  // Placeholder
+        // Worker threads for the engine core startup graph and the parallel
+        // player update
+        if (GetWorkerPool().Initialize() != EResult::Success)
+        {
+            USS_WARN("Worker pool unavailable, startup and player updates will run serially");
+        }
 
         USS_LOG("Initializing engine core...");
         Result = GetEngineCore().Initialize();
@@ -262,6 +275,31 @@ namespace USS
         USS_LOG("TObjectPtr:       %s", Version.bUseTObjectPtr ? "Yes" : "No");
         USS_LOG("");
 
+        // Engine core only needs the module image; STW attaches to live
+        // classes, so wait until the game has loaded them
+        // TODO: perhaps we need a way to trick the game into going to the STW lobby in headless?
+        FReadinessConfig Readiness;
+        Readiness.TimeoutMs = GetCommandLineArgInt("-USS_ReadyTimeout", Readiness.TimeoutMs);
+        Readiness.RequiredClasses = { "FortGameModeZone", "FortPlayerControllerZone" };
+
+        USS_LOG("Waiting for game initialization (timeout %d ms)...", Readiness.TimeoutMs);
+        if (FReadinessProbe(Readiness).Wait() != EResult::Success)
+        {
+            USS_WARN("Continuing without a ready game, STW systems may attach late");
+        }
+
+        std::string SnapshotPath;
+        if (GetCommandLineArg("-USS_DumpObjects", SnapshotPath))
+        {
+            FObjectSnapshot Snapshot;
+            Result = Snapshot.Capture();
+            if (Result == EResult::Success)
+                Result = Snapshot.Save(SnapshotPath.c_str());
+
+            if (Result != EResult::Success)
+                USS_WARN("Object snapshot to %s failed: %s", SnapshotPath.c_str(), ResultToString(Result));
+        }
+
         //printf("0x%llX\n", (unsigned long long)PatternScanner::Get()->FindProcessEvent());
 
         // Initialize STW systems
@@ -286,7 +324,10 @@ namespace USS
         USS_LOG("");
 
         // Initialize GameMode (this initializes all subsystems)
+        auto STWStart = std::chrono::steady_clock::now();
         Result = GetSTWGameMode().Initialize(GameConfig);
+        double STWMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - STWStart).count();
+
         if (Result != EResult::Success)
         {
             USS_ERROR("STW GameMode initialization failed: %s", ResultToString(Result));
@@ -294,7 +335,7 @@ namespace USS
         }
         else
         {
-            USS_LOG("STW systems initialized successfully");
+            USS_LOG("STW systems initialized successfully (%.1f ms)", STWMs);
         }
 
         USS_LOG("");
@@ -314,9 +355,11 @@ namespace USS
 
         GetSTWGameMode().Shutdown();
 
+        GetWorkerPool().Shutdown();
+
         GetEngineCore().Shutdown();
 
-        //FCrashHandler::Shutdown();
+        FCrashHandler::Shutdown();
 
         Log::Shutdown();
 
@@ -346,4 +389,4 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReason, LPVOID lpReserved)
     }
 
     return TRUE;
-}
+}
\ No newline at end of file
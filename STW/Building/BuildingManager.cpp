@@ -4,18 +4,12 @@
 
 #include "BuildingManager.h"
 #include "../Inventory/InventoryManager.h"
+#include "../../Core/Diagnostics/Profiler.h"
 #include "../../Core/Logging/Log.h"
 #include "../../Engine/EngineCore.h"
 
 namespace USS
 {
-    static FBuildingManager g_LocalBuildingManager;
-
-    FBuildingManager& GetLocalBuildingManager()
-    {
-        return g_LocalBuildingManager;
-    }
-
     FBuildingManager::FBuildingManager()
     {
         m_BuildPreview = FBuildPreview();
@@ -60,12 +54,14 @@ namespace USS
         m_EventCallbacks.clear();
 
         m_pInventoryManager = nullptr;
-        m_BuildingManagerActor = UObjectWrapper();
-        m_TrapManagerActor = UObjectWrapper();
+        m_BuildingManagerActor.Reset();
+        m_TrapManagerActor.Reset();
     }
 
     void FBuildingManager::Update()
     {
+        USS_PROFILE_ZONE("BuildingManager::Update");
+
         // Update building construction progress
         for (auto& Pair : m_Buildings)
         {
@@ -777,6 +773,8 @@ namespace USS
 
     void FBuildingManager::UpdateTraps(float DeltaTime)
     {
+        USS_PROFILE_ZONE("BuildingManager::UpdateTraps");
+
         for (auto& Pair : m_Traps)
         {
             FTrapInstance& Trap = Pair.second;
@@ -806,7 +804,7 @@ namespace USS
         Event.BuildingId = Trap.TrapId;
         NotifyChange(Event);
 
-        USS_LOG("Trap triggered: %s (durability: %d/%d)",
+        USS_LOG_RATE(20, "Trap triggered: %s (durability: %d/%d)",
             Trap.TrapId.c_str(),
             Trap.Stats.CurrentDurability,
             Trap.Stats.MaxDurability);
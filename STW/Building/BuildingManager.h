@@ -7,7 +7,7 @@
 #pragma once
 
 #include "BuildingTypes.h"
-#include "../../Engine/UObject/UObjectWrapper.h"
+#include "../../Engine/UObject/WeakObjectHandle.h"
 #include <functional>
 #include <unordered_map>
 #include <memory>
@@ -307,16 +307,11 @@ namespace USS
         // References
         FInventoryManager* m_pInventoryManager = nullptr;
 
-        UObjectWrapper m_BuildingManagerActor;
-        UObjectWrapper m_TrapManagerActor;
+        TWeakObjectHandle<> m_BuildingManagerActor;
+        TWeakObjectHandle<> m_TrapManagerActor;
 
         // Event callbacks
         std::vector<FBuildingEventCallback> m_EventCallbacks;
     };
 
-    /**
-     * Global building manager accessor
-     */
-    FBuildingManager& GetLocalBuildingManager();
-
 }
\ No newline at end of file
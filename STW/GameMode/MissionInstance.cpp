@@ -0,0 +1,403 @@
+/**
+ * UniversalSlashingSimulator - Mission Instance Implementation
+ *
+ * Based on farmstead_plate.cpp from PolarisV2-STW.
+ */
+
+#include "MissionInstance.h"
+#include "../../Core/Diagnostics/Profiler.h"
+#include "../../Core/Logging/Log.h"
+#include "../../Engine/EngineCore.h"
+#include "../../Engine/Events/VTableHooks.h"
+#include "../Missions/MissionManager.h"
+#include "../Player/STWPlayerController.h"
+#include <cstring>
+
+namespace USS
+{
+    FMissionInstance::FMissionInstance(void* World)
+        : m_State(ESTWGameState::None)
+        , m_bWorldReady(false)
+        , m_bPlayersLoaded(false)
+        , m_World(World)
+    {
+    }
+
+    FMissionInstance::~FMissionInstance()
+    {
+        Shutdown();
+    }
+
+    EResult FMissionInstance::Initialize(const FSTWGameConfig& Config)
+    {
+        if (m_State != ESTWGameState::None)
+            return EResult::AlreadyInitialized;
+
+        USS_LOG("Initializing mission instance for world %p...", GetWorld());
+        USS_LOG("  Zone: %s", Config.ZoneName.c_str());
+        USS_LOG("  Mission: %s", Config.MissionBlueprint.c_str());
+
+        m_Config = Config;
+        SetState(ESTWGameState::Initializing);
+
+        // Create managers (inventory/building are created per player)
+        m_pMissionManager = std::make_unique<FMissionManager>();
+        m_pPlayerManager = std::make_unique<FPlayerControllerManager>();
+
+        // Initialize managers
+        if (m_pMissionManager->Initialize() != EResult::Success)
+        {
+            USS_WARN("Mission manager initialization incomplete");
+        }
+
+        if (m_pPlayerManager->Initialize() != EResult::Success)
+        {
+            USS_WARN("Player controller manager initialization incomplete");
+        }
+
+        SetState(ESTWGameState::WaitingForWorld);
+
+        USS_LOG("Mission instance initialized, waiting for world...");
+        return EResult::Success;
+    }
+
+    void FMissionInstance::Shutdown()
+    {
+        if (m_State == ESTWGameState::None || m_State == ESTWGameState::Shutdown)
+            return;
+
+        USS_LOG("Shutting down mission instance for world %p...", GetWorld());
+
+        SetState(ESTWGameState::Shutdown);
+
+        m_pPlayerManager.reset();
+        m_pMissionManager.reset();
+
+        m_PersistentLevel.Reset();
+
+        m_bWorldReady = false;
+        m_bPlayersLoaded = false;
+
+        m_State = ESTWGameState::None;
+
+        USS_LOG("Mission instance shutdown complete");
+    }
+
+    void FMissionInstance::Update()
+    {
+        USS_PROFILE_ZONE("MissionInstance::Update");
+
+        FScopedLock Lock(m_CriticalSection);
+
+        // Called each tick - update managers
+        if (m_pMissionManager)
+            m_pMissionManager->Update();
+
+        // Players tick their own inventory/building managers
+        if (m_pPlayerManager)
+            m_pPlayerManager->Update();
+    }
+
+    void FMissionInstance::SetState(ESTWGameState NewState)
+    {
+        if (m_State == NewState)
+            return;
+
+        ESTWGameState OldState = m_State;
+        m_State = NewState;
+
+        USS_LOG("Instance %p state: %s -> %s",
+            GetWorld(),
+            GetGameStateName(OldState),
+            GetGameStateName(NewState));
+
+        // Notify callbacks
+        for (const auto& Callback : m_StateChangeCallbacks)
+        {
+            Callback(OldState, NewState);
+        }
+    }
+
+    FSTWPlayerController* FMissionInstance::GetPlayer(void* Controller) const
+    {
+        return m_pPlayerManager ? m_pPlayerManager->GetPlayer(Controller) : nullptr;
+    }
+
+    void FMissionInstance::RegisterStateChangeCallback(StateChangeCallback Callback)
+    {
+        m_StateChangeCallbacks.push_back(std::move(Callback));
+    }
+
+	// @timmie: replace with normal VFT / hooking system when available
+    void FMissionInstance::OnProcessEvent(EProcessEventRoute Route, void* Object, void* Function, void* Params)
+    {
+        if (!Function || Route == EProcessEventRoute::None)
+            return;
+
+        FScopedLock Lock(m_CriticalSection);
+
+        // Hash lookup - null when Object isn't a registered controller
+        FSTWPlayerController* Player = GetPlayer(Object);
+
+        // Handle specific events based on current state
+        switch (Route)
+        {
+        case EProcessEventRoute::ReadyToStartMatch:
+            OnReadyToStartMatch();
+            break;
+
+        case EProcessEventRoute::LoadingScreenDropped:
+            // Late joiner - the controller is the calling object
+            if (!Player && TryRegisterPlayer(Object))
+                Player = GetPlayer(Object);
+            break;
+
+        case EProcessEventRoute::ToggleEditMode:
+            OnToggleEditMode(Player, Params);
+            break;
+
+        case EProcessEventRoute::StartLeavingZone:
+            OnStartLeavingZone(Params);
+            break;
+
+        case EProcessEventRoute::CraftSchematic:
+            OnCraftSchematic(Player, Params);
+            break;
+
+        case EProcessEventRoute::Tick:
+            Update();
+            break;
+
+        default:
+            break;
+        }
+
+        // Forward to sub-managers
+        if (m_pMissionManager)
+            m_pMissionManager->OnProcessEvent(Object, Function, Params);
+
+        // Only the owning player's managers see controller events
+        if (Player)
+            Player->OnProcessEvent(Function, Params);
+    }
+
+    void FMissionInstance::OnReadyToStartMatch()
+    {
+        if (m_State != ESTWGameState::WaitingForWorld)
+            return;
+
+        USS_LOG("ReadyToStartMatch received");
+
+        InitializeWorld();
+        OnWorldReady();
+
+        // Transition to waiting for players
+        SetState(ESTWGameState::WaitingForPlayers);
+
+        // For single-player, immediately proceed
+        OnAllPlayersLoaded();
+    }
+
+    void FMissionInstance::OnWorldReady()
+    {
+        USS_LOG("World is ready");
+        m_bWorldReady = true;
+
+        // Cache world references
+        m_PersistentLevel = TWeakObjectHandle<>(GetEngineCore().FindObjectByName("PersistentLevel"));
+
+        // Level actors (mission manager, prebuilt structures) exist from here
+        GetSTWGameMode().AttachInterceptedObjects();
+
+        // Load husk assets into memory
+        LoadHuskAssets();
+    }
+
+    void FMissionInstance::OnAllPlayersLoaded()
+    {
+        if (m_bPlayersLoaded)
+            return;
+
+        USS_LOG("All players loaded");
+        m_bPlayersLoaded = true;
+
+        SetState(ESTWGameState::LoadingMission);
+
+        // Register every controller already in this world
+        RegisterWorldPlayers();
+
+        // Initialize mission
+        InitializeMission();
+
+        SetState(ESTWGameState::MissionActive);
+    }
+
+    void FMissionInstance::OnMissionEvent(const char* EventName, void* Params)
+    {
+        USS_LOG("Mission event: %s", EventName);
+
+        if (m_pMissionManager)
+        {
+            m_pMissionManager->OnMissionEvent(EventName, Params);
+        }
+    }
+
+    void FMissionInstance::OnToggleEditMode(FSTWPlayerController* Player, void* Params)
+    {
+        if (!Player)
+            return;
+
+        USS_LOG("Edit mode toggled for %p", Player->GetNative());
+
+        // Toggle between build mode and normal mode
+        if (Player->IsInBuildMode())
+        {
+            Player->ExitBuildMode();
+        }
+        else
+        {
+            Player->EnterBuildMode();
+        }
+    }
+
+    void FMissionInstance::OnStartLeavingZone(void* Params)
+    {
+        USS_LOG("Starting to leave zone");
+
+        SetState(ESTWGameState::LeavingZone);
+
+        // TODO: Handle zone exit
+    }
+
+    void FMissionInstance::OnCraftSchematic(FSTWPlayerController* Player, void* Params)
+    {
+        if (!Player)
+            return;
+
+        USS_LOG("Craft schematic requested by %p", Player->GetNative());
+
+        // TODO: Parse schematic ID from Params and call CraftItem
+        // if (FInventoryManager* Inventory = Player->GetInventoryManager())
+        // {
+        //     Inventory->CraftItem(schematicId, 1);
+        // }
+    }
+
+    void FMissionInstance::InitializeWorld()
+    {
+        USS_LOG("Initializing world...");
+
+        // TODO: Additional world initialization
+        // - Patch gameplay abilities
+        // - Setup replication
+    }
+
+    void FMissionInstance::InitializeMission()
+    {
+        USS_LOG("Initializing mission...");
+
+        if (!m_pMissionManager)
+            return;
+
+        // Create mission based on config
+        FMissionConfig MissionConfig;
+        MissionConfig.Type = m_Config.MissionType;
+        MissionConfig.DifficultyLevel = m_Config.DifficultyLevel;
+        MissionConfig.BlueprintPath = m_Config.MissionBlueprint;
+
+        m_pMissionManager->StartMission(MissionConfig);
+    }
+
+    void FMissionInstance::RegisterWorldPlayers()
+    {
+        USS_LOG("Registering players...");
+
+        void* World = GetWorld();
+        std::vector<void*> Controllers;
+
+        // Collect first - registering reads engine state we're iterating
+        GetEngineCore().ForEachObject([&](const UObjectWrapper& Object) -> bool
+        {
+            std::string ClassName = Object.GetObjectClassName();
+
+            if (ClassName.find("FortPlayerController") != std::string::npos &&
+                ClassName.find("_C") != std::string::npos &&
+                GetEngineCore().GetObjectWorld(Object.GetRaw()) == World)
+            {
+                Controllers.push_back(Object.GetRaw());
+            }
+
+            return true;
+        });
+
+        for (void* Controller : Controllers)
+        {
+            TryRegisterPlayer(Controller);
+        }
+
+        if (m_pPlayerManager && m_pPlayerManager->GetPlayerCount() == 0)
+        {
+            USS_WARN("No player controllers found yet");
+            return;
+        }
+
+        USS_LOG("Registered %d players", m_pPlayerManager ? m_pPlayerManager->GetPlayerCount() : 0);
+    }
+
+    bool FMissionInstance::TryRegisterPlayer(void* Controller)
+    {
+        if (!m_pPlayerManager || !Controller)
+            return false;
+
+        if (m_pPlayerManager->GetPlayer(Controller))
+            return true;
+
+        if (m_pPlayerManager->GetPlayerCount() >= m_Config.MaxPlayers)
+        {
+            USS_WARN("Instance %p is full (%d players), ignoring %p",
+                GetWorld(), m_Config.MaxPlayers, Controller);
+            return false;
+        }
+
+        FSTWPlayerController* Player = m_pPlayerManager->RegisterPlayer(Controller);
+
+        if (!Player || !Player->IsValid())
+        {
+            USS_ERROR("Failed to wrap player controller %p", Controller);
+            m_pPlayerManager->UnregisterPlayer(Controller);
+            return false;
+        }
+
+        // Late joiners weren't around for the initial class sweep
+        if (GetVTableHooks().IsInitialized())
+            GetVTableHooks().Attach(Controller);
+
+        return true;
+    }
+
+    void FMissionInstance::LoadHuskAssets()
+    {
+        USS_LOG("Loading husk assets into memory...");
+
+        // Based on athena_plate.cpp husk loading
+        const char* HuskAssets[] = {
+            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn.HuskPawn_C",
+            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Fire.HuskPawn_Fire_C",
+            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Ice.HuskPawn_Ice_C",
+            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Lightning.HuskPawn_Lightning_C",
+            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Beehive.HuskPawn_Beehive_C",
+            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Bombshell.HuskPawn_Bombshell_C",
+            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Bombshell_Poison.HuskPawn_Bombshell_Poison_C",
+            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Dwarf.HuskPawn_Dwarf_C",
+            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Dwarf_Fire.HuskPawn_Dwarf_Fire_C",
+            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Dwarf_Ice.HuskPawn_Dwarf_Ice_C",
+            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Dwarf_Lightning.HuskPawn_Dwarf_Lightning_C",
+        };
+
+        // TODO: Implement FindOrLoadObject via engine core
+        // For each asset, call engine's StaticLoadObject
+
+        USS_LOG("Loaded %zu husk asset types", sizeof(HuskAssets) / sizeof(HuskAssets[0]));
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+/**
+ * UniversalSlashingSimulator - Mission Instance
+ *
+ * All STW state for a single zone, keyed by its UWorld*. One process can
+ * host several instances side by side; FSTWGameMode routes each
+ * ProcessEvent to the instance owning the calling object's world.
+ *
+ * Inventory and building state is per player: each FSTWPlayerController
+ * owns its own managers, and the instance hands controller events to
+ * FPlayerControllerManager, which finds the player by pointer.
+ *
+ * Based on FarmsteadPlate from PolarisV2-STW.
+ *
+ * Lifecycle:
+ * 1. Initialize() - Called when the zone game mode is first seen
+ * 2. OnWorldReady() - Called when world is loaded
+ * 3. OnPlayersLoaded() - Called when all players joined
+ * 4. OnMissionStart() - Mission gameplay begins
+ * 5. OnMissionEnd() - Mission complete/failed
+ * 6. Shutdown() - Cleanup
+ */
+
+#pragma once
+
+#include "../../Core/Common.h"
+#include "../../Engine/UObject/WeakObjectHandle.h"
+#include "STWGameMode.h"
+#include <functional>
+
+namespace USS
+{
+    // Forward declarations
+    class FMissionManager;
+    class FSTWPlayerController;
+    class FPlayerControllerManager;
+
+    // Per-world STW context
+    class FMissionInstance
+    {
+    public:
+        explicit FMissionInstance(void* World);
+        ~FMissionInstance();
+
+        USS_NON_COPYABLE(FMissionInstance)
+        USS_NON_MOVABLE(FMissionInstance)
+
+        // Lifecycle
+        EResult Initialize(const FSTWGameConfig& Config);
+        void Shutdown();
+        void Update();  // Called each tick
+
+        // World
+        void* GetWorld() const { return m_World.GetRaw(); }
+
+        // State
+        ESTWGameState GetState() const { return m_State; }
+        bool IsInitialized() const { return m_State != ESTWGameState::None; }
+        bool IsMissionActive() const { return m_State == ESTWGameState::MissionActive; }
+
+        // Configuration
+        const FSTWGameConfig& GetConfig() const { return m_Config; }
+
+        // Manager access
+        FMissionManager* GetMissionManager() const { return m_pMissionManager.get(); }
+        FPlayerControllerManager* GetPlayerManager() const { return m_pPlayerManager.get(); }
+
+        // Player lookup by native controller
+        FSTWPlayerController* GetPlayer(void* Controller) const;
+
+        // Event handlers (called from FSTWGameMode routing, Route already resolved).
+        // Serialized with Update() on the instance's own lock
+        void OnProcessEvent(EProcessEventRoute Route, void* Object, void* Function, void* Params);
+
+        // Callbacks for external systems
+        using StateChangeCallback = std::function<void(ESTWGameState OldState, ESTWGameState NewState)>;
+        void RegisterStateChangeCallback(StateChangeCallback Callback);
+
+    private:
+        // State transitions
+        void SetState(ESTWGameState NewState);
+
+        // Event handlers
+        void OnReadyToStartMatch();
+        void OnWorldReady();
+        void OnAllPlayersLoaded();
+        void OnMissionEvent(const char* EventName, void* Params);
+        void OnToggleEditMode(FSTWPlayerController* Player, void* Params);
+        void OnStartLeavingZone(void* Params);
+        void OnCraftSchematic(FSTWPlayerController* Player, void* Params);
+
+        // Initialization helpers
+        void InitializeWorld();
+        void InitializeMission();
+        void RegisterWorldPlayers();
+        bool TryRegisterPlayer(void* Controller);
+        void LoadHuskAssets();
+
+        // State
+        ESTWGameState m_State;
+        FSTWGameConfig m_Config;
+        bool m_bWorldReady;
+        bool m_bPlayersLoaded;
+
+        // Managers
+        std::unique_ptr<FMissionManager> m_pMissionManager;
+        std::unique_ptr<FPlayerControllerManager> m_pPlayerManager;
+
+        // Callbacks
+        std::vector<StateChangeCallback> m_StateChangeCallbacks;
+
+        // Held by OnProcessEvent and Update; recursive, so nested events are safe
+        FCriticalSection m_CriticalSection;
+
+        // Engine references (cached)
+        TWeakObjectHandle<> m_World;
+        TWeakObjectHandle<> m_PersistentLevel;
+    };
+
+}
\ No newline at end of file
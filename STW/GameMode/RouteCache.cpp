@@ -0,0 +1,93 @@
+/**
+ * UniversalSlashingSimulator - ProcessEvent Route Cache Implementation
+ */
+
+#include "RouteCache.h"
+
+namespace USS
+{
+    namespace
+    {
+        uint32 HashPointer(void* Pointer)
+        {
+            uint64 Value = reinterpret_cast<uintptr>(Pointer);
+            Value ^= Value >> 33;
+            Value *= 0xFF51AFD7ED558CCDull;
+            Value ^= Value >> 33;
+            return static_cast<uint32>(Value);
+        }
+    }
+
+    FRouteCache::FRouteCache(uint32 NumSlots)
+        : m_Mask(NumSlots - 1)
+        , m_Slots(new std::atomic<uint64>[NumSlots])
+    {
+        Clear();
+    }
+
+    uint64 FRouteCache::Encode(void* Function, uint8 Value)
+    {
+        const uint64 Address = reinterpret_cast<uintptr>(Function);
+
+        // User-mode addresses fit in 48 bits on every platform we run on;
+        // anything else just isn't cached
+        if (Address == 0 || (Address >> 48) != 0)
+            return 0;
+
+        return (Address << 16) | Value;
+    }
+
+    bool FRouteCache::Find(void* Function, uint8& OutValue) const
+    {
+        uint32 Index = HashPointer(Function);
+
+        for (uint32 Probe = 0; Probe < MaxProbe; ++Probe, ++Index)
+        {
+            const uint64 Entry = m_Slots[Index & m_Mask].load(std::memory_order_relaxed);
+
+            if (Entry == 0)
+                return false;
+
+            if (DecodeFunction(Entry) == Function)
+            {
+                OutValue = static_cast<uint8>(Entry & 0xFF);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool FRouteCache::Add(void* Function, uint8 Value)
+    {
+        const uint64 NewEntry = Encode(Function, Value);
+        if (NewEntry == 0)
+            return false;
+
+        uint32 Index = HashPointer(Function);
+
+        for (uint32 Probe = 0; Probe < MaxProbe; ++Probe, ++Index)
+        {
+            std::atomic<uint64>& Slot = m_Slots[Index & m_Mask];
+
+            // Plain load first - only an empty slot is worth a locked RMW
+            uint64 Entry = Slot.load(std::memory_order_relaxed);
+            if (Entry == 0 && Slot.compare_exchange_strong(Entry, NewEntry, std::memory_order_relaxed))
+                return true;
+
+            if (DecodeFunction(Entry) == Function)
+                return true;
+        }
+
+        return false;
+    }
+
+    void FRouteCache::Clear()
+    {
+        for (uint32 i = 0; i <= m_Mask; ++i)
+        {
+            m_Slots[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+}
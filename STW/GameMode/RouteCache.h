@@ -0,0 +1,62 @@
+/**
+ * UniversalSlashingSimulator - ProcessEvent Route Cache
+ *
+ * UFunction* -> small value (an EProcessEventRoute), probed without a
+ * lock on every ProcessEvent. Each slot is one 64-bit word holding the
+ * pointer and the value together, so a reader can never pair one
+ * function's key with another's value, and Clear() is safe while other
+ * threads probe - they just miss and classify again.
+ *
+ * Probes are capped at MaxProbe slots. A miss costs at most that many
+ * loads, and an insert that finds no free slot in range isn't cached -
+ * the caller keeps its freshly classified value either way.
+ *
+ * Entries are keyed by address only. Blueprint UFunctions are collected
+ * on every zone change and their memory reused, so the owner clears the
+ * cache whenever worlds come and go.
+ */
+
+#pragma once
+
+#include "../../Core/Common.h"
+#include <atomic>
+#include <memory>
+
+namespace USS
+{
+    class FRouteCache
+    {
+    public:
+        static constexpr uint32 DefaultSlots = 8192;
+        static constexpr uint32 MaxProbe = 16;
+
+        // @param NumSlots - power of two
+        explicit FRouteCache(uint32 NumSlots = DefaultSlots);
+
+        USS_NON_COPYABLE(FRouteCache)
+        USS_NON_MOVABLE(FRouteCache)
+
+        bool Find(void* Function, uint8& OutValue) const;
+
+        /**
+         * Cache Value for Function. Two threads adding the same function
+         * store the same value, so losing the race is harmless
+         * @return false if it wasn't cached (probe range full, or a pointer
+         *         the slot encoding can't hold)
+         */
+        bool Add(void* Function, uint8 Value);
+
+        void Clear();
+
+        uint32 GetNumSlots() const { return m_Mask + 1; }
+
+    private:
+        // Pointer in the upper 48 bits, value in the low 8; 0 is empty
+        static uint64 Encode(void* Function, uint8 Value);
+        static void* DecodeFunction(uint64 Entry) { return reinterpret_cast<void*>(static_cast<uintptr>(Entry >> 16)); }
+
+        uint32 m_Mask;
+        std::unique_ptr<std::atomic<uint64>[]> m_Slots;
+    };
+
+}
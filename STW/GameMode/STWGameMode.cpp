@@ -5,21 +5,50 @@
  */
 
 #include "STWGameMode.h"
+#include "MissionInstance.h"
+#include "../../Core/Diagnostics/FlightRecorder.h"
+#include "../../Core/Diagnostics/Profiler.h"
 #include "../../Core/Logging/Log.h"
 #include "../../Core/Hooks/HookTypes.h"
 #include "../../Engine/EngineCore.h"
-#include "../Missions/MissionManager.h"
-#include "../Inventory/InventoryManager.h"
-#include "../Building/BuildingManager.h"
-#include "../Player/STWPlayerController.h"
-#include <cstring>
+#include "../../Engine/Events/NativeHooks.h"
+#include "../../Engine/Events/VTableHooks.h"
 
 namespace USS
 {
+    namespace
+    {
+        // Flight recorder tag names, indexed by EProcessEventRoute
+        const char* const RouteNames[] = {
+            "None",
+            "ReadyToStartMatch",
+            "LoadingScreenDropped",
+            "ToggleEditMode",
+            "StartLeavingZone",
+            "CraftSchematic",
+            "Tick",
+            "Forward"
+        };
+
+        static_assert(sizeof(RouteNames) / sizeof(RouteNames[0]) == static_cast<size_t>(EProcessEventRoute::Forward) + 1,
+            "RouteNames must match EProcessEventRoute");
+
+        // Only worlds run by this game mode get a lazily created instance -
+        // the frontend and transition maps never do
+        const char* const ZoneGameModeClass = "FortGameModeZone";
+
+        // Classes whose ProcessEvent we need when running on vtable hooks -
+        // every route in ClassifyFunction comes from one of these
+        const char* const InterceptedClasses[] = {
+            "FortGameModeZone",
+            "FortPlayerControllerZone",
+            "FortMissionManager",
+            "BuildingSMActor"
+        };
+    }
+
     FSTWGameMode::FSTWGameMode()
-        : m_State(ESTWGameState::None)
-        , m_bWorldReady(false)
-        , m_bPlayersLoaded(false)
+        : m_bInitialized(false)
     {
     }
 
@@ -36,20 +65,20 @@ namespace USS
 
     EResult FSTWGameMode::Initialize(const FSTWGameConfig& Config)
     {
-        if (m_State != ESTWGameState::None)
+        FScopedLock Lock(m_CriticalSection);
+
+        if (m_bInitialized)
             return EResult::AlreadyInitialized;
 
         USS_LOG("Initializing STW GameMode...");
-        USS_LOG("  Zone: %s", Config.ZoneName.c_str());
-        USS_LOG("  Mission: %s", Config.MissionBlueprint.c_str());
+        USS_LOG("  Default zone: %s", Config.ZoneName.c_str());
+        USS_LOG("  Default mission: %s", Config.MissionBlueprint.c_str());
 
         m_Config = Config;
-        SetState(ESTWGameState::Initializing);
 
-        // Create managers
-        m_pMissionManager = std::make_unique<FMissionManager>();
-        m_pInventoryManager = std::make_unique<FInventoryManager>();
-        m_pBuildingManager = std::make_unique<FBuildingManager>();
+        FFlightRecorder::SetTagNames(RouteNames, sizeof(RouteNames) / sizeof(RouteNames[0]));
+
+        AttachInterceptedObjects();
 
         // Register for ProcessEvent callbacks (@timmie implements hooks)
         // When hooks are implemented, register a callback that forwards to OnProcessEvent:
@@ -58,317 +87,226 @@ namespace USS
         //     return true;
         // });
 
-        // Initialize managers
-        if (m_pMissionManager->Initialize() != EResult::Success)
-        {
-            USS_WARN("Mission manager initialization incomplete");
-        }
-
-        if (m_pInventoryManager->Initialize(nullptr) != EResult::Success)
-        {
-            USS_WARN("Inventory manager initialization incomplete");
-        }
+        m_bInitialized = true;
 
-        if (m_pBuildingManager->Initialize(m_pInventoryManager.get()) != EResult::Success)
-        {
-            USS_WARN("Building manager initialization incomplete");
-        }
-
-        SetState(ESTWGameState::WaitingForWorld);
-
-        USS_LOG("STW GameMode initialized, waiting for world...");
+        USS_LOG("STW GameMode initialized, instances are created per world on first event");
         return EResult::Success;
     }
 
     void FSTWGameMode::Shutdown()
     {
-        if (m_State == ESTWGameState::None || m_State == ESTWGameState::Shutdown)
-            return;
-
-        USS_LOG("Shutting down STW GameMode...");
-
-        SetState(ESTWGameState::Shutdown);
+        FScopedLock Lock(m_CriticalSection);
 
-        m_pLocalPlayer.reset();
-        m_pBuildingManager.reset();
-        m_pInventoryManager.reset();
-        m_pMissionManager.reset();
-
-        m_World = UObjectWrapper();
-        m_GameState = UObjectWrapper();
-        m_GameMode = UObjectWrapper();
+        if (!m_bInitialized)
+            return;
 
-        m_bWorldReady = false;
-        m_bPlayersLoaded = false;
+        USS_LOG("Shutting down STW GameMode (%zu instances)...", m_Instances.size());
 
-        m_State = ESTWGameState::None;
+        // Instances shut down in their destructors, once any event still
+        // running on one lets go of it
+        m_bInitialized = false;
+        m_Instances.clear();
+        m_Routes.Clear();
 
         USS_LOG("STW GameMode shutdown complete");
     }
 
     void FSTWGameMode::Update()
     {
-        // Called each tick - update managers
-        if (m_pMissionManager)
-            m_pMissionManager->Update();
-
-        if (m_pBuildingManager)
-            m_pBuildingManager->Update();
-    }
+        USS_PROFILE_ZONE("STWGameMode::Update");
 
-    void FSTWGameMode::SetState(ESTWGameState NewState)
-    {
-        if (m_State == NewState)
-            return;
-
-        ESTWGameState OldState = m_State;
-        m_State = NewState;
-
-        USS_LOG("GameMode state: %s -> %s",
-            GetGameStateName(OldState),
-            GetGameStateName(NewState));
-
-        // Notify callbacks
-        for (const auto& Callback : m_StateChangeCallbacks)
+        for (const std::shared_ptr<FMissionInstance>& Instance : GetInstances())
         {
-            Callback(OldState, NewState);
+            Instance->Update();
         }
     }
 
-    void FSTWGameMode::SetLocalPlayer(std::unique_ptr<FSTWPlayerController> Player)
+    FMissionInstance* FSTWGameMode::CreateInstance(void* World, const FSTWGameConfig& Config)
     {
-        m_pLocalPlayer = std::move(Player);
-    }
+        if (!World)
+            return nullptr;
 
-    void FSTWGameMode::RegisterStateChangeCallback(StateChangeCallback Callback)
-    {
-        m_StateChangeCallbacks.push_back(std::move(Callback));
-    }
+        FScopedLock Lock(m_CriticalSection);
 
-	// @timmie: replace with normal VFT / hooking system when available
-    void FSTWGameMode::OnProcessEvent(void* Object, void* Function, void* Params)
-    {
-        if (!Function)
-            return;
+        auto It = m_Instances.find(World);
+        if (It != m_Instances.end())
+            return It->second.get();
 
-        // Get function name
-        UFunctionWrapper FuncWrapper(Function);
-        std::string FuncName = FuncWrapper.GetName();
+        std::shared_ptr<FMissionInstance> Instance = std::make_shared<FMissionInstance>(World);
 
-        // Handle specific events based on current state
-        if (FuncName.find("ReadyToStartMatch") != std::string::npos)
-        {
-            OnReadyToStartMatch();
-        }
-        else if (FuncName.find("ServerHandleMissionEvent_ToggledEditMode") != std::string::npos)
-        {
-            OnToggleEditMode(Params);
-        }
-        else if (FuncName.find("ServerHandleMissionEvent_StartLeavingZone") != std::string::npos)
-        {
-            OnStartLeavingZone(Params);
-        }
-        else if (FuncName.find("ServerCraftSchematic") != std::string::npos)
-        {
-            OnCraftSchematic(Params);
-        }
-        else if (FuncName.find("Tick") != std::string::npos)
+        if (Instance->Initialize(Config) != EResult::Success)
         {
-            Update();
+            USS_ERROR("Failed to initialize mission instance for world %p", World);
+            return nullptr;
         }
 
-        // Forward to sub-managers
-        if (m_pMissionManager)
-            m_pMissionManager->OnProcessEvent(Object, Function, Params);
-
-        if (m_pBuildingManager && m_pLocalPlayer)
-            m_pBuildingManager->OnProcessEvent(Object, Function, Params);
-    }
-
-    void FSTWGameMode::OnReadyToStartMatch()
-    {
-        if (m_State != ESTWGameState::WaitingForWorld)
-            return;
+        FMissionInstance* Raw = Instance.get();
+        m_Instances.emplace(World, std::move(Instance));
 
-        USS_LOG("ReadyToStartMatch received");
+        // A new zone means the last one's blueprint functions are gone
+        m_Routes.Clear();
 
-        InitializeWorld();
-        OnWorldReady();
-
-        // Transition to waiting for players
-        SetState(ESTWGameState::WaitingForPlayers);
-
-        // For single-player, immediately proceed
-        OnAllPlayersLoaded();
+        USS_LOG("Created mission instance for world %p (%zu active)", World, m_Instances.size());
+        return Raw;
     }
 
-    void FSTWGameMode::OnWorldReady()
+    FMissionInstance* FSTWGameMode::FindInstance(void* World) const
     {
-        USS_LOG("World is ready");
-        m_bWorldReady = true;
-
-        // Cache world references
-        m_World = GetEngineCore().FindObjectByName("PersistentLevel");
+        FScopedLock Lock(m_CriticalSection);
 
-        // Load husk assets into memory
-        LoadHuskAssets();
+        auto It = m_Instances.find(World);
+        return (It != m_Instances.end()) ? It->second.get() : nullptr;
     }
 
-    void FSTWGameMode::OnAllPlayersLoaded()
+    void FSTWGameMode::DestroyInstance(void* World)
     {
-        if (m_bPlayersLoaded)
-            return;
-
-        USS_LOG("All players loaded");
-        m_bPlayersLoaded = true;
+        FScopedLock Lock(m_CriticalSection);
 
-        SetState(ESTWGameState::LoadingMission);
-
-        // Spawn local player
-        SpawnLocalPlayer();
-
-        // Setup inventory
-        SetupInventory();
+        auto It = m_Instances.find(World);
+        if (It == m_Instances.end())
+            return;
 
-        // Initialize mission
-        InitializeMission();
+        m_Instances.erase(It);
+        m_Routes.Clear();
 
-        SetState(ESTWGameState::MissionActive);
+        USS_LOG("Destroyed mission instance for world %p (%zu active)", World, m_Instances.size());
     }
 
-    void FSTWGameMode::OnMissionEvent(const char* EventName, void* Params)
+    int32 FSTWGameMode::GetInstanceCount() const
     {
-        USS_LOG("Mission event: %s", EventName);
-
-        if (m_pMissionManager)
-        {
-            m_pMissionManager->OnMissionEvent(EventName, Params);
-        }
+        FScopedLock Lock(m_CriticalSection);
+        return static_cast<int32>(m_Instances.size());
     }
 
-    void FSTWGameMode::OnToggleEditMode(void* Params)
+    std::vector<std::shared_ptr<FMissionInstance>> FSTWGameMode::GetInstances() const
     {
-        USS_LOG("Edit mode toggled");
+        FScopedLock Lock(m_CriticalSection);
 
-        // Toggle between build mode and normal mode
-        if (m_pBuildingManager)
+        std::vector<std::shared_ptr<FMissionInstance>> Instances;
+        Instances.reserve(m_Instances.size());
+
+        for (const auto& Pair : m_Instances)
         {
-            if (m_pBuildingManager->IsInBuildMode())
-            {
-                m_pBuildingManager->ExitBuildMode();
-            }
-            else
-            {
-                m_pBuildingManager->EnterBuildMode(EBuildingType::Wall);
-            }
+            if (Pair.second)
+                Instances.push_back(Pair.second);
         }
-    }
-
-    void FSTWGameMode::OnStartLeavingZone(void* Params)
-    {
-        USS_LOG("Starting to leave zone");
-
-        SetState(ESTWGameState::LeavingZone);
 
-        // TODO: Handle zone exit
+        return Instances;
     }
 
-    void FSTWGameMode::OnCraftSchematic(void* Params)
+    std::shared_ptr<FMissionInstance> FSTWGameMode::AcquireInstance(void* World, EProcessEventRoute Route, void* Object)
     {
-        USS_LOG("Craft schematic requested");
+        FScopedLock Lock(m_CriticalSection);
 
-        // TODO: Parse schematic ID from Params and call CraftItem
-        // if (m_pInventoryManager)
-        // {
-        //     m_pInventoryManager->CraftItem(schematicId, 1);
-        // }
-    }
+        auto It = m_Instances.find(World);
+        if (It != m_Instances.end())
+            return It->second;
 
-    void FSTWGameMode::InitializeWorld()
-    {
-        USS_LOG("Initializing world...");
+        // New zone - its game mode is the one asking
+        if (Route != EProcessEventRoute::ReadyToStartMatch || !UObjectWrapper(Object).IsA(ZoneGameModeClass))
+            return nullptr;
+
+        if (!CreateInstance(World, m_Config))
+            return nullptr;
 
-        // TODO: Additional world initialization
-        // - Patch gameplay abilities
-        // - Setup replication
+        return m_Instances[World];
     }
 
-    void FSTWGameMode::InitializeMission()
+    int32 FSTWGameMode::AttachInterceptedObjects()
     {
-        USS_LOG("Initializing mission...");
+        if (!GetVTableHooks().IsInitialized())
+            return 0;
 
-        if (!m_pMissionManager)
-            return;
+        // Actors destroyed since the last sweep would otherwise stay
+        // recorded until Shutdown
+        [[maybe_unused]] int32 Pruned = GetVTableHooks().PruneDetached();
+        if (Pruned > 0)
+            USS_LOG("VTable hooks: dropped %d destroyed objects", Pruned);
 
-        // Create mission based on config
-        FMissionConfig MissionConfig;
-        MissionConfig.Type = m_Config.MissionType;
-        MissionConfig.DifficultyLevel = m_Config.DifficultyLevel;
-        MissionConfig.BlueprintPath = m_Config.MissionBlueprint;
+        int32 Attached = 0;
+        for (const char* ClassName : InterceptedClasses)
+        {
+            Attached += GetVTableHooks().AttachClass(ClassName);
+        }
 
-        m_pMissionManager->StartMission(MissionConfig);
+        return Attached;
     }
 
-    void FSTWGameMode::SpawnLocalPlayer()
+    EProcessEventRoute FSTWGameMode::ClassifyFunction(const std::string& FunctionName)
     {
-        USS_LOG("Spawning local player...");
-
-        // Find local player controller from engine
-        void* LocalController = GetEngineCore().FindLocalPlayerController();
+        // Order matters - earlier rules win, as with the old if/else chain
+        static const struct
+        {
+            const char* Pattern;
+            EProcessEventRoute Route;
+        } Rules[] = {
+            { "ReadyToStartMatch",                          EProcessEventRoute::ReadyToStartMatch },
+            { "ServerLoadingScreenDropped",                 EProcessEventRoute::LoadingScreenDropped },
+            { "ServerHandleMissionEvent_ToggledEditMode",   EProcessEventRoute::ToggleEditMode },
+            { "ServerHandleMissionEvent_StartLeavingZone",  EProcessEventRoute::StartLeavingZone },
+            { "ServerCraftSchematic",                       EProcessEventRoute::CraftSchematic },
+            { "Tick",                                       EProcessEventRoute::Tick },
+        };
 
-        if (!LocalController)
+        for (const auto& Rule : Rules)
         {
-            USS_WARN("Local player controller not found yet");
-            return;
+            if (FunctionName.find(Rule.Pattern) != std::string::npos)
+                return Rule.Route;
         }
 
-        // Create player controller wrapper
-        m_pLocalPlayer = std::make_unique<FSTWPlayerController>(LocalController);
+        // Remaining server RPCs still reach the mission/player managers
+        if (FunctionName.compare(0, 6, "Server") == 0)
+            return EProcessEventRoute::Forward;
 
-        if (!m_pLocalPlayer->IsValid())
-        {
-            USS_ERROR("Failed to wrap local player controller");
-            m_pLocalPlayer.reset();
-            return;
-        }
+        return EProcessEventRoute::None;
+    }
 
-        USS_LOG("Local player spawned successfully");
+    EProcessEventRoute FSTWGameMode::GetRoute(void* Function)
+    {
+        uint8 Cached = 0;
+        if (m_Routes.Find(Function, Cached))
+            return static_cast<EProcessEventRoute>(Cached);
+
+        // First sighting - decode the name once. Natively hooked functions
+        // reach their typed handler through Func, so the generic path drops them
+        std::string Name = UFunctionWrapper(Function).GetName();
+        EProcessEventRoute Route = GetNativeHooks().IsHooked(Function)
+            ? EProcessEventRoute::None
+            : ClassifyFunction(Name);
+
+        FFlightRecorder::NoteFunctionName(Function, Name.c_str());
+
+        // Not cached if its probe range is full - classified again next time
+        m_Routes.Add(Function, static_cast<uint8>(Route));
+        return Route;
     }
 
-    void FSTWGameMode::SetupInventory()
+    void FSTWGameMode::OnProcessEvent(void* Object, void* Function, void* Params)
     {
-        USS_LOG("Setting up inventory...");
+        if (!Function || !m_bInitialized.load(std::memory_order_acquire))
+            return;
 
-        if (!m_pInventoryManager || !m_pLocalPlayer)
+        // Lock-free - most events end here
+        EProcessEventRoute Route = GetRoute(Function);
+        if (Route == EProcessEventRoute::None || !Object)
             return;
 
-        // Re-initialize inventory with the player controller
-        m_pInventoryManager->Initialize(m_pLocalPlayer->GetNative());
-    }
+        USS_PROFILE_HOOK("ProcessEvent");
 
-    void FSTWGameMode::LoadHuskAssets()
-    {
-        USS_LOG("Loading husk assets into memory...");
-
-        // Based on athena_plate.cpp husk loading
-        const char* HuskAssets[] = {
-            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn.HuskPawn_C",
-            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Fire.HuskPawn_Fire_C",
-            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Ice.HuskPawn_Ice_C",
-            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Lightning.HuskPawn_Lightning_C",
-            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Beehive.HuskPawn_Beehive_C",
-            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Bombshell.HuskPawn_Bombshell_C",
-            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Bombshell_Poison.HuskPawn_Bombshell_Poison_C",
-            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Dwarf.HuskPawn_Dwarf_C",
-            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Dwarf_Fire.HuskPawn_Dwarf_Fire_C",
-            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Dwarf_Ice.HuskPawn_Dwarf_Ice_C",
-            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Dwarf_Lightning.HuskPawn_Dwarf_Lightning_C",
-        };
+        FFlightRecorder::RecordEvent(Object, Function, static_cast<uint8>(Route));
 
-        // TODO: Implement FindOrLoadObject via engine core
-        // For each asset, call engine's StaticLoadObject
+        USS_PROFILE_ZONE("STWGameMode::OnProcessEvent");
+
+        // Objects that don't live under a world (CDOs, assets) have no instance
+        void* World = GetEngineCore().GetObjectWorld(Object);
+        if (!World)
+            return;
 
-        USS_LOG("Loaded %zu husk asset types", sizeof(HuskAssets) / sizeof(HuskAssets[0]));
+        // Dispatched outside the host lock; the reference keeps the instance
+        // alive if another thread destroys it meanwhile
+        std::shared_ptr<FMissionInstance> Instance = AcquireInstance(World, Route, Object);
+        if (Instance)
+            Instance->OnProcessEvent(Route, Object, Function, Params);
     }
 
 }
\ No newline at end of file
@@ -1,18 +1,27 @@
 /**
  * UniversalSlashingSimulator - STW Game Mode
  *
- * Core STW game mode controller. Manages the game lifecycle,
- * coordinates systems, and handles ProcessEvent routing.
+ * Process-level STW host. Owns one FMissionInstance per UWorld and
+ * routes each ProcessEvent to the instance owning the calling object's
+ * world, so a single server process can run several zones at once.
  *
- * Based on FarmsteadPlate from PolarisV2-STW.
+ * Instances are created lazily when a zone game mode (FortGameModeZone)
+ * in a world without one calls ReadyToStartMatch, using the config passed
+ * to Initialize(), or explicitly via CreateInstance() with a per-zone
+ * config. Events from other worlds - frontend, transition maps - are
+ * dropped.
  *
- * Lifecycle:
- * 1. Initialize() - Called after engine core ready
- * 2. OnWorldReady() - Called when world is loaded
- * 3. OnPlayersLoaded() - Called when all players joined
- * 4. OnMissionStart() - Mission gameplay begins
- * 5. OnMissionEnd() - Mission complete/failed
- * 6. Shutdown() - Cleanup
+ * Routing is keyed by UFunction*: the first time a function is seen its
+ * name is classified once into an EProcessEventRoute and cached, so any
+ * later call - including every unrelated one - costs a short lock-free
+ * probe of FRouteCache. The cache is cleared whenever an instance is
+ * created or destroyed, since a zone change frees blueprint UFunctions
+ * and their addresses get reused. Only routed events take the lock, and
+ * only to find their instance; the instance handles the event under its
+ * own lock.
+ *
+ * Events arrive either from a global ProcessEvent detour or, with
+ * FVTableHooks, only from the objects attached to a cloned vtable.
  */
 
 #pragma once
@@ -20,15 +29,17 @@
 #include "../../Core/Common.h"
 #include "../../Engine/UObject/UObjectWrapper.h"
 #include "../Missions/MissionTypes.h"
+#include "RouteCache.h"
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace USS
 {
     // Forward declarations
-    class FMissionManager;
-    class FInventoryManager;
-    class FBuildingManager;
-    class FSTWPlayerController;
+    class FMissionInstance;
 
     // Game mode state
     enum class ESTWGameState : uint8
@@ -45,6 +56,19 @@ namespace USS
         Shutdown
     };
 
+    // What the game mode does with a given UFunction
+    enum class EProcessEventRoute : uint8
+    {
+        None,                   // Not ours - dropped after the route lookup
+        ReadyToStartMatch,
+        LoadingScreenDropped,
+        ToggleEditMode,
+        StartLeavingZone,
+        CraftSchematic,
+        Tick,
+        Forward                 // Other Server RPCs - only forwarded to managers
+    };
+
     // Game mode configuration
     struct FSTWGameConfig
     {
@@ -85,83 +109,73 @@ namespace USS
     {
     public:
         USS_NON_COPYABLE(FSTWGameMode)
-            USS_NON_MOVABLE(FSTWGameMode)
+        USS_NON_MOVABLE(FSTWGameMode)
 
-            static FSTWGameMode& Get();
+        static FSTWGameMode& Get();
 
         // Lifecycle
         EResult Initialize(const FSTWGameConfig& Config);
         void Shutdown();
-        void Update();  // Called each tick
+        void Update();  // Ticks every instance
 
-        // State
-        ESTWGameState GetState() const { return m_State; }
-        bool IsInitialized() const { return m_State != ESTWGameState::None; }
-        bool IsMissionActive() const { return m_State == ESTWGameState::MissionActive; }
+        bool IsInitialized() const { return m_bInitialized; }
 
-        // Configuration
+        // Default configuration for lazily created instances
         const FSTWGameConfig& GetConfig() const { return m_Config; }
 
-        // Manager access
-        FMissionManager* GetMissionManager() const { return m_pMissionManager.get(); }
-        FInventoryManager* GetInventoryManager() const { return m_pInventoryManager.get(); }
-        FBuildingManager* GetBuildingManager() const { return m_pBuildingManager.get(); }
+        // Instance management
+        FMissionInstance* CreateInstance(void* World, const FSTWGameConfig& Config);
+        FMissionInstance* FindInstance(void* World) const;
+        void DestroyInstance(void* World);
+        int32 GetInstanceCount() const;
 
-        // Player management
-        FSTWPlayerController* GetLocalPlayer() const { return m_pLocalPlayer.get(); }
-        void SetLocalPlayer(std::unique_ptr<FSTWPlayerController> Player);
+        // Visits a snapshot, so Func may create or destroy instances
+        template<typename Callback>
+        void ForEachInstance(Callback&& Func) const
+        {
+            for (const std::shared_ptr<FMissionInstance>& Instance : GetInstances())
+            {
+                if (!Func(Instance.get()))
+                    break;
+            }
+        }
 
         // Event handlers (called from ProcessEvent hook)
         void OnProcessEvent(void* Object, void* Function, void* Params);
 
-        // Callbacks for external systems
-        using StateChangeCallback = std::function<void(ESTWGameState OldState, ESTWGameState NewState)>;
-        void RegisterStateChangeCallback(StateChangeCallback Callback);
+        /**
+         * With vtable hooks, only attached objects reach OnProcessEvent.
+         * Attaches every live object of the classes the routes come from,
+         * after dropping records of objects destroyed since the last sweep;
+         * returns 0 when running on the global ProcessEvent detour.
+         */
+        int32 AttachInterceptedObjects();
+
+        // Name -> route rules, applied once per UFunction
+        static EProcessEventRoute ClassifyFunction(const std::string& FunctionName);
 
     private:
         FSTWGameMode();
         ~FSTWGameMode();
 
-        // State transitions
-        void SetState(ESTWGameState NewState);
-
-        // Event handlers
-        void OnReadyToStartMatch();
-        void OnWorldReady();
-        void OnAllPlayersLoaded();
-        void OnMissionEvent(const char* EventName, void* Params);
-        void OnToggleEditMode(void* Params);
-        void OnStartLeavingZone(void* Params);
-        void OnCraftSchematic(void* Params);
-
-        // Initialization helpers
-        void InitializeWorld();
-        void InitializeMission();
-        void SpawnLocalPlayer();
-        void SetupInventory();
-        void LoadHuskAssets();
-
-        // State
-        ESTWGameState m_State;
-        FSTWGameConfig m_Config;
-        bool m_bWorldReady;
-        bool m_bPlayersLoaded;
+        EProcessEventRoute GetRoute(void* Function);
 
-        // Managers
-        std::unique_ptr<FMissionManager> m_pMissionManager;
-        std::unique_ptr<FInventoryManager> m_pInventoryManager;
-        std::unique_ptr<FBuildingManager> m_pBuildingManager;
+        // The world's instance, created if Object is a zone game mode asking
+        // to start; the reference keeps it alive past a DestroyInstance
+        std::shared_ptr<FMissionInstance> AcquireInstance(void* World, EProcessEventRoute Route, void* Object);
 
-        // Player
-        std::unique_ptr<FSTWPlayerController> m_pLocalPlayer;
+        std::vector<std::shared_ptr<FMissionInstance>> GetInstances() const;
+
+        FSTWGameConfig m_Config;
+        std::atomic<bool> m_bInitialized;
 
-        // Callbacks
-        std::vector<StateChangeCallback> m_StateChangeCallbacks;
+        // Instances keyed by UWorld*. Guards the map only - events and
+        // updates run on a shared reference outside the lock
+        mutable FCriticalSection m_CriticalSection;
+        std::unordered_map<void*, std::shared_ptr<FMissionInstance>> m_Instances;
 
-        // Engine references (cached)
-        UObjectWrapper m_World;
-        UObjectWrapper m_GameState;
-        UObjectWrapper m_GameMode;
+        // UFunction* -> EProcessEventRoute, probed without a lock
+        FRouteCache m_Routes;
     };
 
     // Convenience function
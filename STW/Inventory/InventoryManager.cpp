@@ -8,13 +8,6 @@
 
 namespace USS
 {
-    static FInventoryManager g_LocalInventoryManager;
-
-    FInventoryManager& GetLocalInventoryManager()
-    {
-        return g_LocalInventoryManager;
-    }
-
     FInventoryManager::FInventoryManager()
         : m_MaxSlots(200)
         , m_MaxStackSize(999)
@@ -31,7 +24,7 @@ namespace USS
     {
         USS_LOG("Initializing Inventory Manager...");
 
-        m_PlayerController = UObjectWrapper(PlayerController);
+        m_PlayerController = TWeakObjectHandle<>(PlayerController);
 
         // Initialize quickbars
         for (int32 i = 0; i < 2; ++i)
@@ -58,11 +51,12 @@ namespace USS
     {
         m_Items.clear();
         m_SlotToItem.clear();
+        m_Recipes.clear();
         m_EventCallbacks.clear();
 
-        m_PlayerController = UObjectWrapper();
-        m_InventoryComponent = UObjectWrapper();
-        m_QuickbarComponent = UObjectWrapper();
+        m_PlayerController.Reset();
+        m_InventoryComponent.Reset();
+        m_QuickbarComponent.Reset();
     }
 
     void FInventoryManager::Update()
@@ -141,7 +135,7 @@ namespace USS
                 Event.NewCount = Pair.second.Count;
                 NotifyChange(Event);
 
-                USS_LOG("Stacked %d %s (total: %d)", ToAdd, Item.ItemName.c_str(), Pair.second.Count);
+                USS_LOG_RATE(20, "Stacked %d %s (total: %d)", ToAdd, Item.ItemName.c_str(), Pair.second.Count);
 
                 // All added by stacking
                 if (ToAdd >= Item.Count)
@@ -178,7 +172,7 @@ namespace USS
         Event.SlotIndex = FreeSlot;
         NotifyChange(Event);
 
-        USS_LOG("Added item: %s x%d (slot %d)", NewItem.ItemName.c_str(), NewItem.Count, FreeSlot);
+        USS_LOG_RATE(20, "Added item: %s x%d (slot %d)", NewItem.ItemName.c_str(), NewItem.Count, FreeSlot);
 
         return EResult::Success;
     }
@@ -197,19 +191,20 @@ namespace USS
         if (Count >= Item.Count)
         {
             // Remove entirely
-            int32 Slot = Item.SlotIndex;
-            m_SlotToItem.erase(Slot);
-            m_Items.erase(It);
-
+            // Build the event first - ItemId may alias the key being erased
             FInventoryChangeEvent Event;
             Event.Type = FInventoryChangeEvent::EChangeType::Removed;
             Event.ItemId = ItemId;
             Event.OldCount = OldCount;
             Event.NewCount = 0;
-            Event.SlotIndex = Slot;
+            Event.SlotIndex = Item.SlotIndex;
+
+            m_SlotToItem.erase(Event.SlotIndex);
+            m_Items.erase(It);
+
             NotifyChange(Event);
 
-            USS_LOG("Removed item: %s", ItemId.c_str());
+            USS_LOG("Removed item: %s", Event.ItemId.c_str());
         }
         else
         {
@@ -384,7 +379,7 @@ namespace USS
 
         Quickbar.CurrentSlot = SlotIndex;
 
-        USS_LOG("Selected quickbar %d slot %d", QuickbarIndex, SlotIndex);
+        USS_LOG_RATE(20, "Selected quickbar %d slot %d", QuickbarIndex, SlotIndex);
 
         return EResult::Success;
     }
@@ -510,29 +505,72 @@ namespace USS
         return Item ? (Item->Durability <= 0.0f) : true;
     }
 
+    void FInventoryManager::AddRecipe(const std::string& SchematicId, const FCraftingRecipe& Recipe)
+    {
+        m_Recipes[SchematicId] = Recipe;
+    }
+
     bool FInventoryManager::CanCraftItem(const std::string& SchematicId) const
     {
-        // TODO: Look up recipe and check if we have materials
-        return false;
+        auto It = m_Recipes.find(SchematicId);
+        return It != m_Recipes.end() && HasIngredients(It->second, 1);
     }
 
     EResult FInventoryManager::CraftItem(const std::string& SchematicId, int32 Count)
     {
-        if (!CanCraftItem(SchematicId))
+        if (Count <= 0)
+            return EResult::InvalidParameter;
+
+        auto It = m_Recipes.find(SchematicId);
+        if (It == m_Recipes.end())
+            return EResult::ItemNotFound;
+
+        const FCraftingRecipe& Recipe = It->second;
+
+        if (!HasIngredients(Recipe, Count))
         {
             return EResult::InsufficientResources;
         }
 
-        // TODO: Consume materials and create item
-        USS_LOG("Crafted item from schematic: %s x%d", SchematicId.c_str(), Count);
+        // Checked before consuming anything - a full inventory keeps the materials
+        if (!HasFreeSlot() && !HasItem(Recipe.ResultTemplateId))
+        {
+            return EResult::InventoryFull;
+        }
+
+        for (const auto& Ingredient : Recipe.Ingredients)
+        {
+            RemoveByTemplate(Ingredient.TemplateId, Ingredient.Count * Count);
+        }
+
+        FInventoryItem Crafted;
+        Crafted.TemplateId = Recipe.ResultTemplateId;
+        Crafted.Category = Recipe.ResultCategory;
+        Crafted.Count = Recipe.ResultCount * Count;
+        Crafted.MaxStackSize = Recipe.ResultMaxStackSize;
+
+        EResult Result = AddItem(Crafted);
+        if (Result != EResult::Success)
+            return Result;
+
+        USS_LOG_RATE(20, "Crafted item from schematic: %s x%d", SchematicId.c_str(), Count);
 
         return EResult::Success;
     }
 
     std::vector<FCraftingRecipe> FInventoryManager::GetAvailableRecipes() const
     {
-        // TODO: Return recipes player can craft
-        return {};
+        std::vector<FCraftingRecipe> Result;
+
+        for (const auto& Pair : m_Recipes)
+        {
+            if (HasIngredients(Pair.second, 1))
+            {
+                Result.push_back(Pair.second);
+            }
+        }
+
+        return Result;
     }
 
     int32 FInventoryManager::GetAmmoCount(const std::string& AmmoType) const
@@ -570,6 +608,41 @@ namespace USS
         return EResult::Success;
     }
 
+    bool FInventoryManager::HasIngredients(const FCraftingRecipe& Recipe, int32 Count) const
+    {
+        for (const auto& Ingredient : Recipe.Ingredients)
+        {
+            if (!HasItem(Ingredient.TemplateId, Ingredient.Count * Count))
+                return false;
+        }
+
+        return true;
+    }
+
+    void FInventoryManager::RemoveByTemplate(const std::string& TemplateId, int32 Count)
+    {
+        // Collect first - RemoveItem erases from m_Items
+        std::vector<std::pair<std::string, int32>> Stacks;
+
+        for (const auto& Pair : m_Items)
+        {
+            if (Pair.second.TemplateId == TemplateId)
+            {
+                Stacks.emplace_back(Pair.first, Pair.second.Count);
+            }
+        }
+
+        for (const auto& Stack : Stacks)
+        {
+            if (Count <= 0)
+                break;
+
+            int32 Take = (Stack.second < Count) ? Stack.second : Count;
+            RemoveItem(Stack.first, Take);
+            Count -= Take;
+        }
+    }
+
     void FInventoryManager::RegisterEventCallback(FInventoryEventCallback Callback)
     {
         if (Callback)
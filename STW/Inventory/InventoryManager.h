@@ -8,7 +8,7 @@
 #pragma once
 
 #include "../../Core/Common.h"
-#include "../../Engine/UObject/UObjectWrapper.h"
+#include "../../Engine/UObject/WeakObjectHandle.h"
 #include "InventoryTypes.h"
 #include <unordered_map>
 #include <functional>
@@ -72,7 +72,8 @@ namespace USS
         EResult RepairItem(const std::string& ItemId);
         bool IsItemBroken(const std::string& ItemId) const;
 
-        // Crafting (STW-specific)
+        // Crafting (STW-specific) - recipes come from the schematics the player owns
+        void AddRecipe(const std::string& SchematicId, const FCraftingRecipe& Recipe);
         bool CanCraftItem(const std::string& SchematicId) const;
         EResult CraftItem(const std::string& SchematicId, int32 Count = 1);
         std::vector<FCraftingRecipe> GetAvailableRecipes() const;
@@ -101,6 +102,8 @@ namespace USS
         int32 FindFreeSlot() const;
         std::string GenerateItemId() const;
         const FInventoryItem* FindResourceItem(EResourceType Type) const;
+        bool HasIngredients(const FCraftingRecipe& Recipe, int32 Count) const;
+        void RemoveByTemplate(const std::string& TemplateId, int32 Count);
 
         // Items by ID
         std::unordered_map<std::string, FInventoryItem> m_Items;
@@ -111,6 +114,9 @@ namespace USS
         // Quickbars (0 = primary/weapons, 1 = secondary/build)
         FQuickbar m_Quickbars[2];
 
+        // Recipes by schematic ID
+        std::unordered_map<std::string, FCraftingRecipe> m_Recipes;
+
         // Currently equipped
         std::string m_EquippedWeaponId;
         std::string m_EquippedPickaxeId;
@@ -120,9 +126,9 @@ namespace USS
         int32 m_MaxStackSize;
 
         // Engine references
-        UObjectWrapper m_PlayerController;
-        UObjectWrapper m_InventoryComponent;  // UFortInventory*
-        UObjectWrapper m_QuickbarComponent;   // UFortQuickBars*
+        TWeakObjectHandle<> m_PlayerController;
+        TWeakObjectHandle<> m_InventoryComponent;  // UFortInventory*
+        TWeakObjectHandle<> m_QuickbarComponent;   // UFortQuickBars*
 
         // Callbacks
         std::vector<FInventoryEventCallback> m_EventCallbacks;
@@ -131,7 +137,4 @@ namespace USS
         mutable uint32 m_ItemIdCounter;
     };
 
-    // Global inventory access (for current local player)
-    FInventoryManager& GetLocalInventoryManager();
-
 }
\ No newline at end of file
@@ -210,6 +210,8 @@ namespace USS
     {
         std::string ResultTemplateId;
         int32 ResultCount;
+        EItemCategory ResultCategory;
+        int32 ResultMaxStackSize;
 
         struct FIngredient
         {
@@ -221,6 +223,8 @@ namespace USS
 
         FCraftingRecipe()
             : ResultCount(1)
+            , ResultCategory(EItemCategory::None)
+            , ResultMaxStackSize(1)
         {}
     };
 
@@ -4,6 +4,7 @@
 
 #include "MissionManager.h"
 #include "MissionObjective.h"
+#include "../../Core/Diagnostics/Profiler.h"
 #include "../../Core/Logging/Log.h"
 #include "../../Engine/EngineCore.h"
 
@@ -32,7 +33,7 @@ namespace USS
 
         // Cache engine references
         // TODO: Find AFortMissionManager in world
-        m_MissionManagerActor = GetEngineCore().FindObjectByName("FortMissionManager");
+        m_MissionManagerActor = TWeakObjectHandle<>(GetEngineCore().FindObjectByName("FortMissionManager"));
 
         USS_LOG("Mission Manager initialized");
         return EResult::Success;
@@ -47,16 +48,27 @@ namespace USS
 
         m_Objectives.clear();
         m_EventCallbacks.clear();
-        m_MissionActor = UObjectWrapper();
-        m_MissionManagerActor = UObjectWrapper();
-        m_AIDirector = UObjectWrapper();
+        m_WaveScheduler.Reset();
+        m_MissionActor.Reset();
+        m_MissionManagerActor.Reset();
+        m_AIDirector.Reset();
     }
 
     void FMissionManager::Update()
     {
+        USS_PROFILE_ZONE("MissionManager::Update");
+
         if (!IsActive())
             return;
 
+        // Drain pending spawns within the per-tick budget
+        if (m_WaveInfo.bIsActive && m_WaveScheduler.HasPendingSpawns())
+        {
+            int32 Spawned = m_WaveScheduler.Tick();
+            m_WaveInfo.EnemiesSpawned += Spawned;
+            m_WaveInfo.EnemiesRemaining += Spawned;
+        }
+
         // Update all objectives
         for (auto& Objective : m_Objectives)
         {
@@ -79,10 +91,11 @@ namespace USS
             return EResult::InvalidState;
         }
 
-        USS_LOG("Starting mission: %s (Type: %d, Difficulty: %d)",
-            Config.MissionName.c_str(),
+        USS_LOG("Starting mission: %s in %s (Type: %d, Difficulty: %d)",
+            Config.BlueprintPath.c_str(),
+            Config.ZoneName.c_str(),
             static_cast<int>(Config.Type),
-            Config.Difficulty);
+            Config.DifficultyLevel);
 
         m_Config = Config;
         m_Score = 0;
@@ -95,6 +108,17 @@ namespace USS
         m_WaveInfo.EnemiesSpawned = 0;
         m_WaveInfo.bIsActive = false;
 
+        // Resolve spawn classes once for the whole mission
+        EResult PrepareResult = m_WaveScheduler.PrepareMission(Config);
+        if (PrepareResult == EResult::NotInitialized)
+        {
+            USS_LOG("No enemy spawner set - waves are left to the game's AI director");
+        }
+        else if (PrepareResult != EResult::Success)
+        {
+            USS_WARN("Wave scheduler has no spawn classes - waves will not spawn enemies");
+        }
+
         // Create default objectives based on mission type
         CreateDefaultObjectives();
 
@@ -193,8 +217,12 @@ namespace USS
         m_WaveInfo.bIsActive = true;
         m_WaveInfo.EnemiesSpawned = 0;
         m_WaveInfo.EnemiesRemaining = 0;
+        m_WaveInfo.EnemiesTotal = m_Config.EnemiesPerWave;
         m_WaveInfo.WaveStartTime = 0.0f;  // Would get from engine
 
+        // Spawns are spread across ticks by the scheduler
+        m_WaveScheduler.EnqueueWave(WaveNumber, m_Config.EnemiesPerWave);
+
         SetState(EMissionState::DefensePhase);
 
         OnMissionEvent("WaveStarted", &m_WaveInfo);
@@ -208,6 +236,7 @@ namespace USS
         USS_LOG("Ending wave %d", m_WaveInfo.CurrentWave);
 
         m_WaveInfo.bIsActive = false;
+        m_WaveScheduler.ClearQueue();
 
         OnMissionEvent("WaveEnded", &m_WaveInfo);
 
@@ -224,6 +253,11 @@ namespace USS
         }
     }
 
+    void FMissionManager::SetEnemySpawner(IEnemySpawner* Spawner)
+    {
+        m_WaveScheduler.SetSpawner(Spawner);
+    }
+
     void FMissionManager::AddScore(int32 Points)
     {
         m_Score += Points;
@@ -8,9 +8,10 @@
 #pragma once
 
 #include "../../Core/Common.h"
-#include "../../Engine/UObject/UObjectWrapper.h"
+#include "../../Engine/UObject/WeakObjectHandle.h"
 #include "MissionTypes.h"
 #include "MissionObjective.h"
+#include "WaveScheduler.h"
 #include <vector>
 #include <memory>
 #include <functional>
@@ -54,6 +55,10 @@ namespace USS
         void StartWave(int32 WaveNumber);
         void EndWave();
         const FWaveInfo& GetWaveInfo() const { return m_WaveInfo; }
+        FWaveScheduler& GetWaveScheduler() { return m_WaveScheduler; }
+
+        // No spawner by default - waves spawn nothing until one is set
+        void SetEnemySpawner(IEnemySpawner* Spawner);
 
         // Scoring
         int32 GetScore() const { return m_Score; }
@@ -81,13 +86,16 @@ namespace USS
         FWaveInfo m_WaveInfo;
         int32 m_Score;
 
+        // Wave spawning
+        FWaveScheduler m_WaveScheduler;
+
         // Objectives
         std::vector<std::unique_ptr<FMissionObjective>> m_Objectives;
 
         // Engine references (cached)
-        UObjectWrapper m_MissionActor;       // AFortMission*
-        UObjectWrapper m_MissionManagerActor; // AFortMissionManager*
-        UObjectWrapper m_AIDirector;         // AFortAIDirector*
+        TWeakObjectHandle<> m_MissionActor;       // AFortMission*
+        TWeakObjectHandle<> m_MissionManagerActor; // AFortMissionManager*
+        TWeakObjectHandle<> m_AIDirector;         // AFortAIDirector*
 
         // Callbacks
         std::vector<FMissionEventCallback> m_EventCallbacks;
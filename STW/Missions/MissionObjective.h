@@ -8,7 +8,7 @@
 #pragma once
 
 #include "../../Core/Common.h"
-#include "../../Engine/UObject/UObjectWrapper.h"
+#include "../../Engine/UObject/WeakObjectHandle.h"
 #include "MissionTypes.h"
 #include <string>
 
@@ -59,7 +59,7 @@ namespace USS
         int32 m_CurrentProgress;
 
         // Cached engine references
-        UObjectWrapper m_ObjectiveActor;  // AFortObjective*
+        TWeakObjectHandle<> m_ObjectiveActor;  // AFortObjective*
     };
 
     // Kill enemies objective
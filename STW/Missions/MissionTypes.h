@@ -138,6 +138,10 @@ namespace USS
         int32 MaxWaves;                 // Alias for WaveCount
         int32 EnemiesPerWave;
 
+        // Spawning
+        std::vector<std::string> SpawnClasses;  // Enemy class paths, empty = default husks
+        float SpawnBudgetMs;                    // Per-tick spawn budget (0 = scheduler default)
+
         FMissionConfig()
             : Type(EMissionType::Unknown)
             , DifficultyLevel(1)
@@ -148,6 +152,7 @@ namespace USS
             , WaveCount(1)
             , MaxWaves(1)
             , EnemiesPerWave(20)
+            , SpawnBudgetMs(0.0f)
         {}
     };
 
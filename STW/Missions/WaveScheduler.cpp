@@ -0,0 +1,185 @@
+/**
+ * UniversalSlashingSimulator - Wave Scheduler Implementation
+ */
+
+#include "WaveScheduler.h"
+#include "../../Core/Diagnostics/Profiler.h"
+#include "../../Core/Logging/Log.h"
+#include <chrono>
+
+namespace USS
+{
+    FWaveScheduler::FWaveScheduler()
+        : m_pSpawner(nullptr)
+        , m_BaseBudgetMs(DefaultBudgetMs)
+        , m_BudgetMs(DefaultBudgetMs)
+        , m_NextClassCursor(0)
+    {
+    }
+
+    void FWaveScheduler::SetSpawner(IEnemySpawner* Spawner)
+    {
+        // Queued requests index the old spawner's classes
+        m_pSpawner = Spawner;
+        m_Queue.clear();
+        m_SpawnClasses.clear();
+        m_Stats.QueueDepth = 0;
+        m_Stats.ResolvedClasses = 0;
+    }
+
+    EResult FWaveScheduler::PrepareMission(const FMissionConfig& Config)
+    {
+        if (!m_pSpawner)
+            return EResult::NotInitialized;
+
+        Reset();
+
+        if (Config.SpawnBudgetMs > 0.0f)
+            m_BudgetMs = Config.SpawnBudgetMs;
+
+        const std::vector<std::string>& ClassPaths =
+            Config.SpawnClasses.empty() ? GetDefaultHuskSpawnClasses() : Config.SpawnClasses;
+
+        m_SpawnClasses.reserve(ClassPaths.size());
+
+        for (const auto& Path : ClassPaths)
+        {
+            void* Class = m_pSpawner->ResolveSpawnClass(Path);
+            if (Class)
+            {
+                m_SpawnClasses.push_back(Class);
+            }
+            else
+            {
+                USS_WARN("Wave scheduler: spawn class not found: %s", Path.c_str());
+            }
+        }
+
+        m_Stats.ResolvedClasses = static_cast<int32>(m_SpawnClasses.size());
+
+        USS_LOG("Wave scheduler prepared: %d/%zu spawn classes, budget %.2f ms/tick",
+            m_Stats.ResolvedClasses, ClassPaths.size(), m_BudgetMs);
+
+        return m_SpawnClasses.empty() ? EResult::Failed : EResult::Success;
+    }
+
+    void FWaveScheduler::Reset()
+    {
+        m_Queue.clear();
+        m_SpawnClasses.clear();
+        m_NextClassCursor = 0;
+        m_BudgetMs = m_BaseBudgetMs;
+        m_Stats.QueueDepth = 0;
+        m_Stats.ResolvedClasses = 0;
+    }
+
+    EResult FWaveScheduler::EnqueueWave(int32 WaveNumber, int32 EnemyCount)
+    {
+        if (EnemyCount <= 0)
+            return EResult::InvalidParameter;
+
+        if (m_SpawnClasses.empty())
+            return EResult::NotInitialized;
+
+        const uint32 NumClasses = static_cast<uint32>(m_SpawnClasses.size());
+
+        for (int32 i = 0; i < EnemyCount; ++i)
+        {
+            FSpawnRequest Request;
+            Request.WaveNumber = WaveNumber;
+            Request.SpawnClassIndex = static_cast<int32>(m_NextClassCursor++ % NumClasses);
+            m_Queue.push_back(Request);
+        }
+
+        m_Stats.QueueDepth = GetQueueDepth();
+        if (m_Stats.QueueDepth > m_Stats.PeakQueueDepth)
+            m_Stats.PeakQueueDepth = m_Stats.QueueDepth;
+
+        USS_LOG("Queued wave %d: %d enemies (queue depth %d)", WaveNumber, EnemyCount, m_Stats.QueueDepth);
+        return EResult::Success;
+    }
+
+    void FWaveScheduler::ClearQueue()
+    {
+        m_Queue.clear();
+        m_Stats.QueueDepth = 0;
+    }
+
+    int32 FWaveScheduler::Tick()
+    {
+        USS_PROFILE_ZONE("WaveScheduler::Tick");
+
+        if (m_Queue.empty() || !m_pSpawner)
+            return 0;
+
+        using FClock = std::chrono::steady_clock;
+
+        const FClock::time_point Start = FClock::now();
+        const auto Budget = std::chrono::duration<double, std::milli>(m_BudgetMs);
+
+        int32 Spawned = 0;
+
+        // Requeued after the loop so a failing spawn isn't retried this tick
+        std::vector<FSpawnRequest> Retries;
+
+        do
+        {
+            FSpawnRequest Request = m_Queue.front();
+            m_Queue.pop_front();
+
+            if (m_pSpawner->SpawnEnemy(m_SpawnClasses[Request.SpawnClassIndex], Request) == EResult::Success)
+            {
+                ++Spawned;
+                ++m_Stats.TotalSpawned;
+            }
+            else if (++Request.Attempts < MaxSpawnAttempts)
+            {
+                ++m_Stats.TotalRetried;
+                Retries.push_back(Request);
+            }
+            else
+            {
+                ++m_Stats.TotalFailed;
+                USS_WARN("Wave %d: dropping spawn after %d failed attempts", Request.WaveNumber, Request.Attempts);
+            }
+        }
+        while (!m_Queue.empty() && (FClock::now() - Start) < Budget);
+
+        m_Queue.insert(m_Queue.end(), Retries.begin(), Retries.end());
+
+        const double ElapsedMs = std::chrono::duration<double, std::milli>(FClock::now() - Start).count();
+
+        m_Stats.QueueDepth = GetQueueDepth();
+        m_Stats.LastTickMs = ElapsedMs;
+        ++m_Stats.TicksWithWork;
+
+        if (ElapsedMs > m_Stats.MaxTickMs)
+            m_Stats.MaxTickMs = ElapsedMs;
+
+        if (ElapsedMs > m_BudgetMs)
+            ++m_Stats.BudgetOverruns;
+
+        return Spawned;
+    }
+
+    void FWaveScheduler::ResetStats()
+    {
+        const int32 ResolvedClasses = m_Stats.ResolvedClasses;
+        m_Stats = FWaveSchedulerStats();
+        m_Stats.ResolvedClasses = ResolvedClasses;
+        m_Stats.QueueDepth = GetQueueDepth();
+    }
+
+    const std::vector<std::string>& GetDefaultHuskSpawnClasses()
+    {
+        static const std::vector<std::string> DefaultClasses = {
+            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn.HuskPawn_C",
+            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Fire.HuskPawn_Fire_C",
+            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Ice.HuskPawn_Ice_C",
+            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Lightning.HuskPawn_Lightning_C",
+            "/Game/Characters/Enemies/Husk/Blueprints/HuskPawn_Dwarf.HuskPawn_Dwarf_C",
+        };
+        return DefaultClasses;
+    }
+
+}
@@ -0,0 +1,162 @@
+/**
+ * UniversalSlashingSimulator - Wave Scheduler
+ *
+ * Turns mission wave definitions into a spawn queue and drains it across
+ * ticks under a per-tick time budget, so a 20+ husk wave does not spawn
+ * in a single frame.
+ *
+ * Spawning itself goes through IEnemySpawner. There is no engine
+ * implementation yet - UWorld::SpawnActor is not resolved - so in game the
+ * scheduler stays idle and the AI director spawns as before; headless
+ * drivers, benchmarks and tests plug in their own spawner.
+ */
+
+#pragma once
+
+#include "../../Core/Common.h"
+#include "MissionTypes.h"
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace USS
+{
+    /**
+     * A single pending enemy spawn
+     */
+    struct FSpawnRequest
+    {
+        int32 WaveNumber;
+        int32 SpawnClassIndex;          // Index into the resolved spawn class list
+        int32 Attempts;                 // Failed spawns so far
+
+        FSpawnRequest()
+            : WaveNumber(0)
+            , SpawnClassIndex(0)
+            , Attempts(0)
+        {}
+    };
+
+    /**
+     * Enemy spawner interface
+     */
+    USS_INTERFACE IEnemySpawner
+    {
+    public:
+        virtual ~IEnemySpawner() = default;
+
+        /**
+         * Resolve a spawn class path to a native UClass* (or any opaque handle)
+         * Called once per class when a mission is prepared.
+         * @return nullptr if the class could not be resolved
+         */
+        virtual void* ResolveSpawnClass(const std::string& ClassPath) = 0;
+
+        /**
+         * Spawn one enemy of a previously resolved class
+         */
+        virtual EResult SpawnEnemy(void* SpawnClass, const FSpawnRequest& Request) = 0;
+    };
+
+    /**
+     * Scheduler statistics
+     */
+    struct FWaveSchedulerStats
+    {
+        int32 QueueDepth;               // Spawns still pending
+        int32 PeakQueueDepth;
+        int32 ResolvedClasses;
+        uint64 TotalSpawned;
+        uint64 TotalRetried;            // Failed spawns put back in the queue
+        uint64 TotalFailed;             // Requests dropped after MaxSpawnAttempts
+        uint64 TicksWithWork;
+        uint64 BudgetOverruns;          // Ticks that ran past the budget
+        double LastTickMs;
+        double MaxTickMs;
+
+        FWaveSchedulerStats()
+            : QueueDepth(0)
+            , PeakQueueDepth(0)
+            , ResolvedClasses(0)
+            , TotalSpawned(0)
+            , TotalRetried(0)
+            , TotalFailed(0)
+            , TicksWithWork(0)
+            , BudgetOverruns(0)
+            , LastTickMs(0.0)
+            , MaxTickMs(0.0)
+        {}
+    };
+
+    /**
+     * Budgeted wave spawn scheduler
+     *
+     * Usage:
+     *   PrepareMission(Config)  - resolve spawn classes once
+     *   EnqueueWave(N, Count)   - queue a wave's spawns
+     *   Tick()                  - spawn as many as the budget allows
+     *
+     * At least one spawn is always performed per tick with pending work so
+     * the queue makes progress even if a single spawn exceeds the budget.
+     * A failed spawn goes to the back of the queue and is retried from the
+     * next tick on, up to MaxSpawnAttempts times.
+     */
+    class FWaveScheduler
+    {
+    public:
+        static constexpr double DefaultBudgetMs = 1.0;
+        static constexpr int32 MaxSpawnAttempts = 3;
+
+        FWaveScheduler();
+        ~FWaveScheduler() = default;
+
+        USS_NON_COPYABLE(FWaveScheduler)
+        USS_NON_MOVABLE(FWaveScheduler)
+
+        // Configuration
+        void SetSpawner(IEnemySpawner* Spawner);
+        IEnemySpawner* GetSpawner() const { return m_pSpawner; }
+        // Budget used when a mission config doesn't set SpawnBudgetMs
+        void SetBudgetMs(double BudgetMs) { m_BaseBudgetMs = m_BudgetMs = BudgetMs; }
+        double GetBudgetMs() const { return m_BudgetMs; }
+
+        // Mission setup
+        EResult PrepareMission(const FMissionConfig& Config);
+
+        // Drops the queue and spawn classes and restores the base budget
+        void Reset();
+
+        // Queue
+        EResult EnqueueWave(int32 WaveNumber, int32 EnemyCount);
+        void ClearQueue();
+        bool HasPendingSpawns() const { return !m_Queue.empty(); }
+        int32 GetQueueDepth() const { return static_cast<int32>(m_Queue.size()); }
+
+        /**
+         * Drain the queue within the per-tick budget
+         * @return Number of enemies spawned this tick
+         */
+        int32 Tick();
+
+        // Stats
+        const FWaveSchedulerStats& GetStats() const { return m_Stats; }
+        void ResetStats();
+
+    private:
+        IEnemySpawner* m_pSpawner;
+        double m_BaseBudgetMs;
+        double m_BudgetMs;
+
+        std::vector<void*> m_SpawnClasses;
+        std::deque<FSpawnRequest> m_Queue;
+        uint32 m_NextClassCursor;
+
+        FWaveSchedulerStats m_Stats;
+    };
+
+    /**
+     * Default husk classes used when a mission config does not list any
+     */
+    const std::vector<std::string>& GetDefaultHuskSpawnClasses();
+
+}
@@ -0,0 +1,274 @@
+/**
+ * UniversalSlashingSimulator - Pawn Native Snapshot Implementation
+ */
+
+#include "PawnSnapshot.h"
+#include "../../Core/Logging/Log.h"
+#include "../../Core/Memory/Memory.h"
+#include "../../Engine/EngineCore.h"
+#include "../../Engine/Reflection/PropertyIterator.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+namespace USS
+{
+    namespace
+    {
+        // Candidate property names, first match wins
+        const char* const HealthNames[]        = { "CurrentHealth", "Health", nullptr };
+        const char* const ShieldNames[]        = { "CurrentShield", "Shield", nullptr };
+        const char* const SprintingNames[]     = { "bIsSprinting", nullptr };
+        const char* const JumpingNames[]       = { "bIsJumping", "bPressedJump", nullptr };
+        const char* const CrouchingNames[]     = { "bIsCrouched", nullptr };
+        const char* const AimingNames[]        = { "bIsTargeting", "bIsAiming", nullptr };
+        const char* const FiringNames[]        = { "bIsFiring", "bIsWeaponFiring", nullptr };
+        const char* const RootComponentNames[] = { "RootComponent", nullptr };
+        const char* const LocationNames[]      = { "RelativeLocation", nullptr };
+        const char* const RotationNames[]      = { "RelativeRotation", nullptr };
+
+        FCriticalSection g_LayoutLock;
+        std::unordered_map<void*, std::unique_ptr<FPawnSnapshotLayout>> g_Layouts;
+    }
+
+    const FPawnSnapshotLayout* FPawnSnapshotLayout::ForClass(void* PawnClass)
+    {
+        if (!PawnClass)
+            return nullptr;
+
+        FScopedLock Lock(g_LayoutLock);
+
+        auto It = g_Layouts.find(PawnClass);
+        if (It != g_Layouts.end())
+            return It->second.get();
+
+        std::unique_ptr<FPawnSnapshotLayout> Layout(new FPawnSnapshotLayout());
+        Layout->Build(PawnClass);
+
+        const FPawnSnapshotLayout* Result = Layout.get();
+        g_Layouts.emplace(PawnClass, std::move(Layout));
+        return Result;
+    }
+
+    void FPawnSnapshotLayout::Build(void* PawnClass)
+    {
+        using namespace EPawnSnapshotField;
+
+        const FFieldRequest PawnRequests[] = {
+            { HealthNames,        offsetof(FPawnNativeSnapshot, Health),        Health,        EFieldType::Float },
+            { ShieldNames,        offsetof(FPawnNativeSnapshot, Shield),        Shield,        EFieldType::Float },
+            { SprintingNames,     offsetof(FPawnNativeSnapshot, bIsSprinting),  Sprinting,     EFieldType::Bool },
+            { JumpingNames,       offsetof(FPawnNativeSnapshot, bIsJumping),    Jumping,       EFieldType::Bool },
+            { CrouchingNames,     offsetof(FPawnNativeSnapshot, bIsCrouching),  Crouching,     EFieldType::Bool },
+            { AimingNames,        offsetof(FPawnNativeSnapshot, bIsAiming),     Aiming,        EFieldType::Bool },
+            { FiringNames,        offsetof(FPawnNativeSnapshot, bIsFiring),     Firing,        EFieldType::Bool },
+            { RootComponentNames, offsetof(FPawnNativeSnapshot, RootComponent), RootComponent, EFieldType::Pointer },
+        };
+
+        const FFieldRequest ComponentRequests[] = {
+            { LocationNames, offsetof(FPawnNativeSnapshot, LocationX),     Location, EFieldType::Vector },
+            { RotationNames, offsetof(FPawnNativeSnapshot, RotationPitch), Rotation, EFieldType::Vector },
+        };
+
+        BuildBlock(PawnClass, PawnRequests, static_cast<int32>(sizeof(PawnRequests) / sizeof(PawnRequests[0])), m_Pawn);
+
+        // Relative transform is declared on USceneComponent, so its offsets
+        // hold for whatever component subclass the root turns out to be
+        void* SceneComponentClass = GetEngineCore().FindClass("SceneComponent").GetRaw();
+        if (SceneComponentClass)
+        {
+            BuildBlock(SceneComponentClass, ComponentRequests,
+                static_cast<int32>(sizeof(ComponentRequests) / sizeof(ComponentRequests[0])), m_Component);
+        }
+
+        USS_LOG("Pawn snapshot layout for %s: %zu pawn fields, %zu component fields, %d spans",
+            GetEngineCore().GetObjectName(PawnClass).c_str(),
+            m_Pawn.Fields.size(), m_Component.Fields.size(), GetSpanCount());
+    }
+
+    void FPawnSnapshotLayout::BuildBlock(void* Struct, const FFieldRequest* Requests, int32 NumRequests, FBlock& OutBlock)
+    {
+        IPropertyIterator& Iterator = GetPropertyIterator();
+
+        for (int32 i = 0; i < NumRequests; ++i)
+        {
+            const FFieldRequest& Request = Requests[i];
+
+            FPropertyInfo Info;
+            bool bFound = false;
+
+            for (const char* const* Name = Request.Names; *Name && !bFound; ++Name)
+            {
+                bFound = Iterator.FindProperty(Struct, *Name, Info);
+            }
+
+            if (!bFound || Info.ElementSize <= 0 || Info.ElementSize > MaxSpanSize)
+                continue;
+
+            FField Field;
+            Field.SourceOffset = Info.Offset;
+            Field.Size = Info.ElementSize;
+            Field.DestOffset = Request.DestOffset;
+            Field.PresentBit = Request.PresentBit;
+            Field.Type = Request.Type;
+            Field.ByteMask = 0xFF;
+
+            // Bitfield bools share a byte with their neighbours - read only
+            // the property's own bit
+            if (Request.Type == EFieldType::Bool && Info.Type == EPropertyType::BoolProperty && Info.BoolFieldMask != 0)
+            {
+                Field.SourceOffset = Info.Offset + Info.BoolByteOffset;
+                Field.Size = 1;
+                Field.ByteMask = Info.BoolFieldMask;
+            }
+
+            OutBlock.Fields.push_back(Field);
+        }
+
+        std::sort(OutBlock.Fields.begin(), OutBlock.Fields.end(),
+            [](const FField& A, const FField& B) { return A.SourceOffset < B.SourceOffset; });
+
+        // Merge neighbouring fields into as few copies as the limits allow
+        for (int32 i = 0; i < static_cast<int32>(OutBlock.Fields.size()); ++i)
+        {
+            const FField& Field = OutBlock.Fields[i];
+            int32 FieldEnd = Field.SourceOffset + Field.Size;
+
+            if (!OutBlock.Spans.empty())
+            {
+                FSpan& Last = OutBlock.Spans.back();
+                int32 LastEnd = Last.Begin + Last.Size;
+
+                if (Field.SourceOffset - LastEnd <= MaxSpanGap &&
+                    std::max(FieldEnd, LastEnd) - Last.Begin <= MaxSpanSize)
+                {
+                    Last.Size = std::max(FieldEnd, LastEnd) - Last.Begin;
+                    ++Last.NumFields;
+                    continue;
+                }
+            }
+
+            FSpan Span;
+            Span.Begin = Field.SourceOffset;
+            Span.Size = Field.Size;
+            Span.FirstField = i;
+            Span.NumFields = 1;
+            OutBlock.Spans.push_back(Span);
+        }
+    }
+
+    bool FPawnSnapshotLayout::Capture(void* Pawn, FPawnNativeSnapshot& OutSnapshot) const
+    {
+        OutSnapshot = FPawnNativeSnapshot();
+
+        if (!Pawn || m_Pawn.Spans.empty())
+            return false;
+
+        if (!CaptureBlock(m_Pawn, Pawn, OutSnapshot))
+            return false;
+
+        // Transform is optional - a pawn without a root still has state
+        if (OutSnapshot.RootComponent && !m_Component.Spans.empty())
+        {
+            CaptureBlock(m_Component, OutSnapshot.RootComponent, OutSnapshot);
+        }
+
+        return true;
+    }
+
+    bool FPawnSnapshotLayout::CaptureBlock(const FBlock& Block, void* Object, FPawnNativeSnapshot& OutSnapshot)
+    {
+        uint8 Buffer[MaxSpanSize];
+        uintptr Base = reinterpret_cast<uintptr>(Object);
+
+        for (const FSpan& Span : Block.Spans)
+        {
+            if (!Memory::ReadBytes(Base + Span.Begin, Buffer, static_cast<size_t>(Span.Size)))
+                return false;
+
+            for (int32 i = Span.FirstField; i < Span.FirstField + Span.NumFields; ++i)
+            {
+                const FField& Field = Block.Fields[i];
+                DecodeField(Field, Buffer + (Field.SourceOffset - Span.Begin), OutSnapshot);
+            }
+        }
+
+        return true;
+    }
+
+    void FPawnSnapshotLayout::DecodeField(const FField& Field, const uint8* Source, FPawnNativeSnapshot& OutSnapshot)
+    {
+        uint8* Dest = reinterpret_cast<uint8*>(&OutSnapshot) + Field.DestOffset;
+
+        switch (Field.Type)
+        {
+        case EFieldType::Float:
+        {
+            float Value = 0.0f;
+            if (Field.Size == sizeof(double))
+            {
+                double Wide;
+                memcpy(&Wide, Source, sizeof(Wide));
+                Value = static_cast<float>(Wide);
+            }
+            else if (Field.Size == sizeof(float))
+            {
+                memcpy(&Value, Source, sizeof(Value));
+            }
+            else
+            {
+                return;
+            }
+
+            memcpy(Dest, &Value, sizeof(Value));
+            break;
+        }
+
+        case EFieldType::Bool:
+        {
+            bool Value = (Source[0] & Field.ByteMask) != 0;
+            memcpy(Dest, &Value, sizeof(Value));
+            break;
+        }
+
+        case EFieldType::Vector:
+        {
+            // FVector/FRotator - float components pre-LWC, double after
+            float Value[3];
+            if (Field.Size == 3 * sizeof(double))
+            {
+                double Wide[3];
+                memcpy(Wide, Source, sizeof(Wide));
+                for (int32 i = 0; i < 3; ++i)
+                    Value[i] = static_cast<float>(Wide[i]);
+            }
+            else if (Field.Size == 3 * sizeof(float))
+            {
+                memcpy(Value, Source, sizeof(Value));
+            }
+            else
+            {
+                return;
+            }
+
+            memcpy(Dest, Value, sizeof(Value));
+            break;
+        }
+
+        case EFieldType::Pointer:
+        {
+            if (Field.Size != sizeof(void*))
+                return;
+
+            memcpy(Dest, Source, sizeof(void*));
+            break;
+        }
+
+        default:
+            return;
+        }
+
+        OutSnapshot.PresentMask |= Field.PresentBit;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+/**
+ * UniversalSlashingSimulator - Pawn Native Snapshot
+ *
+ * Batched read of the native pawn state FSTWPlayerPawn mirrors each tick.
+ * A layout is resolved once per pawn class from reflection: every field
+ * the pawn needs is located by name, then neighbouring fields are merged
+ * into a few contiguous spans. Capturing a pawn is then one bulk copy per
+ * span (pawn + root component) decoded into a packed POD snapshot, which
+ * also means all fields come from the same moment instead of being read
+ * one at a time.
+ */
+
+#pragma once
+
+#include "../../Core/Common.h"
+#include <vector>
+
+namespace USS
+{
+    /**
+     * Which snapshot fields were captured (FPawnNativeSnapshot::PresentMask)
+     */
+    namespace EPawnSnapshotField
+    {
+        constexpr uint32 Health        = 1 << 0;
+        constexpr uint32 Shield        = 1 << 1;
+        constexpr uint32 Location      = 1 << 2;
+        constexpr uint32 Rotation      = 1 << 3;
+        constexpr uint32 Sprinting     = 1 << 4;
+        constexpr uint32 Jumping       = 1 << 5;
+        constexpr uint32 Crouching     = 1 << 6;
+        constexpr uint32 Aiming        = 1 << 7;
+        constexpr uint32 Firing        = 1 << 8;
+        constexpr uint32 RootComponent = 1 << 9;
+    }
+
+    /**
+     * Packed per-pawn state, filled by FPawnSnapshotLayout::Capture
+     */
+    struct FPawnNativeSnapshot
+    {
+        uint32 PresentMask;
+
+        float Health;
+        float Shield;
+
+        float LocationX, LocationY, LocationZ;
+        float RotationPitch, RotationYaw, RotationRoll;
+
+        bool bIsSprinting;
+        bool bIsJumping;
+        bool bIsCrouching;
+        bool bIsAiming;
+        bool bIsFiring;
+
+        void* RootComponent;
+
+        FPawnNativeSnapshot()
+            : PresentMask(0)
+            , Health(0.0f)
+            , Shield(0.0f)
+            , LocationX(0.0f), LocationY(0.0f), LocationZ(0.0f)
+            , RotationPitch(0.0f), RotationYaw(0.0f), RotationRoll(0.0f)
+            , bIsSprinting(false)
+            , bIsJumping(false)
+            , bIsCrouching(false)
+            , bIsAiming(false)
+            , bIsFiring(false)
+            , RootComponent(nullptr)
+        {}
+
+        bool Has(uint32 Field) const { return (PresentMask & Field) != 0; }
+    };
+
+    /**
+     * Resolved read plan for one pawn class
+     *
+     * Layouts are immutable once built, so Capture is safe to call from
+     * worker threads concurrently.
+     */
+    class FPawnSnapshotLayout
+    {
+    public:
+        // Fields further apart than this start a new span
+        static constexpr int32 MaxSpanGap = 256;
+        // Largest single copy (bounded so the scratch buffer lives on the stack)
+        static constexpr int32 MaxSpanSize = 2048;
+
+        /**
+         * Get (building on first use) the layout for a pawn class
+         * Call from the game thread; returns nullptr for a null class.
+         */
+        static const FPawnSnapshotLayout* ForClass(void* PawnClass);
+
+        /**
+         * Read Pawn into OutSnapshot
+         * @return false if the pawn block couldn't be read at all
+         */
+        bool Capture(void* Pawn, FPawnNativeSnapshot& OutSnapshot) const;
+
+        bool IsEmpty() const { return m_Pawn.Fields.empty(); }
+        int32 GetSpanCount() const { return static_cast<int32>(m_Pawn.Spans.size() + m_Component.Spans.size()); }
+
+    private:
+        enum class EFieldType : uint8
+        {
+            Float,      // float or double, by Size
+            Bool,       // byte & ByteMask
+            Vector,     // FVector / FRotator, float or double components
+            Pointer
+        };
+
+        struct FField
+        {
+            int32 SourceOffset;
+            int32 Size;
+            uint32 DestOffset;  // offsetof within FPawnNativeSnapshot
+            uint32 PresentBit;
+            EFieldType Type;
+            uint8 ByteMask;
+        };
+
+        struct FSpan
+        {
+            int32 Begin;
+            int32 Size;
+            int32 FirstField;
+            int32 NumFields;
+        };
+
+        struct FBlock
+        {
+            std::vector<FField> Fields;     // Sorted by SourceOffset
+            std::vector<FSpan> Spans;
+        };
+
+        struct FFieldRequest
+        {
+            const char* const* Names;       // Candidate property names, null-terminated
+            uint32 DestOffset;
+            uint32 PresentBit;
+            EFieldType Type;
+        };
+
+        FPawnSnapshotLayout() = default;
+
+        void Build(void* PawnClass);
+        static void BuildBlock(void* Struct, const FFieldRequest* Requests, int32 NumRequests, FBlock& OutBlock);
+        static bool CaptureBlock(const FBlock& Block, void* Object, FPawnNativeSnapshot& OutSnapshot);
+        static void DecodeField(const FField& Field, const uint8* Source, FPawnNativeSnapshot& OutSnapshot);
+
+        FBlock m_Pawn;
+        FBlock m_Component;     // Read through the captured RootComponent
+    };
+
+}
\ No newline at end of file
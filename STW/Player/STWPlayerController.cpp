@@ -4,7 +4,11 @@
 
 #include "STWPlayerController.h"
 #include "STWPlayerPawn.h"
+#include "../Inventory/InventoryManager.h"
+#include "../Building/BuildingManager.h"
+#include "../../Core/Diagnostics/Profiler.h"
 #include "../../Core/Logging/Log.h"
+#include "../../Core/Threading/WorkerPool.h"
 #include "../../Engine/EngineCore.h"
 
 namespace USS
@@ -33,14 +37,56 @@ namespace USS
         if (IsValid())
         {
             UpdateFromNative();
+
+            m_pInventoryManager = std::make_unique<FInventoryManager>();
+            m_pBuildingManager = std::make_unique<FBuildingManager>();
+
+            if (m_pInventoryManager->Initialize(InController) != EResult::Success)
+            {
+                USS_WARN("Inventory manager initialization incomplete for %p", InController);
+            }
+
+            if (m_pBuildingManager->Initialize(m_pInventoryManager.get()) != EResult::Success)
+            {
+                USS_WARN("Building manager initialization incomplete for %p", InController);
+            }
         }
     }
 
     FSTWPlayerController::~FSTWPlayerController()
     {
+        // Building holds a raw pointer into the inventory
+        m_pBuildingManager.reset();
+        m_pInventoryManager.reset();
         m_pPawn.reset();
     }
 
+    void FSTWPlayerController::Update()
+    {
+        float DeltaTime = 1.0f / 30.0f;  // Placeholder
+        PrepareUpdate(DeltaTime);
+        ApplyUpdate();
+    }
+
+    void FSTWPlayerController::PrepareUpdate(float DeltaTime)
+    {
+        if (m_pPawn)
+            m_pPawn->PrepareUpdate(DeltaTime);
+    }
+
+    void FSTWPlayerController::ApplyUpdate()
+    {
+        if (m_pPawn)
+            m_pPawn->ApplyUpdate();
+
+        // Managers can raise change events, so they stay on the serial side
+        if (m_pInventoryManager)
+            m_pInventoryManager->Update();
+
+        if (m_pBuildingManager)
+            m_pBuildingManager->Update();
+    }
+
     bool FSTWPlayerController::IsValid() const
     {
         return m_Controller.IsValid();
@@ -175,6 +221,9 @@ namespace USS
             m_bInBuildMode = true;
             USS_LOG("Entering build mode");
             // TODO: Set building mode state on controller
+
+            if (m_pBuildingManager)
+                m_pBuildingManager->EnterBuildMode(EBuildingType::Wall);
         }
     }
 
@@ -184,6 +233,9 @@ namespace USS
         {
             m_bInBuildMode = false;
             USS_LOG("Exiting build mode");
+
+            if (m_pBuildingManager)
+                m_pBuildingManager->ExitBuildMode();
         }
     }
 
@@ -229,6 +281,15 @@ namespace USS
         // Handle controller-specific events
 		// // prefferrably avoid PE where possible
         // TODO: Check function name and dispatch
+
+        // Forward to this player's managers
+        void* Controller = GetNative();
+
+        if (m_pInventoryManager)
+            m_pInventoryManager->OnProcessEvent(Controller, Function, Params);
+
+        if (m_pBuildingManager)
+            m_pBuildingManager->OnProcessEvent(Controller, Function, Params);
     }
 
     void FSTWPlayerController::UpdateFromNative()
@@ -245,10 +306,9 @@ namespace USS
     // FPlayerControllerManager
     // ========================================================================
 
-    FPlayerControllerManager& FPlayerControllerManager::Get()
+    FPlayerControllerManager::FPlayerControllerManager()
+        : m_ParallelThreshold(DefaultParallelThreshold)
     {
-        static FPlayerControllerManager Instance;
-        return Instance;
     }
 
     EResult FPlayerControllerManager::Initialize()
@@ -261,17 +321,56 @@ namespace USS
     void FPlayerControllerManager::Shutdown()
     {
         USS_LOG("Shutting down Player Controller Manager");
+        m_UpdateList.clear();
         m_Players.clear();
     }
 
     void FPlayerControllerManager::Update()
     {
-        // Update all player controllers
+        USS_PROFILE_ZONE("PlayerControllerManager::Update");
+
+        float DeltaTime = 1.0f / 30.0f;  // Placeholder
+
+        m_UpdateList.clear();
         for (auto& Pair : m_Players)
         {
-            if (Pair.second && Pair.second->HasPawn())
+            if (Pair.second)
+            {
+                m_UpdateList.push_back(Pair.second.get());
+            }
+        }
+
+        int32 Count = static_cast<int32>(m_UpdateList.size());
+
+        // Phase 1: read native state + compute, independent per player
+        {
+            USS_PROFILE_ZONE("Players::Prepare");
+
+            if (Count >= m_ParallelThreshold)
             {
-                Pair.second->GetPawn()->Update();
+                GetWorkerPool().ParallelFor(Count, [this, DeltaTime](int32 Index)
+                {
+                    USS_PROFILE_ZONE("Player::PrepareUpdate");
+                    m_UpdateList[Index]->PrepareUpdate(DeltaTime);
+                });
+            }
+            else
+            {
+                for (FSTWPlayerController* Player : m_UpdateList)
+                {
+                    USS_PROFILE_ZONE("Player::PrepareUpdate");
+                    Player->PrepareUpdate(DeltaTime);
+                }
+            }
+        }
+
+        // Phase 2: commit side effects on the calling thread
+        {
+            USS_PROFILE_ZONE("Players::Apply");
+
+            for (FSTWPlayerController* Player : m_UpdateList)
+            {
+                Player->ApplyUpdate();
             }
         }
     }
@@ -394,4 +493,14 @@ namespace USS
         UnregisterPlayer(Controller);
     }
 
+    bool FPlayerControllerManager::OnProcessEvent(void* Object, void* Function, void* Params)
+    {
+        FSTWPlayerController* Player = GetPlayer(Object);
+        if (!Player)
+            return false;
+
+        Player->OnProcessEvent(Function, Params);
+        return true;
+    }
+
 }
\ No newline at end of file
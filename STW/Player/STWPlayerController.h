@@ -3,12 +3,16 @@
  *
  * Wrapper for AFortPlayerController with STW-specific functionality.
  * Handles player input, abilities, and communication with server.
+ *
+ * Each controller owns its player's inventory and building managers;
+ * FPlayerControllerManager routes ProcessEvents to them by controller
+ * pointer.
  */
 
 #pragma once
 
 #include "../../Core/Common.h"
-#include "../../Engine/UObject/UObjectWrapper.h"
+#include "../../Engine/UObject/WeakObjectHandle.h"
 #include <string>
 #include <vector>
 
@@ -17,6 +21,7 @@ namespace USS
     // Forward declarations
     class FSTWPlayerPawn;
     class FInventoryManager;
+    class FBuildingManager;
 
     // Player state for STW
     enum class EPlayerReadyState : uint8
@@ -70,6 +75,17 @@ namespace USS
         std::string GetPlayerName() const;
         std::string GetPlayerId() const;
 
+        // Per-player managers (null for an invalid controller)
+        FInventoryManager* GetInventoryManager() const { return m_pInventoryManager.get(); }
+        FBuildingManager* GetBuildingManager() const { return m_pBuildingManager.get(); }
+
+        // Called each tick
+        void Update();  // PrepareUpdate() + ApplyUpdate()
+
+        // Split tick - see FPlayerControllerManager::Update
+        void PrepareUpdate(float DeltaTime);
+        void ApplyUpdate();
+
         // Pawn management
         FSTWPlayerPawn* GetPawn() const;
         void SetPawn(void* InPawn);
@@ -115,9 +131,13 @@ namespace USS
     private:
         void UpdateFromNative();
 
-        UObjectWrapper m_Controller;  // AFortPlayerController*
+        TWeakObjectHandle<> m_Controller;  // AFortPlayerController*
         std::unique_ptr<FSTWPlayerPawn> m_pPawn;
 
+        // Owned managers - building consumes from this player's inventory
+        std::unique_ptr<FInventoryManager> m_pInventoryManager;
+        std::unique_ptr<FBuildingManager> m_pBuildingManager;
+
         // Cached state
         EPlayerReadyState m_ReadyState;
         int32 m_TeamIndex;
@@ -129,11 +149,19 @@ namespace USS
         mutable bool m_bInfoDirty;
     };
 
-    // Player controller manager - tracks all connected players
+    /**
+     * Player controller manager - tracks all players in one mission instance
+     *
+     * Update() runs in two phases: every player's PrepareUpdate (native
+     * reads and per-player timers), then ApplyUpdate, which commits state
+     * changes and fires events serially on the calling thread. The prepare
+     * phase moves to the worker pool only from m_ParallelThreshold players.
+     */
     class FPlayerControllerManager
     {
     public:
-        static FPlayerControllerManager& Get();
+        FPlayerControllerManager();
+        ~FPlayerControllerManager() = default;
 
         USS_NON_COPYABLE(FPlayerControllerManager)
         USS_NON_MOVABLE(FPlayerControllerManager)
@@ -143,10 +171,22 @@ namespace USS
         void Shutdown();
         void Update();
 
+        /**
+         * USSBench PlayerUpdate vs PlayerUpdateParallel: a player's whole
+         * update is ~30 ns, a pool handoff ~11 us, so inline wins until
+         * a few hundred players - every STW instance (4 players) stays
+         * inline, and zones ticked from several threads don't queue on
+         * the pool's single submit lock
+         */
+        static constexpr int32 DefaultParallelThreshold = 256;
+
+        // Below this many players the prepare phase runs inline
+        void SetParallelThreshold(int32 Threshold) { m_ParallelThreshold = Threshold; }
+
         // Player management
         FSTWPlayerController* RegisterPlayer(void* Controller);
         void UnregisterPlayer(void* Controller);
-        FSTWPlayerController* GetPlayer(void* Controller) const;
+        FSTWPlayerController* GetPlayer(void* Controller) const;  // O(1)
         FSTWPlayerController* GetPlayerById(const char* PlayerId) const;
 
         // Iteration
@@ -175,16 +215,18 @@ namespace USS
         void OnPlayerJoined(void* Controller);
         void OnPlayerLeft(void* Controller);
 
-    private:
-        FPlayerControllerManager() = default;
-        ~FPlayerControllerManager() = default;
+        /**
+         * Forward a ProcessEvent to the player owning Object
+         * @return true if Object is a registered controller
+         */
+        bool OnProcessEvent(void* Object, void* Function, void* Params);
 
+    private:
         std::unordered_map<void*, std::unique_ptr<FSTWPlayerController>> m_Players;
-    };
 
-    inline FPlayerControllerManager& GetPlayerControllerManager()
-    {
-        return FPlayerControllerManager::Get();
-    }
+        // Per-tick snapshot of m_Players, reused to avoid reallocating
+        std::vector<FSTWPlayerController*> m_UpdateList;
+        int32 m_ParallelThreshold;
+    };
 
 }
\ No newline at end of file
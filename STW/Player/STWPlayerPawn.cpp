@@ -3,12 +3,15 @@
  */
 
 #include "STWPlayerPawn.h"
+#include "PawnSnapshot.h"
 #include "../../Core/Logging/Log.h"
+#include "../../Engine/EngineCore.h"
 
 namespace USS
 {
     FSTWPlayerPawn::FSTWPlayerPawn()
-        : m_State(EPawnState::None)
+        : m_pSnapshotLayout(nullptr)
+        , m_State(EPawnState::None)
         , m_CurrentHealth(100.0f)
         , m_CurrentShield(0.0f)
         , m_HeroClass(EHeroClass::Soldier)
@@ -20,6 +23,7 @@ namespace USS
         , m_bIsFiring(false)
         , m_DBNOTimer(0.0f)
         , m_DBNOMaxTime(20.0f)
+        , m_bPendingDBNOExpired(false)
         , m_LocationX(0.0f)
         , m_LocationY(0.0f)
         , m_LocationZ(0.0f)
@@ -32,10 +36,14 @@ namespace USS
     FSTWPlayerPawn::FSTWPlayerPawn(void* InPawn)
         : FSTWPlayerPawn()
     {
-        m_Pawn = UObjectWrapper(InPawn);
+        m_Pawn = TWeakObjectHandle<>(InPawn);
 
         if (IsValid())
         {
+            // Resolved here, on the game thread, so the parallel
+            // PrepareUpdate only ever reads the shared layout
+            m_pSnapshotLayout = FPawnSnapshotLayout::ForClass(GetEngineCore().GetObjectClass(InPawn));
+
             m_State = EPawnState::Alive;
             UpdateFromNative();
         }
@@ -52,6 +60,15 @@ namespace USS
 
     void FSTWPlayerPawn::Update()
     {
+        float DeltaTime = 1.0f / 30.0f;  // Placeholder
+        PrepareUpdate(DeltaTime);
+        ApplyUpdate();
+    }
+
+    void FSTWPlayerPawn::PrepareUpdate(float DeltaTime)
+    {
+        m_bPendingDBNOExpired = false;
+
         if (!IsValid())
             return;
 
@@ -59,14 +76,27 @@ namespace USS
         UpdateFromNative();
 
         // Update ability cooldowns
-        float DeltaTime = 1.0f / 30.0f;  // Placeholder
         UpdateAbilityCooldowns(DeltaTime);
 
-        // Update DBNO timer
+        // Update DBNO timer - the transition itself is deferred
         if (m_State == EPawnState::DBNO)
         {
             m_DBNOTimer -= DeltaTime;
             if (m_DBNOTimer <= 0.0f)
+            {
+                m_bPendingDBNOExpired = true;
+            }
+        }
+    }
+
+    void FSTWPlayerPawn::ApplyUpdate()
+    {
+        if (m_bPendingDBNOExpired)
+        {
+            m_bPendingDBNOExpired = false;
+
+            // Could have been revived between prepare and apply
+            if (m_State == EPawnState::DBNO)
             {
                 Die();
             }
@@ -347,7 +377,7 @@ namespace USS
 
     void FSTWPlayerPawn::OnDamageReceived(float Damage, void* DamageCauser)
     {
-        USS_LOG("Damage received: %.1f, health: %.1f, shield: %.1f",
+        USS_LOG_RATE(20, "Damage received: %.1f, health: %.1f, shield: %.1f",
             Damage, m_CurrentHealth, m_CurrentShield);
     }
 
@@ -371,11 +401,56 @@ namespace USS
         if (!IsValid())
             return;
 
-        // TODO: Read actual values from engine pawn
-        // m_CurrentHealth = Read health from pawn
-        // m_CurrentShield = Read shield from pawn
-        // Read location/rotation
-        // Read movement state
+        if (!m_pSnapshotLayout)
+            return;
+
+        // One bulk copy per span instead of a Memory::Read per field
+        FPawnNativeSnapshot Snapshot;
+        if (m_pSnapshotLayout->Capture(GetNative(), Snapshot))
+        {
+            ApplySnapshot(Snapshot);
+        }
+    }
+
+    void FSTWPlayerPawn::ApplySnapshot(const FPawnNativeSnapshot& Snapshot)
+    {
+        using namespace EPawnSnapshotField;
+
+        // Fields the layout couldn't resolve keep their cached values
+        if (Snapshot.Has(Health))
+            m_CurrentHealth = Snapshot.Health;
+
+        if (Snapshot.Has(Shield))
+            m_CurrentShield = Snapshot.Shield;
+
+        if (Snapshot.Has(Location))
+        {
+            m_LocationX = Snapshot.LocationX;
+            m_LocationY = Snapshot.LocationY;
+            m_LocationZ = Snapshot.LocationZ;
+        }
+
+        if (Snapshot.Has(Rotation))
+        {
+            m_RotationPitch = Snapshot.RotationPitch;
+            m_RotationYaw = Snapshot.RotationYaw;
+            m_RotationRoll = Snapshot.RotationRoll;
+        }
+
+        if (Snapshot.Has(Sprinting))
+            m_bIsSprinting = Snapshot.bIsSprinting;
+
+        if (Snapshot.Has(Jumping))
+            m_bIsJumping = Snapshot.bIsJumping;
+
+        if (Snapshot.Has(Crouching))
+            m_bIsCrouching = Snapshot.bIsCrouching;
+
+        if (Snapshot.Has(Aiming))
+            m_bIsAiming = Snapshot.bIsAiming;
+
+        if (Snapshot.Has(Firing))
+            m_bIsFiring = Snapshot.bIsFiring;
     }
 
     void FSTWPlayerPawn::UpdateState()
@@ -8,7 +8,7 @@
 #pragma once
 
 #include "../../Core/Common.h"
-#include "../../Engine/UObject/UObjectWrapper.h"
+#include "../../Engine/UObject/WeakObjectHandle.h"
 #include <string>
 
 namespace USS
@@ -84,6 +84,9 @@ namespace USS
         {}
     };
 
+    class FPawnSnapshotLayout;
+    struct FPawnNativeSnapshot;
+
     // STW Player Pawn wrapper
     class FSTWPlayerPawn
     {
@@ -99,7 +102,16 @@ namespace USS
         void* GetNative() const { return m_Pawn.GetRaw(); }
 
         // Update
-        void Update();
+        void Update();  // PrepareUpdate() + ApplyUpdate()
+
+        /**
+         * Split update for the parallel player tick. PrepareUpdate only
+         * reads native state and advances this pawn's own timers, so it
+         * may run on a worker; ApplyUpdate commits state transitions and
+         * fires events and must run on the game thread.
+         */
+        void PrepareUpdate(float DeltaTime);
+        void ApplyUpdate();
 
         // State
         EPawnState GetState() const { return m_State; }
@@ -170,9 +182,11 @@ namespace USS
 
     private:
         void UpdateFromNative();
+        void ApplySnapshot(const FPawnNativeSnapshot& Snapshot);
         void UpdateState();
 
-        UObjectWrapper m_Pawn;  // AFortPlayerPawn*
+        TWeakObjectHandle<> m_Pawn;  // AFortPlayerPawn*
+        const FPawnSnapshotLayout* m_pSnapshotLayout;  // Shared per pawn class
 
         // State
         EPawnState m_State;
@@ -201,6 +215,9 @@ namespace USS
         float m_DBNOTimer;
         float m_DBNOMaxTime;
 
+        // Set by PrepareUpdate, consumed by ApplyUpdate
+        bool m_bPendingDBNOExpired;
+
         // Cached position (updated each frame)
         float m_LocationX, m_LocationY, m_LocationZ;
         float m_RotationPitch, m_RotationYaw, m_RotationRoll;
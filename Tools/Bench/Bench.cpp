@@ -0,0 +1,1123 @@
+/**
+ * UniversalSlashingSimulator - Micro-Benchmark Suite
+ *
+ * Times the Engine/ and STW/ hot paths at several input sizes each. Like
+ * Google Benchmark, every case/size pair is rerun with a growing
+ * iteration count until one run lasts at least -min-time, and that run
+ * is the one reported. Engine cases read a mock engine image through the
+ * real readers, so the suite runs on Linux as well as Windows.
+ *
+ *   PatternScan            Memory::FindPattern over N bytes, match at the end
+ *   NameDecode             FName -> string with N names in the pool
+ *   ObjectIteration        ForEachObject over N objects
+ *   FindClass              FEngineCore::FindClass, target last of N objects
+ *   FindObject             FEngineCore::FindObjectByName, target last of N
+ *   FullNameDump           full name of each of N objects nested in packages,
+ *                          cache already warm
+ *   FindObjectByPath       FEngineCore::FindObject by full name, last of N
+ *   PropertyLookup         IPropertyIterator::FindProperty, last of N
+ *   DispatchReject         ProcessEvent dispatch, N handlers, none match
+ *   DispatchMatch          the same with the last handler matching, so the
+ *                          parameters get parsed
+ *   FastArrayDetect        FFastArrayChangeDetector, one change in N items
+ *   BuildingPlaceDestroy   place and demolish one piece beside N others
+ *   TrapUpdate             FBuildingManager::Update with N armed traps
+ *   InventoryAddConsume    stack and consume one round beside N other stacks
+ *   PlayerUpdate           FPlayerControllerManager::Update, N players,
+ *                          prepare phase inline
+ *   PlayerUpdateParallel   the same with the prepare phase on the worker
+ *                          pool (3 workers even on a single-core host)
+ *
+ * With -snapshot, three more cases replay the N objects of a snapshot
+ * taken in a live game with -USS_DumpObjects:
+ *
+ *   SnapshotIteration      ForEachObject
+ *   SnapshotFindClass      FEngineCore::FindClass, the last class
+ *   SnapshotFindObject     FEngineCore::FindObjectByName, the last object
+ *
+ * Usage:
+ *   USSBench [-filter Text] [-min-time Ms] [-cl CL] [-snapshot File] [-json File.json]
+ *   USSBench [-cl CL] -save-snapshot File
+ *
+ * -save-snapshot captures a mock image of SaveSnapshotObjects filler
+ * objects to File and exits, so the snapshot cases can be exercised
+ * without a game to dump from.
+ *
+ * -cl picks the engine layout the mock image is built with; a snapshot
+ * brings its own and overrides it. -json writes every result along with
+ * that layout, for comparing builds over time; the console table is
+ * printed either way.
+ */
+
+#include "../MockEngine/MockEngineImage.h"
+#include "../../Core/Diagnostics/Profiler.h"
+#include "../../Core/Memory/Memory.h"
+#include "../../Core/Threading/WorkerPool.h"
+#include "../../Core/Versioning/VersionResolver.h"
+#include "../../Engine/EngineCore.h"
+#include "../../Engine/Events/ProcessEventDispatcher.h"
+#include "../../Engine/Reflection/PropertyIterator.h"
+#include "../../Engine/Replication/FastArraySerializer.h"
+#include "../../Engine/Snapshot/ObjectSnapshot.h"
+#include "../../Engine/UObject/ObjectPathCache.h"
+#include "../../STW/Building/BuildingManager.h"
+#include "../../STW/Inventory/InventoryManager.h"
+#include "../../STW/Player/STWPlayerController.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <limits>
+#include <random>
+#include <thread>
+
+using namespace USS;
+
+namespace
+{
+    struct FBenchOptions
+    {
+        std::string Filter;
+        double MinTimeMs = 200.0;
+        uint32 CL = 9141206;            // FN 15.0 - FNamePool, chunked GObjects, FField
+        std::string SnapshotPath;
+        std::string SaveSnapshotPath;
+        std::string JsonPath;
+    };
+
+    // Results are folded in here so the optimizer can't drop the work
+    volatile uint64 g_Sink = 0;
+
+    //=========================================================================
+    // Harness
+    //=========================================================================
+
+    // Runs the operation under test Iterations times
+    using FBenchBody = std::function<void(int64 Iterations)>;
+
+    struct FBenchCase
+    {
+        const char* Name;
+        std::vector<int32> Sizes;
+        bool bTouchesAllItems;          // One iteration processes all N items
+
+        // Builds the state for one size; the body owns it. Returns an
+        // empty body if the state couldn't be built or failed a check
+        std::function<FBenchBody(int32 Size)> Setup;
+    };
+
+    struct FBenchResult
+    {
+        std::string Name;
+        int32 Size = 0;
+        int64 Iterations = 0;
+        double NsPerOp = 0.0;
+        double CyclesPerOp = 0.0;
+        double ItemsPerSecond = 0.0;
+    };
+
+    bool RunCase(const FBenchCase& Case, int32 Size, double MinTimeMs, FBenchResult& OutResult)
+    {
+        FBenchBody Body = Case.Setup(Size);
+        if (!Body)
+            return false;
+
+        using FClock = std::chrono::steady_clock;
+        const double MinTimeNs = MinTimeMs * 1e6;
+        constexpr int64 MaxIterations = 1000000000;
+
+        // Each run doubles as the warm-up for the next
+        int64 Iterations = 1;
+        double Ns = 0.0;
+        uint64 Cycles = 0;
+
+        for (;;)
+        {
+            const FClock::time_point Start = FClock::now();
+            const uint64 StartCycles = FProfiler::ReadCycles();
+
+            Body(Iterations);
+
+            Cycles = FProfiler::ReadCycles() - StartCycles;
+            Ns = std::chrono::duration<double, std::nano>(FClock::now() - Start).count();
+
+            if (Ns >= MinTimeNs || Iterations >= MaxIterations)
+                break;
+
+            // Aim past the target so the next run usually lands; grow
+            // at most 10x when this run was too short to predict from
+            double Multiplier = 10.0;
+            if (Ns > MinTimeNs / 10.0)
+                Multiplier = std::min(10.0, MinTimeNs * 1.4 / Ns);
+
+            Iterations = std::min(MaxIterations,
+                std::max(Iterations + 1, static_cast<int64>(static_cast<double>(Iterations) * Multiplier)));
+        }
+
+        const double ItemsPerOp = Case.bTouchesAllItems ? static_cast<double>(Size) : 1.0;
+
+        OutResult.Name = std::string(Case.Name) + "/" + std::to_string(Size);
+        OutResult.Size = Size;
+        OutResult.Iterations = Iterations;
+        OutResult.NsPerOp = Ns / static_cast<double>(Iterations);
+        OutResult.CyclesPerOp = static_cast<double>(Cycles) / static_cast<double>(Iterations);
+        OutResult.ItemsPerSecond = ItemsPerOp * static_cast<double>(Iterations) * 1e9 / Ns;
+        return true;
+    }
+
+    //=========================================================================
+    // Engine state
+    //=========================================================================
+
+    /**
+     * Mock image adopted by the engine core for the lifetime of one case;
+     * the core lets go of it again before the image is freed
+     */
+    class FMockEngine
+    {
+    public:
+        explicit FMockEngine(int32 MaxObjects)
+            : m_Image(GetVersionResolver().GetVersionInfo(), MaxObjects)
+        {}
+
+        explicit FMockEngine(const FObjectSnapshot& Snapshot)
+            : m_Image(GetVersionResolver().GetVersionInfo(), Snapshot)
+        {}
+
+        ~FMockEngine()
+        {
+            GetEngineCore().Shutdown();
+        }
+
+        USS_NON_COPYABLE(FMockEngine)
+        USS_NON_MOVABLE(FMockEngine)
+
+        FMockEngineImage& GetImage() { return m_Image; }
+
+        // Call once the image is populated
+        bool Adopt()
+        {
+            return GetEngineCore().InitializeWithTables(m_Image.CreateObjectArray(), m_Image.CreateNamePool()) == EResult::Success;
+        }
+
+    private:
+        FMockEngineImage m_Image;
+    };
+
+    // Classes the filler objects cycle through, so lookups compare names
+    // that differ the way real ones do
+    constexpr int32 FillerClassCount = 64;
+
+    // Object slack on top of a case's N for the image's own base classes
+    constexpr int32 ObjectSlack = 0x1000;
+
+    void AddFillerObjects(FMockEngineImage& Image, int32 Count)
+    {
+        void* ObjectClass = Image.FindClass("Object");
+        std::vector<void*> Classes;
+
+        for (int32 i = 0; i < FillerClassCount && Image.GetNumObjects() < Count; ++i)
+        {
+            char Name[64];
+            snprintf(Name, sizeof(Name), "BenchFillerClass_%d", i);
+            Classes.push_back(Image.AddClass(Name, ObjectClass));
+        }
+
+        for (int32 i = 0; Image.GetNumObjects() < Count; ++i)
+        {
+            char Name[64];
+            snprintf(Name, sizeof(Name), "BenchFiller_%d", i);
+            Image.AddObject(Name, Classes[i % Classes.size()]);
+        }
+    }
+
+    //=========================================================================
+    // Engine cases
+    //=========================================================================
+
+    FBenchBody SetupPatternScan(int32 Size)
+    {
+        // mov rax, [rip+??]; test rax, rax; jz ??; call
+        static const char Pattern[] = "\x48\x8B\x05\x00\x00\x00\x00\x48\x85\xC0\x74\x00\xE8";
+        static const char Mask[] = "xxx????xxxx?x";
+
+        auto Buffer = std::make_shared<std::vector<uint8>>(static_cast<size_t>(Size));
+
+        std::mt19937 Random(Size);
+        for (uint8& Byte : *Buffer)
+            Byte = static_cast<uint8>(Random());
+
+        // FindPattern stops short of the last mask-length bytes
+        const size_t MatchOffset = Buffer->size() - 64;
+        memcpy(Buffer->data() + MatchOffset, Pattern, sizeof(Pattern) - 1);
+
+        const uintptr Start = reinterpret_cast<uintptr>(Buffer->data());
+        const FPatternResult Check = Memory::FindPattern(Start, Buffer->size(), Pattern, Mask);
+        if (!Check.bFound || Check.Address != Start + MatchOffset)
+            return nullptr;
+
+        return [Buffer, Start](int64 Iterations)
+        {
+            for (int64 i = 0; i < Iterations; ++i)
+                g_Sink = g_Sink + Memory::FindPattern(Start, Buffer->size(), Pattern, Mask).Address;
+        };
+    }
+
+    FBenchBody SetupNameDecode(int32 Size)
+    {
+        auto Engine = std::make_shared<FMockEngine>(ObjectSlack);
+        auto Indices = std::make_shared<std::vector<int32>>();
+        Indices->reserve(Size);
+
+        for (int32 i = 0; i < Size; ++i)
+        {
+            char Name[64];
+            snprintf(Name, sizeof(Name), "BenchName_%d", i);
+            Indices->push_back(Engine->GetImage().AddName(Name));
+        }
+
+        if (!Engine->Adopt() || GetEngineCore().GetNameFromIndex(Indices->back()) != "BenchName_" + std::to_string(Size - 1))
+            return nullptr;
+
+        // Random order so the pool isn't read front to back
+        std::shuffle(Indices->begin(), Indices->end(), std::mt19937(Size));
+
+        return [Engine, Indices](int64 Iterations)
+        {
+            const INamePool& Pool = *GetEngineCore().GetNamePool();
+            const size_t Count = Indices->size();
+            size_t Cursor = 0;
+
+            for (int64 i = 0; i < Iterations; ++i)
+            {
+                g_Sink = g_Sink + Pool.GetNameString((*Indices)[Cursor]).size();
+
+                if (++Cursor == Count)
+                    Cursor = 0;
+            }
+        };
+    }
+
+    FBenchBody SetupObjectIteration(int32 Size)
+    {
+        auto Engine = std::make_shared<FMockEngine>(Size + ObjectSlack);
+        AddFillerObjects(Engine->GetImage(), Size);
+
+        if (!Engine->Adopt())
+            return nullptr;
+
+        return [Engine](int64 Iterations)
+        {
+            for (int64 i = 0; i < Iterations; ++i)
+            {
+                int32 Count = 0;
+                GetEngineCore().ForEachObject([&Count](const UObjectWrapper&) { ++Count; return true; });
+                g_Sink = g_Sink + Count;
+            }
+        };
+    }
+
+    FBenchBody SetupFindClass(int32 Size)
+    {
+        auto Engine = std::make_shared<FMockEngine>(Size + ObjectSlack);
+        AddFillerObjects(Engine->GetImage(), Size - 1);
+
+        void* Target = Engine->GetImage().AddClass("BenchTargetClass", Engine->GetImage().FindClass("Object"));
+
+        if (!Engine->Adopt() || GetEngineCore().FindClass("BenchTargetClass").GetRaw() != Target)
+            return nullptr;
+
+        return [Engine](int64 Iterations)
+        {
+            for (int64 i = 0; i < Iterations; ++i)
+                g_Sink = g_Sink + reinterpret_cast<uintptr>(GetEngineCore().FindClass("BenchTargetClass").GetRaw());
+        };
+    }
+
+    FBenchBody SetupFindObject(int32 Size)
+    {
+        auto Engine = std::make_shared<FMockEngine>(Size + ObjectSlack);
+        AddFillerObjects(Engine->GetImage(), Size - 1);
+
+        void* Target = Engine->GetImage().AddObject("BenchTarget", Engine->GetImage().FindClass("Object"));
+
+        if (!Engine->Adopt() || GetEngineCore().FindObjectByName("BenchTarget").GetRaw() != Target)
+            return nullptr;
+
+        return [Engine](int64 Iterations)
+        {
+            for (int64 i = 0; i < Iterations; ++i)
+                g_Sink = g_Sink + reinterpret_cast<uintptr>(GetEngineCore().FindObjectByName("BenchTarget").GetRaw());
+        };
+    }
+
+    // Objects under packages of 256, every eighth one the outer of the
+    // next seven, so paths share prefixes the way cooked content does
+    void AddNestedObjects(FMockEngineImage& Image, int32 Count)
+    {
+        void* ObjectClass = Image.FindClass("Object");
+        void* PackageClass = Image.AddClass("Package", ObjectClass);
+        void* NestedClass = Image.AddClass("BenchNestedClass", ObjectClass);
+
+        void* Package = nullptr;
+        void* Owner = nullptr;
+
+        for (int32 i = 0; Image.GetNumObjects() < Count; ++i)
+        {
+            char Name[64];
+
+            if (i % 256 == 0)
+            {
+                snprintf(Name, sizeof(Name), "/Game/Bench/BenchPackage_%d", i / 256);
+                Package = Image.AddObject(Name, PackageClass);
+                continue;
+            }
+
+            snprintf(Name, sizeof(Name), "BenchNested_%d", i);
+
+            if (i % 8 == 1)
+                Owner = Image.AddObject(Name, NestedClass, Package);
+            else
+                Image.AddObject(Name, NestedClass, Owner);
+        }
+    }
+
+    FBenchBody SetupFullNameDump(int32 Size)
+    {
+        auto Engine = std::make_shared<FMockEngine>(Size + ObjectSlack);
+        AddNestedObjects(Engine->GetImage(), Size);
+
+        if (!Engine->Adopt())
+            return nullptr;
+
+        // Building the cache is a one-off; the case times the dump after it
+        const int32 Num = GetEngineCore().GetObjectArray()->Num();
+        for (int32 Index = 0; Index < Num; ++Index)
+            GetObjectPathCache().GetFullName(Index);
+
+        return [Engine](int64 Iterations)
+        {
+            FObjectPathCache& PathCache = GetObjectPathCache();
+            const int32 Num = GetEngineCore().GetObjectArray()->Num();
+
+            for (int64 i = 0; i < Iterations; ++i)
+            {
+                size_t Length = 0;
+                for (int32 Index = 0; Index < Num; ++Index)
+                    Length += PathCache.GetFullName(Index).size();
+
+                g_Sink = g_Sink + Length;
+            }
+        };
+    }
+
+    FBenchBody SetupFindObjectByPath(int32 Size)
+    {
+        auto Engine = std::make_shared<FMockEngine>(Size + ObjectSlack);
+        AddNestedObjects(Engine->GetImage(), Size);
+
+        if (!Engine->Adopt())
+            return nullptr;
+
+        const int32 Target = GetEngineCore().GetObjectArray()->Num() - 1;
+        auto FullName = std::make_shared<std::string>(UObjectWrapper(GetEngineCore().GetObjectArray()->GetByIndex(Target)).GetFullName());
+
+        if (GetEngineCore().FindObject(FullName->c_str()).GetRaw() != GetEngineCore().GetObjectArray()->GetByIndex(Target))
+            return nullptr;
+
+        return [Engine, FullName](int64 Iterations)
+        {
+            for (int64 i = 0; i < Iterations; ++i)
+                g_Sink = g_Sink + reinterpret_cast<uintptr>(GetEngineCore().FindObject(FullName->c_str()).GetRaw());
+        };
+    }
+
+    FBenchBody SetupPropertyLookup(int32 Size)
+    {
+        static const char* const PropertyClasses[] = { "IntProperty", "FloatProperty", "ObjectProperty", "BoolProperty" };
+
+        auto Engine = std::make_shared<FMockEngine>(Size + ObjectSlack);
+        FMockEngineImage& Image = Engine->GetImage();
+
+        void* Struct = Image.AddClass("BenchPropertyStruct", Image.FindClass("Object"), Size * 8);
+
+        for (int32 i = 0; i < Size; ++i)
+        {
+            char Name[64];
+            snprintf(Name, sizeof(Name), "BenchProperty_%d", i);
+            Image.AddProperty(Struct, Name, PropertyClasses[i % 4], i * 8, i % 4 == 2 ? 8 : 4);
+        }
+
+        auto Target = std::make_shared<std::string>("BenchProperty_" + std::to_string(Size - 1));
+
+        FPropertyInfo Info;
+        if (!Engine->Adopt() || !GetPropertyIterator().FindProperty(Struct, Target->c_str(), Info) || Info.Offset != (Size - 1) * 8)
+            return nullptr;
+
+        return [Engine, Struct, Target](int64 Iterations)
+        {
+            IPropertyIterator& Iterator = GetPropertyIterator();
+            FPropertyInfo Found;
+
+            for (int64 i = 0; i < Iterations; ++i)
+            {
+                Iterator.FindProperty(Struct, Target->c_str(), Found);
+                g_Sink = g_Sink + Found.Offset;
+            }
+        };
+    }
+
+    // Number of parameters on the dispatched function
+    constexpr int32 DispatchParams = 6;
+
+    struct FDispatchState
+    {
+        std::unique_ptr<FMockEngine> Engine;
+        FProcessEventDispatcher Dispatcher;
+        void* Object = nullptr;
+        void* Function = nullptr;
+        uint8 Params[DispatchParams * 8] = {};
+        uint64 Matches = 0;
+
+        ~FDispatchState()
+        {
+            // Before the engine core drops the image it reads names from
+            Dispatcher.Shutdown();
+        }
+    };
+
+    FBenchBody SetupDispatch(int32 Size, bool bLastMatches)
+    {
+        static const char* const PropertyClasses[] = { "IntProperty", "FloatProperty", "ObjectProperty" };
+
+        auto State = std::make_shared<FDispatchState>();
+        State->Engine = std::make_unique<FMockEngine>(ObjectSlack);
+        FMockEngineImage& Image = State->Engine->GetImage();
+
+        void* ControllerClass = Image.AddClass("FortPlayerControllerZone", Image.FindClass("Object"));
+        State->Object = Image.AddObject("FortPlayerControllerZone_0", ControllerClass);
+        State->Function = Image.AddFunction(ControllerClass, "ServerBenchDispatch");
+
+        for (int32 i = 0; i < DispatchParams; ++i)
+        {
+            char Name[32];
+            snprintf(Name, sizeof(Name), "Param%d", i);
+            Image.AddProperty(State->Function, Name, PropertyClasses[i % 3], i * 8, i % 3 == 2 ? 8 : 4, 1, EPropertyFlags::CPF_Parm);
+        }
+
+        if (!State->Engine->Adopt() || State->Dispatcher.Initialize() != EResult::Success)
+            return nullptr;
+
+        for (int32 i = 0; i < Size; ++i)
+        {
+            FEventFilter Filter;
+            Filter.ObjectClassFilter = "FortPlayerControllerZone";
+
+            if (bLastMatches && i == Size - 1)
+                Filter.FunctionNameFilter = "ServerBenchDispatch";
+            else
+                Filter.FunctionNameFilter = "ServerBenchNeverCalled_" + std::to_string(i);
+
+            FDispatchState* RawState = State.get();
+            State->Dispatcher.RegisterHandler("BenchHandler_" + std::to_string(i), Filter,
+                [RawState](FProcessEventContext& Context) -> bool
+                {
+                    RawState->Matches += Context.Params.size();
+                    return true;
+                });
+        }
+
+        // The match path must have parsed every parameter
+        State->Dispatcher.OnProcessEvent(State->Object, State->Function, State->Params);
+        if (State->Matches != (bLastMatches ? DispatchParams : 0))
+            return nullptr;
+
+        return [State](int64 Iterations)
+        {
+            for (int64 i = 0; i < Iterations; ++i)
+                State->Dispatcher.OnProcessEvent(State->Object, State->Function, State->Params);
+
+            g_Sink = g_Sink + State->Matches;
+        };
+    }
+
+    // FFastArraySerializerItem header plus a payload
+    constexpr int32 FastArrayItemSize = 0x20;
+
+    FBenchBody SetupFastArrayDetect(int32 Size)
+    {
+        struct FState
+        {
+            FMockEngineImage Image;
+            std::unique_ptr<IFastArraySerializer> Serializer;
+            FFastArrayChangeDetector Detector;
+            std::vector<FFastArrayChange> Changes;
+            uint8* Items = nullptr;
+
+            FState() : Image(GetVersionResolver().GetVersionInfo(), 16) {}
+        };
+
+        auto State = std::make_shared<FState>();
+
+        // Lives outside GObjects - only the memory is borrowed from the image
+        void* FastArray = State->Image.Allocate(0x80);
+        State->Items = static_cast<uint8*>(State->Image.WriteArray(FastArray, 0, FastArrayItemSize, Size));
+
+        for (int32 i = 0; i < Size; ++i)
+        {
+            FMockEngineImage::Write<int32>(State->Items, i * FastArrayItemSize + 0, i + 1);     // ReplicationID
+            FMockEngineImage::Write<int32>(State->Items, i * FastArrayItemSize + 4, 1);         // ReplicationKey
+        }
+
+        State->Serializer = CreateFastArraySerializer();
+
+        if (State->Serializer->Initialize(FastArray, FastArrayItemSize, 0) != EResult::Success ||
+            State->Detector.Initialize(State->Serializer.get()) != EResult::Success)
+        {
+            return nullptr;
+        }
+
+        // Bump one item's ReplicationKey, as a replicated edit would
+        auto EditItem = [State, Size](int64 Index)
+        {
+            int32* Key = reinterpret_cast<int32*>(State->Items + (Index % Size) * FastArrayItemSize + 4);
+            ++*Key;
+        };
+
+        // The detector starts from the current contents
+        EditItem(0);
+        if (State->Detector.DetectChanges(State->Changes) != 1)
+            return nullptr;
+
+        return [State, EditItem](int64 Iterations)
+        {
+            for (int64 i = 0; i < Iterations; ++i)
+            {
+                EditItem(i);
+                g_Sink = g_Sink + State->Detector.DetectChanges(State->Changes);
+            }
+        };
+    }
+
+    //=========================================================================
+    // STW cases
+    //=========================================================================
+
+    constexpr float GridSize = 512.0f;
+    constexpr int32 GridWidth = 64;
+
+    struct FBuildingState
+    {
+        FInventoryManager Inventory;
+        FBuildingManager Building;
+
+        FBuildingState()
+        {
+            Inventory.Initialize(nullptr);
+            Building.Initialize(&Inventory);
+        }
+
+        ~FBuildingState()
+        {
+            Building.Shutdown();
+            Inventory.Shutdown();
+        }
+
+        // Demolition only refunds half, so keep enough wood on hand
+        void TopUpWood()
+        {
+            if (Inventory.GetWoodCount() >= 500)
+                return;
+
+            FInventoryItem Wood;
+            Wood.TemplateId = "Resource:Wood";
+            Wood.Category = EItemCategory::Resource;
+            Wood.Count = 999 - Inventory.GetWoodCount();
+            Wood.MaxStackSize = 999;
+            Inventory.AddItem(Wood);
+        }
+
+        // Place a wall on the ground floor grid
+        bool Place(int32 Cell, int32 Level)
+        {
+            TopUpWood();
+
+            Building.UpdateBuildPreview(static_cast<float>(Cell % GridWidth) * GridSize,
+                static_cast<float>(Cell / GridWidth) * GridSize, static_cast<float>(Level) * GridSize, 0.0f);
+
+            return Building.ConfirmBuild() == EResult::Success;
+        }
+    };
+
+    FBenchBody SetupBuildingPlaceDestroy(int32 Size)
+    {
+        auto State = std::make_shared<FBuildingState>();
+        State->Building.SetBuildLimit(Size + 16);
+        State->Building.EnterBuildMode(EBuildingType::Wall);
+
+        for (int32 i = 0; i < Size; ++i)
+        {
+            if (!State->Place(i, 0))
+                return nullptr;
+        }
+
+        return [State](int64 Iterations)
+        {
+            for (int64 i = 0; i < Iterations; ++i)
+            {
+                // Same cell one level up each time, so nothing overlaps
+                if (!State->Place(0, 1))
+                    continue;
+
+                const FBuildingPiece* Piece = State->Building.GetBuildingAtGrid(0, 0, 1);
+                if (Piece)
+                    State->Building.DemolishBuilding(std::string(Piece->BuildingId));
+            }
+
+            g_Sink = g_Sink + State->Building.GetBuildingCount();
+        };
+    }
+
+    FBenchBody SetupTrapUpdate(int32 Size)
+    {
+        auto State = std::make_shared<FBuildingState>();
+        State->Building.EnterBuildMode(EBuildingType::Floor);
+
+        if (!State->Place(0, 0))
+            return nullptr;
+
+        State->Building.ExitBuildMode();
+
+        const FBuildingPiece* Floor = State->Building.GetBuildingAtGrid(0, 0, 0);
+        if (!Floor)
+            return nullptr;
+
+        const std::string FloorId = Floor->BuildingId;
+
+        // No trap item, so placement doesn't draw on the inventory
+        State->Building.EnterTrapPlacementMode(ETrapType::FloorSpikes, std::string());
+
+        for (int32 i = 0; i < Size; ++i)
+        {
+            if (State->Building.ConfirmTrapPlacement(FloorId) != EResult::Success)
+                return nullptr;
+        }
+
+        return [State](int64 Iterations)
+        {
+            for (int64 i = 0; i < Iterations; ++i)
+                State->Building.Update();
+
+            g_Sink = g_Sink + State->Building.GetBuildingCount();
+        };
+    }
+
+    FBenchBody SetupInventoryAddConsume(int32 Size)
+    {
+        static const char* const AmmoTemplate = "Ammo:AmmoDataBulletsMedium";
+
+        auto Inventory = std::make_shared<FInventoryManager>();
+        Inventory->Initialize(nullptr);
+
+        for (int32 i = 0; i < Size; ++i)
+        {
+            FInventoryItem Item;
+            Item.TemplateId = "Ingredient:BenchIngredient_" + std::to_string(i);
+            Item.Category = EItemCategory::Resource;
+            Item.Count = 1;
+            Item.MaxStackSize = 999;
+
+            if (Inventory->AddItem(Item) != EResult::Success)
+                return nullptr;
+        }
+
+        FInventoryItem Ammo;
+        Ammo.TemplateId = AmmoTemplate;
+        Ammo.Category = EItemCategory::Ammo;
+        Ammo.Count = 500;
+        Ammo.MaxStackSize = 999;
+
+        if (Inventory->AddItem(Ammo) != EResult::Success)
+            return nullptr;
+
+        // One round in, one round out - the stack never empties or fills
+        Ammo.Count = 1;
+
+        return [Inventory, Ammo](int64 Iterations)
+        {
+            for (int64 i = 0; i < Iterations; ++i)
+            {
+                Inventory->AddItem(Ammo);
+                Inventory->ConsumeAmmo(AmmoTemplate, 1);
+            }
+
+            g_Sink = g_Sink + Inventory->GetAmmoCount(AmmoTemplate);
+        };
+    }
+
+    // Players go before the engine whose objects their handles point at
+    struct FPlayerState
+    {
+        std::unique_ptr<FMockEngine> Engine;
+        FPlayerControllerManager Players;
+    };
+
+    FBenchBody SetupPlayerUpdate(int32 Size, bool bParallel)
+    {
+        if (bParallel && !GetWorkerPool().IsInitialized() && GetWorkerPool().Initialize(3) != EResult::Success)
+            return nullptr;
+
+        auto State = std::make_shared<FPlayerState>();
+        State->Engine = std::make_unique<FMockEngine>(2 * Size + ObjectSlack);
+
+        FMockEngineImage& Image = State->Engine->GetImage();
+        void* ObjectClass = Image.FindClass("Object");
+        void* ControllerClass = Image.AddClass("FortPlayerControllerZone_C", ObjectClass);
+        void* PawnClass = Image.AddClass("PlayerPawn_Generic_C", ObjectClass);
+
+        std::vector<void*> Controllers;
+        std::vector<void*> Pawns;
+
+        for (int32 i = 0; i < Size; ++i)
+        {
+            char Name[64];
+            snprintf(Name, sizeof(Name), "BenchController_%d", i);
+            Controllers.push_back(Image.AddObject(Name, ControllerClass));
+
+            snprintf(Name, sizeof(Name), "BenchPawn_%d", i);
+            Pawns.push_back(Image.AddObject(Name, PawnClass));
+        }
+
+        if (!State->Engine->Adopt())
+            return nullptr;
+
+        State->Players.SetParallelThreshold(bParallel ? 0 : std::numeric_limits<int32>::max());
+
+        for (int32 i = 0; i < Size; ++i)
+        {
+            FSTWPlayerController* Player = State->Players.RegisterPlayer(Controllers[i]);
+            if (!Player || !Player->IsValid())
+                return nullptr;
+
+            Player->SetPawn(Pawns[i]);
+        }
+
+        return [State](int64 Iterations)
+        {
+            for (int64 i = 0; i < Iterations; ++i)
+                State->Players.Update();
+
+            g_Sink = g_Sink + static_cast<uint64>(State->Players.GetPlayerCount());
+        };
+    }
+
+    //=========================================================================
+    // Snapshot cases
+    //=========================================================================
+
+    FBenchBody SetupSnapshotIteration(const FObjectSnapshot& Snapshot, int32 Size)
+    {
+        auto Engine = std::make_shared<FMockEngine>(Snapshot);
+
+        if (!Engine->Adopt() || GetEngineCore().GetObjectArray()->Num() < Size)
+            return nullptr;
+
+        return [Engine](int64 Iterations)
+        {
+            for (int64 i = 0; i < Iterations; ++i)
+            {
+                int32 Count = 0;
+                GetEngineCore().ForEachObject([&Count](const UObjectWrapper&) { ++Count; return true; });
+                g_Sink = g_Sink + Count;
+            }
+        };
+    }
+
+    FBenchBody SetupSnapshotFindClass(const FObjectSnapshot& Snapshot, int32 Size)
+    {
+        auto Engine = std::make_shared<FMockEngine>(Snapshot);
+
+        // The last object whose class is the metaclass
+        int32 Target = -1;
+        for (int32 i = Size - 1; i >= 0 && Target < 0; --i)
+        {
+            const int32 Class = Snapshot.GetObjectRecord(i).Class;
+            if (Class >= 0 && strcmp(Snapshot.GetObjectName(Class), "Class") == 0)
+                Target = i;
+        }
+
+        if (Target < 0 || !Engine->Adopt())
+            return nullptr;
+
+        auto Name = std::make_shared<std::string>(Snapshot.GetObjectName(Target));
+        if (!GetEngineCore().FindClass(Name->c_str()).IsValid())
+            return nullptr;
+
+        return [Engine, Name](int64 Iterations)
+        {
+            for (int64 i = 0; i < Iterations; ++i)
+                g_Sink = g_Sink + reinterpret_cast<uintptr>(GetEngineCore().FindClass(Name->c_str()).GetRaw());
+        };
+    }
+
+    FBenchBody SetupSnapshotFindObject(const FObjectSnapshot& Snapshot, int32 Size)
+    {
+        auto Engine = std::make_shared<FMockEngine>(Snapshot);
+
+        int32 Target = Size - 1;
+        while (Target >= 0 && Snapshot.GetObjectRecord(Target).Address == 0)
+            --Target;
+
+        if (Target < 0 || !Engine->Adopt())
+            return nullptr;
+
+        // Names repeat, so the first object by that name may be an earlier one
+        auto Name = std::make_shared<std::string>(Snapshot.GetObjectName(Target));
+        if (GetEngineCore().FindObjectByName(Name->c_str()).GetName() != *Name)
+            return nullptr;
+
+        return [Engine, Name](int64 Iterations)
+        {
+            for (int64 i = 0; i < Iterations; ++i)
+                g_Sink = g_Sink + reinterpret_cast<uintptr>(GetEngineCore().FindObjectByName(Name->c_str()).GetRaw());
+        };
+    }
+
+    std::vector<FBenchCase> CreateCases(const FObjectSnapshot* Snapshot)
+    {
+        std::vector<FBenchCase> Cases = {
+            { "PatternScan",          { 1 << 16, 1 << 20, 1 << 24 }, true,  SetupPatternScan },
+            { "NameDecode",           { 1024, 65536, 1 << 20 },      false, SetupNameDecode },
+            { "ObjectIteration",      { 4096, 65536, 262144 },       true,  SetupObjectIteration },
+            { "FindClass",            { 4096, 65536, 262144 },       true,  SetupFindClass },
+            { "FindObject",           { 4096, 65536, 262144 },       true,  SetupFindObject },
+            { "FullNameDump",         { 4096, 65536, 262144 },       true,  SetupFullNameDump },
+            { "FindObjectByPath",     { 4096, 65536, 262144 },       true,  SetupFindObjectByPath },
+            { "PropertyLookup",       { 8, 64, 512 },                true,  SetupPropertyLookup },
+            { "DispatchReject",       { 1, 8, 64 },                  false, [](int32 Size) { return SetupDispatch(Size, false); } },
+            { "DispatchMatch",        { 1, 8, 64 },                  false, [](int32 Size) { return SetupDispatch(Size, true); } },
+            { "FastArrayDetect",      { 64, 512, 4096 },             true,  SetupFastArrayDetect },
+            { "BuildingPlaceDestroy", { 16, 256, 4096 },             false, SetupBuildingPlaceDestroy },
+            { "TrapUpdate",           { 16, 256, 4096 },             true,  SetupTrapUpdate },
+            { "InventoryAddConsume",  { 8, 64, 192 },                false, SetupInventoryAddConsume },
+            { "PlayerUpdate",         { 1, 4, 16, 64 },              true,  [](int32 Size) { return SetupPlayerUpdate(Size, false); } },
+            { "PlayerUpdateParallel", { 1, 4, 16, 64 },              true,  [](int32 Size) { return SetupPlayerUpdate(Size, true); } },
+        };
+
+        if (Snapshot)
+        {
+            const int32 Size = Snapshot->GetHeader().NumObjects;
+
+            Cases.push_back({ "SnapshotIteration",  { Size }, true, [Snapshot](int32 N) { return SetupSnapshotIteration(*Snapshot, N); } });
+            Cases.push_back({ "SnapshotFindClass",  { Size }, true, [Snapshot](int32 N) { return SetupSnapshotFindClass(*Snapshot, N); } });
+            Cases.push_back({ "SnapshotFindObject", { Size }, true, [Snapshot](int32 N) { return SetupSnapshotFindObject(*Snapshot, N); } });
+        }
+
+        return Cases;
+    }
+
+    //=========================================================================
+    // Output
+    //=========================================================================
+
+    void WriteJsonString(FILE* File, const std::string& Value)
+    {
+        fputc('"', File);
+        for (char Char : Value)
+        {
+            if (Char == '"' || Char == '\\')
+                fputc('\\', File);
+            fputc(Char, File);
+        }
+        fputc('"', File);
+    }
+
+    bool WriteJson(const char* Path, const FBenchOptions& Options, const std::vector<FBenchResult>& Results)
+    {
+        FILE* File = fopen(Path, "w");
+        if (!File)
+            return false;
+
+        const FVersionInfo& Version = GetVersionResolver().GetVersionInfo();
+
+        char Date[32] = {};
+        const std::time_t Now = std::time(nullptr);
+        std::strftime(Date, sizeof(Date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&Now));
+
+        fprintf(File, "{\n  \"context\": {\n");
+        fprintf(File, "    \"date\": \"%s\",\n", Date);
+        fprintf(File, "    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+#ifdef NDEBUG
+        fprintf(File, "    \"build_type\": \"release\",\n");
+#else
+        fprintf(File, "    \"build_type\": \"debug\",\n");
+#endif
+        fprintf(File, "    \"min_time_ms\": %.1f,\n", Options.MinTimeMs);
+        fprintf(File, "    \"fortnite_cl\": %u,\n", Version.FortniteCL);
+        fprintf(File, "    \"fortnite_version\": %.2f,\n", Version.FortniteVersion);
+        fprintf(File, "    \"engine_version\": \"%s\",\n", Version.GetEngineVersionString().c_str());
+        fprintf(File, "    \"fname_pool\": %s,\n", Version.bUseFNamePool ? "true" : "false");
+        fprintf(File, "    \"chunked_objects\": %s,\n", Version.bUseChunkedObjects ? "true" : "false");
+        fprintf(File, "    \"ffield\": %s,\n", Version.bUseFField ? "true" : "false");
+        fprintf(File, "    \"new_fast_array\": %s\n", Version.bUseNewFastArraySerializer ? "true" : "false");
+        fprintf(File, "  },\n  \"benchmarks\": [\n");
+
+        for (size_t i = 0; i < Results.size(); ++i)
+        {
+            const FBenchResult& Result = Results[i];
+
+            fprintf(File, "    { \"name\": ");
+            WriteJsonString(File, Result.Name);
+            fprintf(File, ", \"size\": %d, \"iterations\": %lld, \"ns_per_op\": %.3f, \"cycles_per_op\": %.1f, \"items_per_second\": %.1f }%s\n",
+                Result.Size, static_cast<long long>(Result.Iterations), Result.NsPerOp, Result.CyclesPerOp,
+                Result.ItemsPerSecond, i + 1 < Results.size() ? "," : "");
+        }
+
+        fprintf(File, "  ]\n}\n");
+        fclose(File);
+        return true;
+    }
+
+    bool ParseArguments(int Argc, char** Argv, FBenchOptions& Options)
+    {
+        for (int i = 1; i < Argc; ++i)
+        {
+            const char* Arg = Argv[i];
+            const char* Value = (i + 1 < Argc) ? Argv[i + 1] : nullptr;
+
+            if (strcmp(Arg, "-help") == 0 || strcmp(Arg, "--help") == 0)
+                return false;
+
+            if (!Value)
+            {
+                fprintf(stderr, "Missing value for %s\n", Arg);
+                return false;
+            }
+
+            if (strcmp(Arg, "-filter") == 0)        Options.Filter = Value;
+            else if (strcmp(Arg, "-min-time") == 0) Options.MinTimeMs = atof(Value);
+            else if (strcmp(Arg, "-cl") == 0)       Options.CL = static_cast<uint32>(strtoul(Value, nullptr, 10));
+            else if (strcmp(Arg, "-snapshot") == 0) Options.SnapshotPath = Value;
+            else if (strcmp(Arg, "-save-snapshot") == 0) Options.SaveSnapshotPath = Value;
+            else if (strcmp(Arg, "-json") == 0)     Options.JsonPath = Value;
+            else
+            {
+                fprintf(stderr, "Unknown argument: %s\n", Arg);
+                return false;
+            }
+
+            ++i;
+        }
+
+        return Options.MinTimeMs > 0.0;
+    }
+
+    // Objects in the image -save-snapshot captures
+    constexpr int32 SaveSnapshotObjects = 65536;
+
+    int SaveMockSnapshot(const char* FilePath)
+    {
+        FMockEngine Engine(SaveSnapshotObjects + ObjectSlack);
+        AddFillerObjects(Engine.GetImage(), SaveSnapshotObjects);
+
+        FObjectSnapshot Snapshot;
+        if (!Engine.Adopt() || Snapshot.Capture() != EResult::Success || Snapshot.Save(FilePath) != EResult::Success)
+        {
+            fprintf(stderr, "Failed to write snapshot %s\n", FilePath);
+            return 1;
+        }
+
+        printf("Wrote %d objects to %s\n", Snapshot.GetHeader().NumObjects, FilePath);
+        return 0;
+    }
+
+    void PrintUsage()
+    {
+        printf("Usage: USSBench [-filter Text] [-min-time Ms] [-cl CL] [-snapshot File] [-json File.json]\n");
+        printf("       USSBench [-cl CL] -save-snapshot File\n");
+        printf("                -filter runs the cases whose name contains Text\n");
+    }
+}
+
+int main(int Argc, char** Argv)
+{
+    FBenchOptions Options;
+    if (!ParseArguments(Argc, Argv, Options))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    if (Memory::Initialize() != EResult::Success)
+    {
+        fprintf(stderr, "Failed to initialize memory\n");
+        return 1;
+    }
+
+    FObjectSnapshot Snapshot;
+    if (!Options.SnapshotPath.empty())
+    {
+        if (Snapshot.Load(Options.SnapshotPath.c_str()) != EResult::Success)
+        {
+            fprintf(stderr, "Failed to load snapshot %s\n", Options.SnapshotPath.c_str());
+            return 1;
+        }
+
+        Options.CL = Snapshot.GetHeader().FortniteCL;
+    }
+
+    if (GetVersionResolver().OverrideVersion(Options.CL) != EResult::Success)
+    {
+        fprintf(stderr, "Unknown CL %u\n", Options.CL);
+        return 1;
+    }
+
+    const FVersionInfo& Version = GetVersionResolver().GetVersionInfo();
+    GetOffsetResolver().ResolveOffsets(Version);
+
+    if (!Options.SaveSnapshotPath.empty())
+        return SaveMockSnapshot(Options.SaveSnapshotPath.c_str());
+
+    printf("Micro-benchmarks: FN %.2f (CL %u, UE %s), min time %.0f ms\n\n",
+        Version.FortniteVersion, Version.FortniteCL, Version.GetEngineVersionString().c_str(), Options.MinTimeMs);
+    printf("  %-30s %14s %14s %12s %16s\n", "Benchmark", "ns/op", "cycles/op", "iterations", "items/s");
+
+    std::vector<FBenchResult> Results;
+    int32 Failures = 0;
+
+    for (const FBenchCase& Case : CreateCases(Snapshot.IsValid() ? &Snapshot : nullptr))
+    {
+        if (!Options.Filter.empty() && strstr(Case.Name, Options.Filter.c_str()) == nullptr)
+            continue;
+
+        for (int32 Size : Case.Sizes)
+        {
+            FBenchResult Result;
+            if (!RunCase(Case, Size, Options.MinTimeMs, Result))
+            {
+                fprintf(stderr, "  %s/%d: setup failed\n", Case.Name, Size);
+                ++Failures;
+                continue;
+            }
+
+            printf("  %-30s %14.1f %14.1f %12lld %16.4g\n", Result.Name.c_str(), Result.NsPerOp,
+                Result.CyclesPerOp, static_cast<long long>(Result.Iterations), Result.ItemsPerSecond);
+            fflush(stdout);
+
+            Results.push_back(Result);
+        }
+    }
+
+    if (!Options.JsonPath.empty())
+    {
+        if (WriteJson(Options.JsonPath.c_str(), Options, Results))
+            printf("\nWrote %zu results to %s\n", Results.size(), Options.JsonPath.c_str());
+        else
+            fprintf(stderr, "Failed to write %s\n", Options.JsonPath.c_str());
+    }
+
+    return Failures == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,179 @@
+/**
+ * UniversalSlashingSimulator - Fake Hook Backend Implementation
+ */
+
+#include "FakeHookBackend.h"
+
+namespace USS
+{
+    FFakeHookBackend::FFakeHookBackend()
+        : m_FreezeCount(0)
+        , m_RemoveCount(0)
+        , m_bInitialized(false)
+    {
+    }
+
+    int32 FFakeHookBackend::Initialize()
+    {
+        if (m_bInitialized)
+            return FakeAlreadyInitialized;
+
+        m_bInitialized = true;
+        return FakeOk;
+    }
+
+    int32 FFakeHookBackend::Uninitialize()
+    {
+        if (!m_bInitialized)
+            return FakeNotInitialized;
+
+        m_Hooks.clear();
+        m_bInitialized = false;
+        return FakeOk;
+    }
+
+    int32 FFakeHookBackend::CreateHook(void* Target, void* Detour, void** OutOriginal)
+    {
+        // Nothing is patched, so the detour is never called
+        (void)Detour;
+
+        if (!m_bInitialized)
+            return FakeNotInitialized;
+
+        if (m_FailCreate.count(Target))
+            return FakeRejected;
+
+        if (m_Hooks.count(Target))
+            return FakeAlreadyCreated;
+
+        m_Hooks.emplace(Target, FFakeHook());
+
+        if (OutOriginal)
+            *OutOriginal = Target;
+
+        return FakeOk;
+    }
+
+    int32 FFakeHookBackend::RemoveHook(void* Target)
+    {
+        ++m_RemoveCount;
+
+        if (!m_bInitialized)
+            return FakeNotInitialized;
+
+        auto It = m_Hooks.find(Target);
+        if (It == m_Hooks.end())
+            return FakeNotCreated;
+
+        if (It->second.bEnabled)
+            ++m_FreezeCount;
+
+        m_Hooks.erase(It);
+        return FakeOk;
+    }
+
+    int32 FFakeHookBackend::EnableHook(void* Target)
+    {
+        auto It = m_Hooks.find(Target);
+        if (It == m_Hooks.end())
+            return FakeNotCreated;
+
+        if (It->second.bEnabled)
+            return FakeOk;
+
+        ++m_FreezeCount;
+        return SetEnabled(Target, It->second, true);
+    }
+
+    int32 FFakeHookBackend::DisableHook(void* Target)
+    {
+        auto It = m_Hooks.find(Target);
+        if (It == m_Hooks.end())
+            return FakeNotCreated;
+
+        if (!It->second.bEnabled)
+            return FakeOk;
+
+        ++m_FreezeCount;
+        return SetEnabled(Target, It->second, false);
+    }
+
+    int32 FFakeHookBackend::QueueEnableHook(void* Target)
+    {
+        auto It = m_Hooks.find(Target);
+        if (It == m_Hooks.end())
+            return FakeNotCreated;
+
+        It->second.bQueueEnable = true;
+        return FakeOk;
+    }
+
+    int32 FFakeHookBackend::QueueDisableHook(void* Target)
+    {
+        auto It = m_Hooks.find(Target);
+        if (It == m_Hooks.end())
+            return FakeNotCreated;
+
+        It->second.bQueueEnable = false;
+        return FakeOk;
+    }
+
+    int32 FFakeHookBackend::ApplyQueued()
+    {
+        if (!m_bInitialized)
+            return FakeNotInitialized;
+
+        bool bFrozen = false;
+
+        for (auto& Pair : m_Hooks)
+        {
+            FFakeHook& Hook = Pair.second;
+            if (Hook.bEnabled == Hook.bQueueEnable)
+                continue;
+
+            // One suspend for the whole pass
+            if (!bFrozen)
+            {
+                ++m_FreezeCount;
+                bFrozen = true;
+            }
+
+            int32 Status = SetEnabled(Pair.first, Hook, Hook.bQueueEnable);
+            if (Status != FakeOk)
+                return Status;
+        }
+
+        return FakeOk;
+    }
+
+    const char* FFakeHookBackend::GetStatusName(int32 Status) const
+    {
+        switch (Status)
+        {
+        case FakeOk:                    return "OK";
+        case FakeAlreadyInitialized:    return "ALREADY_INITIALIZED";
+        case FakeNotInitialized:        return "NOT_INITIALIZED";
+        case FakeAlreadyCreated:        return "ALREADY_CREATED";
+        case FakeNotCreated:            return "NOT_CREATED";
+        case FakeRejected:              return "REJECTED";
+        default:                        return "UNKNOWN";
+        }
+    }
+
+    bool FFakeHookBackend::IsEnabled(void* Target) const
+    {
+        auto It = m_Hooks.find(Target);
+        return It != m_Hooks.end() && It->second.bEnabled;
+    }
+
+    int32 FFakeHookBackend::SetEnabled(void* Target, FFakeHook& Hook, bool bEnable)
+    {
+        if (bEnable && m_FailEnable.count(Target))
+            return FakeRejected;
+
+        Hook.bEnabled = bEnable;
+        Hook.bQueueEnable = bEnable;
+        return FakeOk;
+    }
+
+}
\ No newline at end of file
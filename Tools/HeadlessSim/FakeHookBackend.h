@@ -0,0 +1,84 @@
+/**
+ * UniversalSlashingSimulator - Fake Hook Backend
+ *
+ * IHookBackend that patches nothing, for driving FHookRegistry without
+ * the game or Windows. It follows MinHook's rules - create before
+ * enable, queued changes land on ApplyQueued, and ApplyQueued stops at
+ * the first hook it can't patch - and counts the thread freezes MinHook
+ * would have done. Failures can be injected per target.
+ *
+ * The "trampoline" handed back by CreateHook is the target itself.
+ */
+
+#pragma once
+
+#include "../../Core/Hooks/HookRegistry.h"
+#include <unordered_map>
+#include <unordered_set>
+
+namespace USS
+{
+    class FFakeHookBackend : public IHookBackend
+    {
+    public:
+        enum EFakeStatus : int32
+        {
+            FakeOk = 0,
+            FakeAlreadyInitialized,
+            FakeNotInitialized,
+            FakeAlreadyCreated,
+            FakeNotCreated,
+            FakeRejected            // Injected failure
+        };
+
+        FFakeHookBackend();
+        ~FFakeHookBackend() override = default;
+
+        USS_NON_COPYABLE(FFakeHookBackend)
+        USS_NON_MOVABLE(FFakeHookBackend)
+
+        int32 Initialize() override;
+        int32 Uninitialize() override;
+
+        int32 CreateHook(void* Target, void* Detour, void** OutOriginal) override;
+        int32 RemoveHook(void* Target) override;
+
+        int32 EnableHook(void* Target) override;
+        int32 DisableHook(void* Target) override;
+
+        int32 QueueEnableHook(void* Target) override;
+        int32 QueueDisableHook(void* Target) override;
+        int32 ApplyQueued() override;
+
+        const char* GetStatusName(int32 Status) const override;
+
+        // Failure injection
+        void FailCreate(void* Target) { m_FailCreate.insert(Target); }
+        void FailEnable(void* Target) { m_FailEnable.insert(Target); }
+
+        bool IsEnabled(void* Target) const;
+
+        // Suspend/resume cycles MinHook would have performed
+        uint32 GetFreezeCount() const { return m_FreezeCount; }
+
+        // RemoveHook calls, including ones for hooks never created
+        uint32 GetRemoveCount() const { return m_RemoveCount; }
+
+    private:
+        struct FFakeHook
+        {
+            bool bEnabled = false;
+            bool bQueueEnable = false;  // Wanted state for the next ApplyQueued
+        };
+
+        int32 SetEnabled(void* Target, FFakeHook& Hook, bool bEnable);
+
+        std::unordered_map<void*, FFakeHook> m_Hooks;
+        std::unordered_set<void*> m_FailCreate;
+        std::unordered_set<void*> m_FailEnable;
+        uint32 m_FreezeCount;
+        uint32 m_RemoveCount;
+        bool m_bInitialized;
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,311 @@
+/**
+ * UniversalSlashingSimulator - Headless Mission Simulation Driver
+ *
+ * Runs N simulated missions against the stub engine and reports per-tick
+ * timings, to find where the STW layer stops scaling without needing the
+ * game. Every mission is its own zone instance in FSTWGameMode, fed
+ * through the same OnProcessEvent entry point as the ProcessEvent detour.
+ *
+ * Usage:
+ *   USSHeadlessSim [-missions N] [-players N] [-ticks N] [-threads N]
+ *                  [-waves N] [-enemies N] [-budget Ms] [-seed N]
+ *                  [-trace File.json] [-trace-bin File.ussp]
+ *
+ * Built with USS_PROFILE, so the per-zone profiler summary is printed
+ * after the run and -trace writes a Chrome trace of the last ticks.
+ */
+
+#include "StubEngine.h"
+#include "SimMission.h"
+#include "../../Core/Diagnostics/Profiler.h"
+#include "../../STW/GameMode/STWGameMode.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+using namespace USS;
+
+namespace
+{
+    struct FDriverOptions
+    {
+        int32 Missions = 8;
+        int32 Ticks = 3000;             // 100 seconds at 30 Hz
+        int32 Threads = 0;              // 0 = hardware concurrency
+        std::string TracePath;          // Chrome trace-event JSON
+        std::string BinaryTracePath;    // Compact profiler dump
+        FSimConfig Sim;
+    };
+
+    /**
+     * Summary of a set of millisecond samples
+     */
+    struct FTimingSummary
+    {
+        double Mean = 0.0;
+        double P50 = 0.0;
+        double P99 = 0.0;
+        double Max = 0.0;
+    };
+
+    FTimingSummary Summarize(std::vector<double>& Samples)
+    {
+        FTimingSummary Summary;
+        if (Samples.empty())
+            return Summary;
+
+        std::sort(Samples.begin(), Samples.end());
+
+        double Total = 0.0;
+        for (double Sample : Samples)
+            Total += Sample;
+
+        const size_t Last = Samples.size() - 1;
+        Summary.Mean = Total / static_cast<double>(Samples.size());
+        Summary.P50 = Samples[Last / 2];
+        Summary.P99 = Samples[(Last * 99) / 100];
+        Summary.Max = Samples[Last];
+        return Summary;
+    }
+
+    bool ParseArguments(int Argc, char** Argv, FDriverOptions& Options)
+    {
+        for (int i = 1; i < Argc; ++i)
+        {
+            const char* Arg = Argv[i];
+            const char* Value = (i + 1 < Argc) ? Argv[i + 1] : nullptr;
+
+            if (strcmp(Arg, "-help") == 0 || strcmp(Arg, "--help") == 0)
+                return false;
+
+            if (!Value)
+            {
+                fprintf(stderr, "Missing value for %s\n", Arg);
+                return false;
+            }
+
+            if (strcmp(Arg, "-missions") == 0)      Options.Missions = atoi(Value);
+            else if (strcmp(Arg, "-ticks") == 0)    Options.Ticks = atoi(Value);
+            else if (strcmp(Arg, "-threads") == 0)  Options.Threads = atoi(Value);
+            else if (strcmp(Arg, "-players") == 0)  Options.Sim.PlayersPerMission = atoi(Value);
+            else if (strcmp(Arg, "-waves") == 0)    Options.Sim.WavesPerMission = atoi(Value);
+            else if (strcmp(Arg, "-enemies") == 0)  Options.Sim.EnemiesPerWave = atoi(Value);
+            else if (strcmp(Arg, "-budget") == 0)   Options.Sim.SpawnBudgetMs = static_cast<float>(atof(Value));
+            else if (strcmp(Arg, "-seed") == 0)     Options.Sim.Seed = static_cast<uint32>(strtoul(Value, nullptr, 10));
+            else if (strcmp(Arg, "-trace") == 0)    Options.TracePath = Value;
+            else if (strcmp(Arg, "-trace-bin") == 0) Options.BinaryTracePath = Value;
+            else
+            {
+                fprintf(stderr, "Unknown argument: %s\n", Arg);
+                return false;
+            }
+
+            ++i;
+        }
+
+        return Options.Missions > 0 && Options.Ticks > 0 &&
+               Options.Sim.PlayersPerMission > 0 && Options.Sim.WavesPerMission > 0;
+    }
+
+    void PrintUsage()
+    {
+        printf("Usage: USSHeadlessSim [-missions N] [-players N] [-ticks N] [-threads N]\n");
+        printf("                      [-waves N] [-enemies N] [-budget Ms] [-seed N]\n");
+        printf("                      [-trace File.json] [-trace-bin File.ussp]\n");
+    }
+
+    void PrintTiming(const char* Label, const FTimingSummary& Summary)
+    {
+        printf("  %-22s mean %8.4f  p50 %8.4f  p99 %8.4f  max %8.4f ms\n",
+            Label, Summary.Mean, Summary.P50, Summary.P99, Summary.Max);
+    }
+}
+
+int main(int Argc, char** Argv)
+{
+    FDriverOptions Options;
+    if (!ParseArguments(Argc, Argv, Options))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    int32 NumThreads = Options.Threads > 0
+        ? Options.Threads
+        : static_cast<int32>(std::max(1u, std::thread::hardware_concurrency()));
+    NumThreads = std::min(NumThreads, Options.Missions);
+
+    FStubEngine Engine;
+    if (Engine.Initialize() != EResult::Success)
+    {
+        fprintf(stderr, "Failed to initialize stub engine\n");
+        return 1;
+    }
+
+    // Each mission's zone game mode gets its own instance on ReadyToStartMatch
+    FSTWGameConfig ZoneConfig;
+    ZoneConfig.MaxPlayers = Options.Sim.PlayersPerMission;
+
+    if (GetSTWGameMode().Initialize(ZoneConfig) != EResult::Success)
+    {
+        fprintf(stderr, "Failed to initialize STW game mode\n");
+        return 1;
+    }
+
+    std::vector<std::unique_ptr<FSimMission>> Missions;
+    Missions.reserve(Options.Missions);
+
+    for (int32 i = 0; i < Options.Missions; ++i)
+    {
+        std::unique_ptr<FSimMission> Mission = std::make_unique<FSimMission>(Engine, Options.Sim, i);
+
+        EResult Result = Mission->Initialize();
+        if (Result != EResult::Success)
+        {
+            fprintf(stderr, "Mission %d failed to initialize: %s\n", i, ResultToString(Result));
+            Missions.clear();
+            GetSTWGameMode().Shutdown();
+            return 1;
+        }
+
+        Missions.push_back(std::move(Mission));
+    }
+
+    printf("Headless simulation: %d missions x %d players, %d ticks, %d threads\n",
+        Options.Missions, Options.Sim.PlayersPerMission, Options.Ticks, NumThreads);
+    printf("Stub engine: %d objects, %d names, %d zone instances\n\n",
+        Engine.GetObjectArray().Num(), Engine.GetNamePool().Num(), GetSTWGameMode().GetInstanceCount());
+
+    // Missions are statically partitioned; each worker ticks its missions
+    // in lockstep and records one frame sample per tick
+    std::vector<std::vector<double>> MissionTickMs(Options.Missions);
+    std::vector<std::vector<double>> FrameMs(NumThreads);
+
+    for (auto& Samples : MissionTickMs)
+        Samples.reserve(Options.Ticks);
+
+    using FClock = std::chrono::steady_clock;
+    const FClock::time_point RunStart = FClock::now();
+
+    std::vector<std::thread> Workers;
+    Workers.reserve(NumThreads);
+
+    for (int32 WorkerIndex = 0; WorkerIndex < NumThreads; ++WorkerIndex)
+    {
+        Workers.emplace_back([&, WorkerIndex]()
+        {
+            std::vector<double>& Frames = FrameMs[WorkerIndex];
+            Frames.reserve(Options.Ticks);
+
+            for (int32 Tick = 0; Tick < Options.Ticks; ++Tick)
+            {
+                double FrameTotal = 0.0;
+
+                for (int32 m = WorkerIndex; m < Options.Missions; m += NumThreads)
+                {
+                    double Ms = Missions[m]->Tick();
+                    MissionTickMs[m].push_back(Ms);
+                    FrameTotal += Ms;
+                }
+
+                Frames.push_back(FrameTotal);
+            }
+        });
+    }
+
+    for (auto& Worker : Workers)
+        Worker.join();
+
+    const double RunSeconds = std::chrono::duration<double>(FClock::now() - RunStart).count();
+
+    // Aggregate
+    std::vector<double> AllMissionTicks;
+    std::vector<double> AllFrames;
+    AllMissionTicks.reserve(static_cast<size_t>(Options.Missions) * Options.Ticks);
+    AllFrames.reserve(static_cast<size_t>(NumThreads) * Options.Ticks);
+
+    FSimMissionStats Totals;
+
+    for (int32 i = 0; i < Options.Missions; ++i)
+    {
+        AllMissionTicks.insert(AllMissionTicks.end(), MissionTickMs[i].begin(), MissionTickMs[i].end());
+
+        const FSimMissionStats& Stats = Missions[i]->GetStats();
+        Totals.Ticks += Stats.Ticks;
+        Totals.ProcessEvents += Stats.ProcessEvents;
+        Totals.MissionsCompleted += Stats.MissionsCompleted;
+        Totals.MissionsFailed += Stats.MissionsFailed;
+        Totals.WavesCompleted += Stats.WavesCompleted;
+        Totals.EnemiesKilled += Stats.EnemiesKilled;
+        Totals.BuildsPlaced += Stats.BuildsPlaced;
+        Totals.BuildsRejected += Stats.BuildsRejected;
+        Totals.BuildsDemolished += Stats.BuildsDemolished;
+        Totals.CraftsSucceeded += Stats.CraftsSucceeded;
+        Totals.CraftsRejected += Stats.CraftsRejected;
+    }
+
+    for (auto& Frames : FrameMs)
+        AllFrames.insert(AllFrames.end(), Frames.begin(), Frames.end());
+
+    const FTimingSummary MissionSummary = Summarize(AllMissionTicks);
+    const FTimingSummary FrameSummary = Summarize(AllFrames);
+
+    printf("Timings:\n");
+    PrintTiming("mission tick", MissionSummary);
+    PrintTiming("worker frame", FrameSummary);
+
+    printf("\nThroughput:\n");
+    printf("  %.0f mission-ticks/s over %.2f s\n", static_cast<double>(Totals.Ticks) / RunSeconds, RunSeconds);
+    if (MissionSummary.P99 > 0.0)
+        printf("  ~%.0f missions per core fit a 33.3 ms frame at p99\n", 33.3 / MissionSummary.P99);
+
+    printf("\nActivity:\n");
+    printf("  missions   completed %llu, failed %llu, waves %llu\n",
+        static_cast<unsigned long long>(Totals.MissionsCompleted),
+        static_cast<unsigned long long>(Totals.MissionsFailed),
+        static_cast<unsigned long long>(Totals.WavesCompleted));
+    printf("  enemies    killed %llu\n", static_cast<unsigned long long>(Totals.EnemiesKilled));
+    printf("  builds     placed %llu, rejected %llu, demolished %llu\n",
+        static_cast<unsigned long long>(Totals.BuildsPlaced),
+        static_cast<unsigned long long>(Totals.BuildsRejected),
+        static_cast<unsigned long long>(Totals.BuildsDemolished));
+    printf("  crafts     ok %llu, rejected %llu\n",
+        static_cast<unsigned long long>(Totals.CraftsSucceeded),
+        static_cast<unsigned long long>(Totals.CraftsRejected));
+    printf("  events     %llu ProcessEvent calls\n", static_cast<unsigned long long>(Totals.ProcessEvents));
+
+    const std::vector<FProfileZoneSummary> Zones = FProfiler::GetZoneSummaries();
+    if (!Zones.empty())
+    {
+        printf("\nProfiler zones (most recent events per thread):\n");
+        for (const auto& Zone : Zones)
+        {
+            printf("  %-34s n %8u  mean %9.2f  p99 %9.2f  max %9.2f us\n",
+                Zone.Name.c_str(), Zone.Count, Zone.MeanUs, Zone.P99Us, Zone.MaxUs);
+        }
+    }
+
+    if (!Options.TracePath.empty())
+    {
+        if (FProfiler::ExportChromeTrace(Options.TracePath.c_str()) == EResult::Success)
+            printf("\nWrote Chrome trace to %s\n", Options.TracePath.c_str());
+        else
+            fprintf(stderr, "Failed to write trace %s\n", Options.TracePath.c_str());
+    }
+
+    if (!Options.BinaryTracePath.empty())
+    {
+        if (FProfiler::ExportBinary(Options.BinaryTracePath.c_str()) == EResult::Success)
+            printf("Wrote binary trace to %s\n", Options.BinaryTracePath.c_str());
+        else
+            fprintf(stderr, "Failed to write trace %s\n", Options.BinaryTracePath.c_str());
+    }
+
+    // Instances first - the engine core goes with Engine
+    Missions.clear();
+    GetSTWGameMode().Shutdown();
+    return 0;
+}
\ No newline at end of file
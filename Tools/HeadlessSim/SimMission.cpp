@@ -0,0 +1,452 @@
+/**
+ * UniversalSlashingSimulator - Headless Simulated Mission Implementation
+ */
+
+#include "SimMission.h"
+#include "../../Core/Diagnostics/Profiler.h"
+#include "../../STW/Player/STWPlayerPawn.h"
+#include <chrono>
+
+namespace USS
+{
+    static const char* const SimIngredients[] = {
+        "Ingredient:Ingredient_Mechanical_Parts_T05",
+        "Ingredient:Ingredient_Ore_Brightcore",
+        "Ingredient:Ingredient_Powder_T05",
+    };
+
+    // Per-craft costs are covered by the ingredients harvested between crafts
+    static const struct
+    {
+        const char* SchematicId;
+        const char* ResultTemplateId;
+        int32 ResultCount;
+        EItemCategory ResultCategory;
+        int32 ResultMaxStackSize;
+        int32 MechanicalParts;
+        int32 Ore;
+        int32 Powder;
+    } SimSchematics[] = {
+        { "Schematic:SID_Assault_Auto_SR_Ore_T05", "Weapon:WID_Assault_Auto_SR_Ore_T05", 1, EItemCategory::Weapon, 1, 6, 4, 0 },
+        { "Schematic:SID_Floor_Spikes_SR_T05", "Trap:TID_Floor_Spikes_SR_T05", 1, EItemCategory::Trap, 99, 4, 2, 0 },
+        { "Schematic:Ammo_BulletsMedium", "Ammo:AmmoDataBulletsMedium", 20, EItemCategory::Ammo, 999, 0, 1, 3 },
+    };
+
+    static const EBuildingType SimBuildTypes[] = {
+        EBuildingType::Wall,
+        EBuildingType::Floor,
+        EBuildingType::Ramp,
+        EBuildingType::Roof,
+    };
+
+    FSimMission::FSimMission(FStubEngine& Engine, const FSimConfig& Config, int32 MissionIndex)
+        : m_Engine(Engine)
+        , m_Config(Config)
+        , m_MissionIndex(MissionIndex)
+        , m_World(nullptr)
+        , m_Level(nullptr)
+        , m_GameModeObject(nullptr)
+        , m_Instance(nullptr)
+        , m_Mission(nullptr)
+        , m_Spawner(Engine)
+        , m_ReadyFunction(nullptr)
+        , m_LoadedFunction(nullptr)
+        , m_TickFunction(nullptr)
+        , m_BuildFunction(nullptr)
+        , m_CraftFunction(nullptr)
+        , m_KillFunction(nullptr)
+        , m_MissionKills(0)
+        , m_Random(Config.Seed + static_cast<uint32>(MissionIndex))
+    {
+    }
+
+    FSimMission::~FSimMission()
+    {
+        Shutdown();
+    }
+
+    EResult FSimMission::Initialize()
+    {
+        m_ReadyFunction = m_Engine.FindFunction("ReadyToStartMatch");
+        m_LoadedFunction = m_Engine.FindFunction("ServerLoadingScreenDropped");
+        m_TickFunction = m_Engine.FindFunction("Tick");
+        m_BuildFunction = m_Engine.FindFunction("ServerCreateBuildingActor");
+        m_CraftFunction = m_Engine.FindFunction("ServerCraftSchematic");
+        m_KillFunction = m_Engine.FindFunction("ServerHandleEnemyKilled");
+
+        if (!m_ReadyFunction || !m_LoadedFunction || !m_TickFunction ||
+            !m_BuildFunction || !m_CraftFunction || !m_KillFunction)
+            return EResult::NotInitialized;
+
+        if (!GetSTWGameMode().IsInitialized())
+            return EResult::NotInitialized;
+
+        char Name[64];
+        snprintf(Name, sizeof(Name), "SimZone_%d", m_MissionIndex);
+        m_World = m_Engine.CreateObject(Name, m_Engine.FindObjectByName("World"));
+        m_Level = m_Engine.CreateObject("PersistentLevel", m_Engine.FindObjectByName("Level"), m_World);
+
+        snprintf(Name, sizeof(Name), "FortGameModeZone_%d", m_MissionIndex);
+        m_GameModeObject = m_Engine.CreateObject(Name, m_Engine.FindObjectByName("FortGameModeZone"), m_Level);
+
+        // The zone game mode's ReadyToStartMatch creates the instance,
+        // which starts its default mission
+        DispatchProcessEvent(m_GameModeObject, m_ReadyFunction, nullptr);
+
+        m_Instance = GetSTWGameMode().FindInstance(m_World);
+        if (!m_Instance || !m_Instance->GetMissionManager())
+            return EResult::Failed;
+
+        if (m_Instance->GetConfig().MaxPlayers < m_Config.PlayersPerMission)
+            return EResult::InvalidParameter;
+
+        m_Mission = m_Instance->GetMissionManager();
+        m_Mission->SetEnemySpawner(&m_Spawner);
+
+        FStubObject* ControllerClass = m_Engine.FindObjectByName("FortPlayerControllerZone_C");
+        FStubObject* PawnClass = m_Engine.FindObjectByName("PlayerPawn_Generic_C");
+
+        // Players join after the match is ready, so each one is registered
+        // by its loading screen event - the late-joiner path
+        for (int32 i = 0; i < m_Config.PlayersPerMission; ++i)
+        {
+            std::unique_ptr<FSimPlayer> Player = std::make_unique<FSimPlayer>();
+            Player->PlayerIndex = i;
+
+            snprintf(Name, sizeof(Name), "FortPlayerControllerZone_C_%d_%d", m_MissionIndex, i);
+            Player->Controller = m_Engine.CreateObject(Name, ControllerClass, m_Level);
+
+            snprintf(Name, sizeof(Name), "PlayerPawn_Generic_C_%d_%d", m_MissionIndex, i);
+            Player->PawnObject = m_Engine.CreateObject(Name, PawnClass, m_Level);
+
+            DispatchProcessEvent(Player->Controller, m_LoadedFunction, nullptr);
+
+            Player->Player = m_Instance->GetPlayer(Player->Controller);
+            if (!Player->Player || !Player->Player->GetInventoryManager() || !Player->Player->GetBuildingManager())
+                return EResult::Failed;
+
+            Player->Player->ServerAcknowledgePossession(Player->PawnObject);
+            SeedInventory(*Player->Player->GetInventoryManager());
+
+            m_Players.push_back(std::move(Player));
+        }
+
+        // The zone's default mission is replaced by one sized from FSimConfig
+        m_Mission->AbortMission();
+        return StartNextMission();
+    }
+
+    void FSimMission::Shutdown()
+    {
+        // Players, their managers and the mission manager go with the instance
+        if (m_Instance)
+            GetSTWGameMode().DestroyInstance(m_World);
+
+        m_Instance = nullptr;
+        m_Mission = nullptr;
+
+        m_Players.clear();
+        m_Spawner.Reset();
+    }
+
+    EResult FSimMission::StartNextMission()
+    {
+        m_Spawner.Reset();
+        m_MissionKills = 0;
+
+        FMissionConfig Config;
+        Config.Type = EMissionType::Unknown;           // Generic kill objective
+        Config.WaveCount = m_Config.WavesPerMission;
+        Config.MaxWaves = m_Config.WavesPerMission;
+        Config.EnemiesPerWave = m_Config.EnemiesPerWave;
+        Config.SpawnBudgetMs = m_Config.SpawnBudgetMs;
+
+        return m_Mission->StartMission(Config);
+    }
+
+    void FSimMission::SeedInventory(FInventoryManager& Inventory)
+    {
+        // Starting loadout
+        FInventoryItem Wood;
+        Wood.TemplateId = "Resource:Wood";
+        Wood.Category = EItemCategory::Resource;
+        Wood.Count = 500;
+        Wood.MaxStackSize = 999;
+        Inventory.AddItem(Wood);
+
+        FInventoryItem Ammo;
+        Ammo.TemplateId = "Ammo:AmmoDataBulletsMedium";
+        Ammo.Category = EItemCategory::Ammo;
+        Ammo.Count = 999;
+        Ammo.MaxStackSize = 999;
+        Inventory.AddItem(Ammo);
+
+        for (const char* IngredientId : SimIngredients)
+        {
+            FInventoryItem Ingredient;
+            Ingredient.TemplateId = IngredientId;
+            Ingredient.Category = EItemCategory::Crafting;
+            Ingredient.Count = 20;
+            Ingredient.MaxStackSize = 999;
+            Inventory.AddItem(Ingredient);
+        }
+
+        // Schematics the player owns - each one is a recipe
+        for (const auto& Schematic : SimSchematics)
+        {
+            FCraftingRecipe Recipe;
+            Recipe.ResultTemplateId = Schematic.ResultTemplateId;
+            Recipe.ResultCount = Schematic.ResultCount;
+            Recipe.ResultCategory = Schematic.ResultCategory;
+            Recipe.ResultMaxStackSize = Schematic.ResultMaxStackSize;
+            Recipe.Ingredients.push_back({ SimIngredients[0], Schematic.MechanicalParts });
+            Recipe.Ingredients.push_back({ SimIngredients[1], Schematic.Ore });
+            Recipe.Ingredients.push_back({ SimIngredients[2], Schematic.Powder });
+
+            Inventory.AddRecipe(Schematic.SchematicId, Recipe);
+        }
+    }
+
+    double FSimMission::Tick()
+    {
+        USS_PROFILE_ZONE("SimMission::Tick");
+
+        using FClock = std::chrono::steady_clock;
+        const FClock::time_point Start = FClock::now();
+
+        ++m_Stats.Ticks;
+
+        EMissionState State = m_Mission->GetState();
+        if (State == EMissionState::Complete || State == EMissionState::Failed)
+        {
+            if (State == EMissionState::Complete)
+                ++m_Stats.MissionsCompleted;
+            else
+                ++m_Stats.MissionsFailed;
+
+            StartNextMission();
+        }
+
+        UpdateWaves();
+
+        for (auto& Player : m_Players)
+        {
+            TickPlayer(*Player);
+        }
+
+        // Instance update - mission manager, then every player's pawn,
+        // inventory and building manager
+        DispatchProcessEvent(m_GameModeObject, m_TickFunction, nullptr);
+
+        return std::chrono::duration<double, std::milli>(FClock::now() - Start).count();
+    }
+
+    void FSimMission::UpdateWaves()
+    {
+        FMissionManager& Mission = *m_Mission;
+
+        if (!Mission.IsActive())
+            return;
+
+        const FWaveInfo& Wave = Mission.GetWaveInfo();
+
+        if (!Wave.bIsActive)
+        {
+            // Cycle waves until the kill objective completes the mission
+            Mission.StartWave(Wave.CurrentWave % m_Config.WavesPerMission + 1);
+            return;
+        }
+
+        // A wave is cleared once everything queued has spawned and died
+        if (Wave.EnemiesSpawned > 0 &&
+            !Mission.GetWaveScheduler().HasPendingSpawns() &&
+            m_Spawner.GetLiveEnemyCount() == 0)
+        {
+            Mission.EndWave();
+            ++m_Stats.WavesCompleted;
+        }
+    }
+
+    void FSimMission::TickPlayer(FSimPlayer& Player)
+    {
+        const uint64 Tick = m_Stats.Ticks + static_cast<uint64>(Player.PlayerIndex);
+
+        FInventoryManager& Inventory = *Player.Player->GetInventoryManager();
+        FBuildingManager& Building = *Player.Player->GetBuildingManager();
+        FSTWPlayerPawn* Pawn = Player.Player->GetPawn();
+
+        if (m_Config.HarvestInterval > 0 && Tick % m_Config.HarvestInterval == 0)
+        {
+            FInventoryItem Harvest;
+            Harvest.TemplateId = "Resource:Wood";
+            Harvest.Category = EItemCategory::Resource;
+            Harvest.Count = 30;
+            Harvest.MaxStackSize = 999;
+            Inventory.AddItem(Harvest);
+
+            FInventoryItem Ammo;
+            Ammo.TemplateId = "Ammo:AmmoDataBulletsMedium";
+            Ammo.Category = EItemCategory::Ammo;
+            Ammo.Count = 10;
+            Ammo.MaxStackSize = 999;
+            Inventory.AddItem(Ammo);
+
+            for (const char* IngredientId : SimIngredients)
+            {
+                FInventoryItem Ingredient;
+                Ingredient.TemplateId = IngredientId;
+                Ingredient.Category = EItemCategory::Crafting;
+                Ingredient.Count = 2;
+                Ingredient.MaxStackSize = 999;
+                Inventory.AddItem(Ingredient);
+            }
+        }
+
+        // Each RPC goes through the hook first; the game's native
+        // implementation - played by Handle* - runs after it
+        if (m_Config.BuildInterval > 0 && Tick % m_Config.BuildInterval == 0)
+        {
+            // Walk a 64x64 grid per player so placements rarely overlap
+            const uint32 Cell = Player.BuildCursor++;
+
+            FSimBuildParams Params;
+            Params.Type = SimBuildTypes[Cell % 4];
+            Params.LocationX = static_cast<float>(Cell % 64) * 512.0f;
+            Params.LocationY = static_cast<float>((Cell / 64) % 64) * 512.0f;
+            Params.LocationZ = static_cast<float>(Player.PlayerIndex) * 512.0f;
+            Params.Rotation = 0.0f;
+
+            DispatchProcessEvent(Player.Controller, m_BuildFunction, &Params);
+            HandleBuild(Player, Params);
+        }
+
+        if (m_Config.CraftInterval > 0 && Tick % m_Config.CraftInterval == 0)
+        {
+            FSimCraftParams Params;
+            Params.SchematicId = SimSchematics[(Tick / m_Config.CraftInterval) % 3].SchematicId;
+            Params.Count = 1;
+
+            DispatchProcessEvent(Player.Controller, m_CraftFunction, &Params);
+            HandleCraft(Player, Params);
+        }
+
+        if (m_Spawner.GetLiveEnemyCount() > 0)
+        {
+            std::uniform_real_distribution<float> Roll(0.0f, 1.0f);
+
+            if (Roll(m_Random) < m_Config.KillChance)
+            {
+                FSimKillParams Params;
+                Params.Enemy = m_Spawner.KillEnemy();
+                Params.Score = 10;
+
+                DispatchProcessEvent(Player.Controller, m_KillFunction, &Params);
+                HandleKill(Player, Params);
+            }
+            else
+            {
+                // Surviving husks chew on the newest build and the player
+                if (!Player.OwnedBuildings.empty())
+                {
+                    const std::string& Target = Player.OwnedBuildings.back();
+                    if (Building.DamageBuilding(Target, 25.0f, nullptr) == EResult::Success)
+                    {
+                        Building.RepairBuilding(Target, 25.0f);
+                    }
+                }
+
+                if (!Pawn)
+                    return;
+
+                if (Pawn->IsAlive())
+                {
+                    Pawn->ApplyDamage(5.0f);
+                    if (Pawn->GetHealthPercent() < 0.5f)
+                        Pawn->Heal(50.0f);
+                }
+                else if (Pawn->IsDBNO())
+                {
+                    Pawn->ReviveFromDBNO();
+                }
+            }
+        }
+    }
+
+    // ========================================================================
+    // ProcessEvent source
+    // ========================================================================
+
+    void FSimMission::DispatchProcessEvent(FStubObject* Object, FStubObject* Function, void* Params)
+    {
+        ++m_Stats.ProcessEvents;
+
+        // Same entry point as the ProcessEvent detour - routing, the
+        // instance lookup by world and the player lookup all run here
+        GetSTWGameMode().OnProcessEvent(Object, Function, Params);
+    }
+
+    void FSimMission::HandleBuild(FSimPlayer& Player, const FSimBuildParams& Params)
+    {
+        FBuildingManager& Building = *Player.Player->GetBuildingManager();
+
+        if (Building.IsAtBuildLimit() && !Player.OwnedBuildings.empty())
+        {
+            if (Building.DemolishBuilding(Player.OwnedBuildings.front()) == EResult::Success)
+                ++m_Stats.BuildsDemolished;
+
+            Player.OwnedBuildings.pop_front();
+        }
+
+        if (Building.GetCurrentBuildType() != Params.Type)
+        {
+            Building.ExitBuildMode();
+            Building.EnterBuildMode(Params.Type);
+        }
+
+        Building.UpdateBuildPreview(Params.LocationX, Params.LocationY, Params.LocationZ, Params.Rotation);
+
+        if (Building.ConfirmBuild() != EResult::Success)
+        {
+            ++m_Stats.BuildsRejected;
+            return;
+        }
+
+        ++m_Stats.BuildsPlaced;
+
+        const FBuildingPiece* Piece = Building.GetBuildingAtGrid(
+            static_cast<int32>(Params.LocationX / 512.0f),
+            static_cast<int32>(Params.LocationY / 512.0f),
+            static_cast<int32>(Params.LocationZ / 512.0f));
+
+        if (Piece)
+            Player.OwnedBuildings.push_back(Piece->BuildingId);
+
+        m_Mission->OnMissionEvent("BuildingPlaced", nullptr);
+    }
+
+    void FSimMission::HandleCraft(FSimPlayer& Player, const FSimCraftParams& Params)
+    {
+        if (Player.Player->GetInventoryManager()->CraftItem(Params.SchematicId, Params.Count) == EResult::Success)
+            ++m_Stats.CraftsSucceeded;
+        else
+            ++m_Stats.CraftsRejected;
+    }
+
+    void FSimMission::HandleKill(FSimPlayer& Player, const FSimKillParams& Params)
+    {
+        if (!Params.Enemy)
+            return;
+
+        ++m_Stats.EnemiesKilled;
+
+        Player.Player->GetInventoryManager()->ConsumeAmmo("Ammo:AmmoDataBulletsMedium", 1);
+
+        m_Mission->AddScore(Params.Score);
+        m_Mission->OnMissionEvent("EnemyKilled", Params.Enemy);
+
+        // Objectives are not activated by the manager yet, so kill events
+        // alone never complete them - drive the primary objective directly
+        m_Mission->UpdateObjectiveProgress(0, ++m_MissionKills);
+    }
+
+}
\ No newline at end of file
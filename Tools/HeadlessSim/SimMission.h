@@ -0,0 +1,207 @@
+/**
+ * UniversalSlashingSimulator - Headless Simulated Mission
+ *
+ * One zone driven without the game: a stub World with a game mode, a set
+ * of scripted player controllers and their pawns. Every player action and
+ * the per-frame Tick go through FSTWGameMode::OnProcessEvent, so routing,
+ * the per-world FMissionInstance and FPlayerControllerManager run exactly
+ * as they do in-game. The sim then applies the RPC's effect to the
+ * managers the instance owns - the part the game's native code does.
+ */
+
+#pragma once
+
+#include "../../Core/Common.h"
+#include "../../STW/GameMode/MissionInstance.h"
+#include "../../STW/Missions/MissionManager.h"
+#include "../../STW/Inventory/InventoryManager.h"
+#include "../../STW/Building/BuildingManager.h"
+#include "../../STW/Player/STWPlayerController.h"
+#include "StubEngine.h"
+#include <deque>
+#include <random>
+
+namespace USS
+{
+    /**
+     * Simulation parameters shared by all missions
+     */
+    struct FSimConfig
+    {
+        int32 PlayersPerMission;
+        int32 WavesPerMission;
+        int32 EnemiesPerWave;
+        float SpawnBudgetMs;
+
+        // Player script cadence (ticks)
+        int32 BuildInterval;
+        int32 CraftInterval;
+        int32 HarvestInterval;
+        float KillChance;               // Per player per tick, when enemies are alive
+
+        uint32 Seed;
+
+        FSimConfig()
+            : PlayersPerMission(4)
+            , WavesPerMission(3)
+            , EnemiesPerWave(20)
+            , SpawnBudgetMs(0.25f)
+            , BuildInterval(15)
+            , CraftInterval(60)
+            , HarvestInterval(10)
+            , KillChance(0.25f)
+            , Seed(1337)
+        {}
+    };
+
+    /**
+     * Counters accumulated over a mission's lifetime
+     */
+    struct FSimMissionStats
+    {
+        uint64 Ticks;
+        uint64 ProcessEvents;
+        uint64 MissionsCompleted;
+        uint64 MissionsFailed;
+        uint64 WavesCompleted;
+        uint64 EnemiesKilled;
+        uint64 BuildsPlaced;
+        uint64 BuildsRejected;
+        uint64 BuildsDemolished;
+        uint64 CraftsSucceeded;
+        uint64 CraftsRejected;
+
+        FSimMissionStats()
+            : Ticks(0)
+            , ProcessEvents(0)
+            , MissionsCompleted(0)
+            , MissionsFailed(0)
+            , WavesCompleted(0)
+            , EnemiesKilled(0)
+            , BuildsPlaced(0)
+            , BuildsRejected(0)
+            , BuildsDemolished(0)
+            , CraftsSucceeded(0)
+            , CraftsRejected(0)
+        {}
+    };
+
+    // ProcessEvent parameter blocks for the simulated server RPCs
+    struct FSimBuildParams
+    {
+        EBuildingType Type;
+        float LocationX;
+        float LocationY;
+        float LocationZ;
+        float Rotation;
+    };
+
+    struct FSimCraftParams
+    {
+        const char* SchematicId;
+        int32 Count;
+    };
+
+    struct FSimKillParams
+    {
+        void* Enemy;
+        int32 Score;
+    };
+
+    /**
+     * Scripted player
+     *
+     * Player is owned by the instance's FPlayerControllerManager and holds
+     * the inventory, building manager and pawn the script acts on.
+     */
+    struct FSimPlayer
+    {
+        int32 PlayerIndex;
+        FStubObject* Controller;
+        FStubObject* PawnObject;
+        FSTWPlayerController* Player;
+
+        std::deque<std::string> OwnedBuildings;     // Oldest first, demolished at the build limit
+        uint32 BuildCursor;
+
+        FSimPlayer()
+            : PlayerIndex(0)
+            , Controller(nullptr)
+            , PawnObject(nullptr)
+            , Player(nullptr)
+            , BuildCursor(0)
+        {}
+    };
+
+    /**
+     * Simulated mission
+     *
+     * Initialize() creates stub objects and must run on the setup thread,
+     * after FSTWGameMode::Initialize() with room for PlayersPerMission
+     * players. Tick() only touches this mission's
+     * instance, so distinct missions can be ticked from different threads.
+     */
+    class FSimMission
+    {
+    public:
+        FSimMission(FStubEngine& Engine, const FSimConfig& Config, int32 MissionIndex);
+        ~FSimMission();
+
+        USS_NON_COPYABLE(FSimMission)
+        USS_NON_MOVABLE(FSimMission)
+
+        EResult Initialize();
+        void Shutdown();
+
+        /**
+         * Advance the mission and all players by one tick
+         * @return Wall time spent in milliseconds
+         */
+        double Tick();
+
+        int32 GetMissionIndex() const { return m_MissionIndex; }
+        const FSimMissionStats& GetStats() const { return m_Stats; }
+
+    private:
+        EResult StartNextMission();
+        void SeedInventory(FInventoryManager& Inventory);
+        void UpdateWaves();
+        void TickPlayer(FSimPlayer& Player);
+
+        // ProcessEvent source - Object is the calling actor
+        void DispatchProcessEvent(FStubObject* Object, FStubObject* Function, void* Params);
+        void HandleBuild(FSimPlayer& Player, const FSimBuildParams& Params);
+        void HandleCraft(FSimPlayer& Player, const FSimCraftParams& Params);
+        void HandleKill(FSimPlayer& Player, const FSimKillParams& Params);
+
+        FStubEngine& m_Engine;
+        FSimConfig m_Config;
+        int32 m_MissionIndex;
+
+        // World -> PersistentLevel -> actors
+        FStubObject* m_World;
+        FStubObject* m_Level;
+        FStubObject* m_GameModeObject;
+
+        // Owned by FSTWGameMode, valid between Initialize and Shutdown
+        FMissionInstance* m_Instance;
+        FMissionManager* m_Mission;
+
+        FStubEnemySpawner m_Spawner;
+        std::vector<std::unique_ptr<FSimPlayer>> m_Players;
+
+        // Cached UFunction* for routing
+        FStubObject* m_ReadyFunction;
+        FStubObject* m_LoadedFunction;
+        FStubObject* m_TickFunction;
+        FStubObject* m_BuildFunction;
+        FStubObject* m_CraftFunction;
+        FStubObject* m_KillFunction;
+
+        int32 m_MissionKills;
+
+        std::mt19937 m_Random;
+        FSimMissionStats m_Stats;
+    };
+
+}
\ No newline at end of file
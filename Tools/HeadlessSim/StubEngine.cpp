@@ -0,0 +1,288 @@
+/**
+ * UniversalSlashingSimulator - Headless Stub Engine Implementation
+ */
+
+#include "StubEngine.h"
+#include "../../Engine/EngineCore.h"
+
+namespace USS
+{
+    // ========================================================================
+    // FStubNamePool
+    // ========================================================================
+
+    FStubNamePool::FStubNamePool()
+    {
+        // Index 0 is always "None"
+        AddName("None");
+    }
+
+    bool FStubNamePool::GetName(int32 ComparisonIndex, FResolvedName& OutName) const
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        if (ComparisonIndex < 0 || ComparisonIndex >= static_cast<int32>(m_Names.size()))
+            return false;
+
+        const std::string& Name = m_Names[ComparisonIndex];
+        OutName.AnsiName = Name.c_str();
+        OutName.WideName = nullptr;
+        OutName.bIsWide = false;
+        OutName.Length = static_cast<int32>(Name.size());
+        return true;
+    }
+
+    std::string FStubNamePool::GetNameString(int32 ComparisonIndex) const
+    {
+        FResolvedName Name;
+        return GetName(ComparisonIndex, Name) ? Name.ToString() : "";
+    }
+
+    bool FStubNamePool::IsValidIndex(int32 Index) const
+    {
+        FScopedLock Lock(m_CriticalSection);
+        return Index >= 0 && Index < static_cast<int32>(m_Names.size());
+    }
+
+    int32 FStubNamePool::Num() const
+    {
+        FScopedLock Lock(m_CriticalSection);
+        return static_cast<int32>(m_Names.size());
+    }
+
+    EResult FStubNamePool::Initialize(uintptr Address)
+    {
+        // Nothing to resolve - the pool lives in this process
+        (void)Address;
+        return EResult::Success;
+    }
+
+    int32 FStubNamePool::AddName(const std::string& Name)
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        auto It = m_NameToIndex.find(Name);
+        if (It != m_NameToIndex.end())
+            return It->second;
+
+        int32 Index = static_cast<int32>(m_Names.size());
+        m_Names.push_back(Name);
+        m_NameToIndex[Name] = Index;
+        return Index;
+    }
+
+    // ========================================================================
+    // FStubObjectArray
+    // ========================================================================
+
+    int32 FStubObjectArray::Num() const
+    {
+        FScopedLock Lock(m_CriticalSection);
+        return static_cast<int32>(m_Objects.size());
+    }
+
+    void* FStubObjectArray::GetByIndex(int32 Index) const
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        if (Index < 0 || Index >= static_cast<int32>(m_Objects.size()))
+            return nullptr;
+
+        return m_Objects[Index].get();
+    }
+
+    bool FStubObjectArray::GetItemByIndex(int32 Index, FObjectItem& OutItem) const
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        if (Index < 0 || Index >= static_cast<int32>(m_Objects.size()))
+            return false;
+
+        OutItem.Object = m_Objects[Index].get();
+        OutItem.Flags = 0;
+        OutItem.ClusterIndex = -1;
+        OutItem.SerialNumber = 0;
+        return true;
+    }
+
+    bool FStubObjectArray::IsValidIndex(int32 Index) const
+    {
+        FScopedLock Lock(m_CriticalSection);
+        return Index >= 0 && Index < static_cast<int32>(m_Objects.size());
+    }
+
+    EResult FStubObjectArray::Initialize(uintptr Address)
+    {
+        (void)Address;
+        return EResult::Success;
+    }
+
+    FStubObject* FStubObjectArray::Add(std::unique_ptr<FStubObject> Object)
+    {
+        FScopedLock Lock(m_CriticalSection);
+
+        Object->InternalIndex = static_cast<int32>(m_Objects.size());
+        m_Objects.push_back(std::move(Object));
+        return m_Objects.back().get();
+    }
+
+    // ========================================================================
+    // FStubEngine
+    // ========================================================================
+
+    FStubEngine::FStubEngine()
+        : m_OwnedNamePool(std::make_unique<FStubNamePool>())
+        , m_OwnedObjectArray(std::make_unique<FStubObjectArray>())
+        , m_pNamePool(m_OwnedNamePool.get())
+        , m_pObjectArray(m_OwnedObjectArray.get())
+        , m_bInstalled(false)
+        , m_ClassClass(nullptr)
+        , m_FunctionClass(nullptr)
+    {
+    }
+
+    FStubEngine::~FStubEngine()
+    {
+        // The core frees the tables; nothing here touches them afterwards
+        if (m_bInstalled)
+            GetEngineCore().Shutdown();
+    }
+
+    EResult FStubEngine::Initialize()
+    {
+        if (m_ClassClass)
+            return EResult::AlreadyInitialized;
+
+        // Checked up front - a rejected InitializeWithTables would free
+        // the tables out from under m_pObjectArray / m_pNamePool
+        if (GetEngineCore().IsInitialized())
+            return EResult::AlreadyInitialized;
+
+        // UClass is its own class
+        m_ClassClass = CreateObject("Class", nullptr);
+        m_ClassClass->Class = m_ClassClass;
+
+        m_FunctionClass = CreateClass("Function");
+
+        // Actors the STW layer looks up by name
+        FStubObject* MissionManagerClass = CreateClass("FortMissionManager");
+        CreateObject("FortMissionManager", MissionManagerClass);
+
+        // Per-mission World -> Level -> actor chains hang off these, so
+        // GetObjectWorld() can route events to the owning instance
+        CreateClass("World");
+        CreateClass("Level");
+        CreateClass("FortGameModeZone");
+
+        CreateClass("FortPlayerControllerZone_C");
+        CreateClass("PlayerPawn_Generic_C");
+
+        // Husk blueprint classes, registered by short name like FindClass expects
+        for (const auto& Path : GetDefaultHuskSpawnClasses())
+        {
+            size_t Dot = Path.find_last_of('.');
+            CreateClass(Dot != std::string::npos ? Path.substr(Dot + 1) : Path);
+        }
+
+        // UFunctions routed by the simulation's ProcessEvent source
+        static const char* FunctionNames[] = {
+            "ReadyToStartMatch",
+            "ServerLoadingScreenDropped",
+            "ServerCreateBuildingActor",
+            "ServerCraftSchematic",
+            "ServerHandleEnemyKilled",
+            "ServerAttemptInventoryDrop",
+            "Tick",
+        };
+
+        for (const char* Name : FunctionNames)
+        {
+            m_Functions[Name] = CreateObject(Name, m_FunctionClass);
+        }
+
+        EResult Result = GetEngineCore().InitializeWithTables(std::move(m_OwnedObjectArray), std::move(m_OwnedNamePool));
+        if (Result != EResult::Success)
+            return Result;
+
+        m_bInstalled = true;
+        return EResult::Success;
+    }
+
+    FStubObject* FStubEngine::CreateObject(const std::string& Name, FStubObject* Class, FStubObject* Outer)
+    {
+        std::unique_ptr<FStubObject> Object = std::make_unique<FStubObject>();
+        Object->Class = Class;
+        Object->Outer = Outer;
+        Object->Name = FNameCompact(m_pNamePool->AddName(Name), 0);
+
+        FStubObject* Raw = m_pObjectArray->Add(std::move(Object));
+
+        // First object wins, matching FindObjectByName's linear search
+        m_ObjectsByName.emplace(Name, Raw);
+        return Raw;
+    }
+
+    FStubObject* FStubEngine::CreateClass(const std::string& Name)
+    {
+        return CreateObject(Name, m_ClassClass);
+    }
+
+    FStubObject* FStubEngine::FindObjectByName(const std::string& Name) const
+    {
+        auto It = m_ObjectsByName.find(Name);
+        return (It != m_ObjectsByName.end()) ? It->second : nullptr;
+    }
+
+    std::string FStubEngine::GetObjectName(const void* Object) const
+    {
+        if (!Object)
+            return "";
+
+        return m_pNamePool->GetNameString(static_cast<const FStubObject*>(Object)->Name.ComparisonIndex);
+    }
+
+    FStubObject* FStubEngine::FindFunction(const std::string& Name) const
+    {
+        auto It = m_Functions.find(Name);
+        return (It != m_Functions.end()) ? It->second : nullptr;
+    }
+
+    // ========================================================================
+    // FStubEnemySpawner
+    // ========================================================================
+
+    FStubEnemySpawner::FStubEnemySpawner(const FStubEngine& Engine)
+        : m_Engine(Engine)
+    {
+    }
+
+    void* FStubEnemySpawner::ResolveSpawnClass(const std::string& ClassPath)
+    {
+        size_t Dot = ClassPath.find_last_of('.');
+        std::string ShortName = (Dot != std::string::npos) ? ClassPath.substr(Dot + 1) : ClassPath;
+        return m_Engine.FindObjectByName(ShortName);
+    }
+
+    EResult FStubEnemySpawner::SpawnEnemy(void* SpawnClass, const FSpawnRequest& Request)
+    {
+        // Placement is the real spawner's job - only the count matters here
+        (void)Request;
+
+        if (!SpawnClass)
+            return EResult::InvalidParameter;
+
+        m_LiveEnemies.push_back(SpawnClass);
+        return EResult::Success;
+    }
+
+    void* FStubEnemySpawner::KillEnemy()
+    {
+        if (m_LiveEnemies.empty())
+            return nullptr;
+
+        void* Enemy = m_LiveEnemies.back();
+        m_LiveEnemies.pop_back();
+        return Enemy;
+    }
+
+}
\ No newline at end of file
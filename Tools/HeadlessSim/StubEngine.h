@@ -0,0 +1,176 @@
+/**
+ * UniversalSlashingSimulator - Headless Stub Engine
+ *
+ * Minimal in-process stand-in for the engine globals used by the STW
+ * layer: a flat object array, a name pool and a ProcessEvent source.
+ * Objects are plain heap blocks laid out like the default UObject header
+ * so wrappers reading the usual offsets see sensible values.
+ */
+
+#pragma once
+
+#include "../../Core/Common.h"
+#include "../../Engine/CoreTypes/ObjectArray.h"
+#include "../../Engine/CoreTypes/NamePool.h"
+#include "../../STW/Missions/WaveScheduler.h"
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace USS
+{
+    /**
+     * Fake UObject header (matches the default 0x28 UObject layout)
+     *
+     * Zero padding after the header stands in for UStruct/UClass members,
+     * so reflection walks over stub classes see an empty property chain.
+     */
+    struct FStubObject
+    {
+        void* VTable;                   // 0x00
+        int32 ObjectFlags;              // 0x08
+        int32 InternalIndex;            // 0x0C
+        FStubObject* Class;             // 0x10
+        FNameCompact Name;              // 0x18
+        FStubObject* Outer;             // 0x20
+        uint8 Reserved[0x200];          // 0x28
+
+        FStubObject()
+            : VTable(nullptr)
+            , ObjectFlags(0)
+            , InternalIndex(-1)
+            , Class(nullptr)
+            , Outer(nullptr)
+            , Reserved()
+        {}
+    };
+
+    /**
+     * Name pool backed by a string table
+     */
+    class FStubNamePool : public INamePool
+    {
+    public:
+        FStubNamePool();
+        ~FStubNamePool() override = default;
+
+        bool GetName(int32 ComparisonIndex, FResolvedName& OutName) const override;
+        std::string GetNameString(int32 ComparisonIndex) const override;
+        bool IsValidIndex(int32 Index) const override;
+        int32 Num() const override;
+        EResult Initialize(uintptr Address) override;
+        bool IsInitialized() const override { return true; }
+
+        // Returns the existing index if the name is already present
+        int32 AddName(const std::string& Name);
+
+    private:
+        mutable FCriticalSection m_CriticalSection;
+        std::deque<std::string> m_Names;                // deque keeps c_str() stable
+        std::unordered_map<std::string, int32> m_NameToIndex;
+    };
+
+    /**
+     * Object array backed by heap-allocated stub objects
+     */
+    class FStubObjectArray : public IObjectArray
+    {
+    public:
+        FStubObjectArray() = default;
+        ~FStubObjectArray() override = default;
+
+        int32 Num() const override;
+        void* GetByIndex(int32 Index) const override;
+        bool GetItemByIndex(int32 Index, FObjectItem& OutItem) const override;
+        bool IsValidIndex(int32 Index) const override;
+        EResult Initialize(uintptr Address) override;
+        bool IsInitialized() const override { return true; }
+
+        // Takes ownership, assigns InternalIndex
+        FStubObject* Add(std::unique_ptr<FStubObject> Object);
+
+    private:
+        mutable FCriticalSection m_CriticalSection;
+        std::vector<std::unique_ptr<FStubObject>> m_Objects;
+    };
+
+    /**
+     * Headless engine: builds the stub object array and name pool and
+     * installs them as the engine core's tables, so core lookups and
+     * weak object handles resolve against the stub objects
+     *
+     * Setup (CreateObject etc.) is expected to happen on one thread before
+     * missions start; lookups are safe from any thread afterwards.
+     */
+    class FStubEngine
+    {
+    public:
+        FStubEngine();
+        ~FStubEngine();
+
+        USS_NON_COPYABLE(FStubEngine)
+        USS_NON_MOVABLE(FStubEngine)
+
+        /**
+         * Populate the object array with the classes and functions the
+         * STW layer and the simulation look up, then hand both tables to
+         * the engine core. The core owns them until this is destroyed.
+         */
+        EResult Initialize();
+
+        // Object creation / lookup
+        FStubObject* CreateObject(const std::string& Name, FStubObject* Class, FStubObject* Outer = nullptr);
+        FStubObject* CreateClass(const std::string& Name);
+        FStubObject* FindObjectByName(const std::string& Name) const;
+        std::string GetObjectName(const void* Object) const;
+
+        // ProcessEvent source - fake UFunction* by name
+        FStubObject* FindFunction(const std::string& Name) const;
+
+        IObjectArray& GetObjectArray() { return *m_pObjectArray; }
+        INamePool& GetNamePool() { return *m_pNamePool; }
+
+    private:
+        // Held here until Initialize moves them into the engine core
+        std::unique_ptr<FStubNamePool> m_OwnedNamePool;
+        std::unique_ptr<FStubObjectArray> m_OwnedObjectArray;
+
+        FStubNamePool* m_pNamePool;
+        FStubObjectArray* m_pObjectArray;
+        bool m_bInstalled;
+
+        std::unordered_map<std::string, FStubObject*> m_ObjectsByName;
+        std::unordered_map<std::string, FStubObject*> m_Functions;
+
+        FStubObject* m_ClassClass;
+        FStubObject* m_FunctionClass;
+    };
+
+    /**
+     * Enemy spawner that resolves classes against the stub engine and
+     * tracks live enemies instead of spawning actors
+     */
+    class FStubEnemySpawner : public IEnemySpawner
+    {
+    public:
+        explicit FStubEnemySpawner(const FStubEngine& Engine);
+
+        void* ResolveSpawnClass(const std::string& ClassPath) override;
+        EResult SpawnEnemy(void* SpawnClass, const FSpawnRequest& Request) override;
+
+        int32 GetLiveEnemyCount() const { return static_cast<int32>(m_LiveEnemies.size()); }
+
+        /**
+         * Remove one live enemy
+         * @return The enemy's class, or nullptr if none are alive
+         */
+        void* KillEnemy();
+        void Reset() { m_LiveEnemies.clear(); }
+
+    private:
+        const FStubEngine& m_Engine;
+        std::vector<void*> m_LiveEnemies;
+    };
+
+}
\ No newline at end of file
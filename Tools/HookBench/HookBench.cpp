@@ -0,0 +1,368 @@
+/**
+ * UniversalSlashingSimulator - Hook Overhead Benchmark
+ *
+ * Splits the cost of one ProcessEvent detour into its layers, measured
+ * one at a time against the stub engine so it runs without the game:
+ *
+ *   direct call            the native function alone, for a baseline
+ *   detour                 detour -> trampoline -> native, wired through
+ *                          FHookRegistry the way the DLL installs it
+ *   detour + counter       the same with a per-hook FScopedHookCounter
+ *   route-cache reject     FSTWGameMode::OnProcessEvent on a function
+ *                          it doesn't route (one hash probe)
+ *   dispatcher reject      FProcessEventDispatcher with no matching
+ *                          handler (names decoded, nothing parsed)
+ *   dispatcher parse       the same with a match-all handler, parsing a
+ *                          synthetic UFunction's parameter chain
+ *   name decode            one FName -> string through the name pool
+ *
+ * The fake hook backend patches nothing, so the detour case leaves out
+ * the two jumps MinHook adds on Windows (patched prologue into the
+ * detour, trampoline back into the native body). Both are direct jumps
+ * and predict well; the number is a floor.
+ *
+ * Usage:
+ *   USSHookBench [-iterations N] [-params N] [-trace File.json]
+ *
+ * Built with USS_PROFILE, so the per-hook counters recorded along the
+ * way are printed at the end and -trace includes them.
+ */
+
+#include "../HeadlessSim/StubEngine.h"
+#include "../HeadlessSim/FakeHookBackend.h"
+#include "../../Core/Diagnostics/Profiler.h"
+#include "../../Core/Hooks/HookRegistry.h"
+#include "../../Engine/Events/ProcessEventDispatcher.h"
+#include "../../STW/GameMode/STWGameMode.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace USS;
+
+namespace
+{
+    struct FBenchOptions
+    {
+        int32 Iterations = 1000000;
+        int32 Params = 6;               // Parameters on the synthetic UFunction
+        std::string TracePath;
+    };
+
+    // FUPropertyIterator's pre-4.25 fallbacks - the resolver never runs headless
+    constexpr int32 PropertyLinkOffset = 0x50;
+    constexpr int32 PropertyNextOffset = 0x30;
+    constexpr int32 PropertyArrayDimOffset = 0x38;
+    constexpr int32 PropertyElementSizeOffset = 0x3C;
+    constexpr int32 PropertyFlagsOffset = 0x40;
+    constexpr int32 PropertyOffsetOffset = 0x4C;
+
+    // Every parameter gets an 8-byte slot in the parameter block
+    constexpr int32 ParamSlotSize = 8;
+    constexpr int32 MaxParams = 32;
+
+    //=========================================================================
+    // Detour chain
+    //=========================================================================
+
+    volatile uint64 g_NativeCalls = 0;
+
+    // One copy per detour, as each hook needs a target of its own
+    template<int32 Index>
+    void NativeProcessEvent(void* Object, void* Function, void* Params)
+    {
+        (void)Object;
+        (void)Function;
+        (void)Params;
+        g_NativeCalls = g_NativeCalls + 1;
+    }
+
+    ProcessEventFn g_OriginalProcessEvent = nullptr;
+    ProcessEventFn g_OriginalCountedProcessEvent = nullptr;
+    uint16 g_DetourCounterId = FProfiler::InvalidCounter;
+
+    void DetourProcessEvent(void* Object, void* Function, void* Params)
+    {
+        g_OriginalProcessEvent(Object, Function, Params);
+    }
+
+    void CountedDetourProcessEvent(void* Object, void* Function, void* Params)
+    {
+        FScopedHookCounter Counter(g_DetourCounterId);
+        g_OriginalCountedProcessEvent(Object, Function, Params);
+    }
+
+    // Called through these so the compiler can't inline the chain away
+    ProcessEventFn volatile g_CallDirect = &NativeProcessEvent<0>;
+    ProcessEventFn volatile g_CallDetour = &DetourProcessEvent;
+    ProcessEventFn volatile g_CallCountedDetour = &CountedDetourProcessEvent;
+
+    //=========================================================================
+    // Synthetic reflection
+    //=========================================================================
+
+    template<typename T>
+    void WriteField(FStubObject* Object, int32 Offset, T Value)
+    {
+        memcpy(reinterpret_cast<uint8*>(Object) + Offset, &Value, sizeof(T));
+    }
+
+    /**
+     * UFunction with a PropertyLink chain of Count parameters, cycling
+     * through int/float/object property classes
+     */
+    FStubObject* CreateSyntheticFunction(FStubEngine& Engine, int32 Count)
+    {
+        static const char* const PropertyClasses[] = { "IntProperty", "FloatProperty", "ObjectProperty" };
+
+        FStubObject* Function = Engine.CreateObject("BenchSyntheticFunction", Engine.FindObjectByName("Function"));
+        FStubObject* Previous = nullptr;
+
+        for (int32 i = 0; i < Count; ++i)
+        {
+            const char* ClassName = PropertyClasses[i % 3];
+            FStubObject* PropertyClass = Engine.FindObjectByName(ClassName);
+            if (!PropertyClass)
+                PropertyClass = Engine.CreateClass(ClassName);
+
+            char Name[32];
+            snprintf(Name, sizeof(Name), "Param%d", i);
+
+            FStubObject* Property = Engine.CreateObject(Name, PropertyClass, Function);
+            WriteField<int32>(Property, PropertyArrayDimOffset, 1);
+            WriteField<int32>(Property, PropertyElementSizeOffset, i % 3 == 2 ? 8 : 4);
+            WriteField<uint64>(Property, PropertyFlagsOffset, EPropertyFlags::CPF_Parm);
+            WriteField<int32>(Property, PropertyOffsetOffset, i * ParamSlotSize);
+
+            if (Previous)
+                WriteField<FStubObject*>(Previous, PropertyNextOffset, Property);
+            else
+                WriteField<FStubObject*>(Function, PropertyLinkOffset, Property);
+
+            Previous = Property;
+        }
+
+        return Function;
+    }
+
+    //=========================================================================
+    // Measurement
+    //=========================================================================
+
+    struct FBenchResult
+    {
+        double NsPerCall = 0.0;
+        double CyclesPerCall = 0.0;
+    };
+
+    template<typename Callback>
+    FBenchResult Measure(int32 Iterations, Callback&& Func)
+    {
+        // Warm caches and branch predictors before the timed run
+        for (int32 i = 0; i < Iterations / 10; ++i)
+            Func();
+
+        using FClock = std::chrono::steady_clock;
+        const FClock::time_point Start = FClock::now();
+        const uint64 StartCycles = FProfiler::ReadCycles();
+
+        for (int32 i = 0; i < Iterations; ++i)
+            Func();
+
+        const uint64 Cycles = FProfiler::ReadCycles() - StartCycles;
+        const double Ns = std::chrono::duration<double, std::nano>(FClock::now() - Start).count();
+
+        FBenchResult Result;
+        Result.NsPerCall = Ns / Iterations;
+        Result.CyclesPerCall = static_cast<double>(Cycles) / Iterations;
+        return Result;
+    }
+
+    void PrintResult(const char* Label, const FBenchResult& Result, const FBenchResult& Baseline)
+    {
+        printf("  %-22s %9.2f ns  %10.1f cycles  (+%.1f cycles)\n",
+            Label, Result.NsPerCall, Result.CyclesPerCall, Result.CyclesPerCall - Baseline.CyclesPerCall);
+    }
+
+    bool ParseArguments(int Argc, char** Argv, FBenchOptions& Options)
+    {
+        for (int i = 1; i < Argc; ++i)
+        {
+            const char* Arg = Argv[i];
+            const char* Value = (i + 1 < Argc) ? Argv[i + 1] : nullptr;
+
+            if (strcmp(Arg, "-help") == 0 || strcmp(Arg, "--help") == 0)
+                return false;
+
+            if (!Value)
+            {
+                fprintf(stderr, "Missing value for %s\n", Arg);
+                return false;
+            }
+
+            if (strcmp(Arg, "-iterations") == 0)    Options.Iterations = atoi(Value);
+            else if (strcmp(Arg, "-params") == 0)   Options.Params = atoi(Value);
+            else if (strcmp(Arg, "-trace") == 0)    Options.TracePath = Value;
+            else
+            {
+                fprintf(stderr, "Unknown argument: %s\n", Arg);
+                return false;
+            }
+
+            ++i;
+        }
+
+        return Options.Iterations > 0 && Options.Params >= 0 && Options.Params <= MaxParams;
+    }
+
+    void PrintUsage()
+    {
+        printf("Usage: USSHookBench [-iterations N] [-params N] [-trace File.json]\n");
+        printf("                    -params is 0..%d\n", MaxParams);
+    }
+}
+
+int main(int Argc, char** Argv)
+{
+    FBenchOptions Options;
+    if (!ParseArguments(Argc, Argv, Options))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    FStubEngine Engine;
+    if (Engine.Initialize() != EResult::Success)
+    {
+        fprintf(stderr, "Failed to initialize stub engine\n");
+        return 1;
+    }
+
+    FStubObject* Object = Engine.CreateObject("BenchObject", Engine.FindObjectByName("FortPlayerControllerZone_C"));
+    FStubObject* UnroutedFunction = Engine.CreateObject("BenchUnroutedFunction", Engine.FindObjectByName("Function"));
+    FStubObject* SyntheticFunction = CreateSyntheticFunction(Engine, Options.Params);
+
+    uint8 ParamBlock[MaxParams * ParamSlotSize] = {};
+
+    // Detours go in the way EngineCore installs them, minus the patching
+    FFakeHookBackend Backend;
+    FHookRegistry Registry(Backend);
+
+    if (Registry.Initialize() != EResult::Success)
+    {
+        fprintf(stderr, "Failed to initialize hook registry\n");
+        return 1;
+    }
+
+    Registry.RegisterRaw("BenchDetour", reinterpret_cast<void*>(&NativeProcessEvent<0>),
+        reinterpret_cast<void*>(&DetourProcessEvent), reinterpret_cast<void**>(&g_OriginalProcessEvent));
+    Registry.RegisterRaw("BenchCountedDetour", reinterpret_cast<void*>(&NativeProcessEvent<1>),
+        reinterpret_cast<void*>(&CountedDetourProcessEvent), reinterpret_cast<void**>(&g_OriginalCountedProcessEvent));
+    Registry.InstallPending();
+
+    if (!g_OriginalProcessEvent || !g_OriginalCountedProcessEvent)
+    {
+        fprintf(stderr, "Hook registry didn't hand back trampolines\n");
+        return 1;
+    }
+
+    g_DetourCounterId = FProfiler::RegisterCounter("BenchCountedDetour");
+
+    // The generic path the DLL runs every ProcessEvent through
+    if (GetSTWGameMode().Initialize(FSTWGameConfig()) != EResult::Success)
+    {
+        fprintf(stderr, "Failed to initialize STW game mode\n");
+        return 1;
+    }
+
+    FProcessEventDispatcher RejectDispatcher;
+    FProcessEventDispatcher ParseDispatcher;
+
+    if (RejectDispatcher.Initialize() != EResult::Success || ParseDispatcher.Initialize() != EResult::Success)
+    {
+        fprintf(stderr, "Failed to initialize ProcessEvent dispatcher\n");
+        return 1;
+    }
+
+    FEventFilter NeverMatches;
+    NeverMatches.FunctionNameFilter = "BenchNeverCalled";
+    RejectDispatcher.RegisterHandler("BenchReject", NeverMatches,
+        [](FProcessEventContext&) -> bool { return true; });
+
+    size_t ParsedParams = 0;
+    ParseDispatcher.RegisterHandler("BenchParse", FEventFilter(),
+        [&ParsedParams](FProcessEventContext& Context) -> bool
+        {
+            ParsedParams = Context.Params.size();
+            return true;
+        });
+
+    const INamePool& NamePool = Engine.GetNamePool();
+    const int32 NameIndex = Object->Name.ComparisonIndex;
+    size_t DecodedLength = 0;
+
+    printf("Hook overhead: %d iterations, %d synthetic parameters\n\n", Options.Iterations, Options.Params);
+
+    const int32 Iterations = Options.Iterations;
+
+    const FBenchResult Direct = Measure(Iterations, [&]() { g_CallDirect(Object, UnroutedFunction, ParamBlock); });
+    const FBenchResult Detour = Measure(Iterations, [&]() { g_CallDetour(Object, UnroutedFunction, ParamBlock); });
+    const FBenchResult Counted = Measure(Iterations, [&]() { g_CallCountedDetour(Object, UnroutedFunction, ParamBlock); });
+    const FBenchResult RouteReject = Measure(Iterations, [&]()
+    {
+        GetSTWGameMode().OnProcessEvent(Object, UnroutedFunction, ParamBlock);
+    });
+    const FBenchResult DispatchReject = Measure(Iterations, [&]()
+    {
+        RejectDispatcher.OnProcessEvent(Object, UnroutedFunction, ParamBlock);
+    });
+    const FBenchResult DispatchParse = Measure(Iterations, [&]()
+    {
+        ParseDispatcher.OnProcessEvent(Object, SyntheticFunction, ParamBlock);
+    });
+    const FBenchResult NameDecode = Measure(Iterations, [&]()
+    {
+        DecodedLength += NamePool.GetNameString(NameIndex).size();
+    });
+
+    printf("Per call (extra cycles over the direct call):\n");
+    PrintResult("direct call", Direct, Direct);
+    PrintResult("detour", Detour, Direct);
+    PrintResult("detour + counter", Counted, Direct);
+    PrintResult("route-cache reject", RouteReject, Direct);
+    PrintResult("dispatcher reject", DispatchReject, Direct);
+    PrintResult("dispatcher parse", DispatchParse, Direct);
+    PrintResult("name decode", NameDecode, Direct);
+
+    if (ParsedParams != static_cast<size_t>(Options.Params))
+    {
+        fprintf(stderr, "\nDispatcher parsed %zu of %d parameters\n", ParsedParams, Options.Params);
+        return 1;
+    }
+
+    printf("\n  %d parameters parsed per dispatch, %zu name bytes decoded\n", Options.Params, DecodedLength);
+
+    const std::vector<FProfileCounterSummary> Counters = FProfiler::GetCounterSummaries();
+    if (!Counters.empty())
+    {
+        printf("\nProfiler hook counters:\n");
+        for (const auto& Counter : Counters)
+        {
+            printf("  %-34s calls %10llu  cycles/call %9.1f\n",
+                Counter.Name.c_str(), static_cast<unsigned long long>(Counter.Calls), Counter.CyclesPerCall);
+        }
+    }
+
+    if (!Options.TracePath.empty())
+    {
+        if (FProfiler::ExportChromeTrace(Options.TracePath.c_str()) == EResult::Success)
+            printf("\nWrote Chrome trace to %s\n", Options.TracePath.c_str());
+        else
+            fprintf(stderr, "Failed to write trace %s\n", Options.TracePath.c_str());
+    }
+
+    GetSTWGameMode().Shutdown();
+    Registry.Shutdown();
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,299 @@
+/**
+ * UniversalSlashingSimulator - Binary Log Decoder
+ *
+ * Renders a .usslog written with ELogFileFormat::Binary back into the
+ * same text lines the live logger produces. The file carries its own
+ * format strings, so no matching DLL build is needed.
+ *
+ * Usage:
+ *   USSLogDecoder <Input.usslog> [-o Output.txt] [-sites]
+ *
+ * -sites prints a per-call-site count table (noisiest first) instead of
+ * the log lines.
+ */
+
+#include "../../Core/Logging/Log.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace USS;
+
+namespace
+{
+    struct FDecodedSite
+    {
+        std::string Format;
+        std::string File;
+        uint32 Line = 0;
+        ELogLevel Level = ELogLevel::Info;
+        uint64 Calls = 0;
+        uint64 Bytes = 0;
+    };
+
+    /**
+     * Bounds-checked cursor over the whole file
+     */
+    class FByteReader
+    {
+    public:
+        explicit FByteReader(const std::vector<uint8>& Data)
+            : m_Data(Data)
+            , m_Offset(0)
+        {}
+
+        bool AtEnd() const { return m_Offset >= m_Data.size(); }
+        uint32 GetOffset() const { return m_Offset; }
+
+        bool ReadBytes(void* Out, uint32 Size)
+        {
+            if (Size > m_Data.size() - m_Offset)
+                return false;
+
+            memcpy(Out, m_Data.data() + m_Offset, Size);
+            m_Offset += Size;
+            return true;
+        }
+
+        template<typename T>
+        bool Read(T& Out) { return ReadBytes(&Out, sizeof(T)); }
+
+        bool ReadVar(uint64& Out)
+        {
+            return DecodeVarInt(m_Data.data(), static_cast<uint32>(m_Data.size()), m_Offset, Out);
+        }
+
+        // Length-prefixed span, returned in place
+        bool ReadSpan(const uint8*& OutData, uint32& OutSize)
+        {
+            uint64 Size = 0;
+            if (!ReadVar(Size) || Size > m_Data.size() - m_Offset)
+                return false;
+
+            OutData = m_Data.data() + m_Offset;
+            OutSize = static_cast<uint32>(Size);
+            m_Offset += OutSize;
+            return true;
+        }
+
+    private:
+        const std::vector<uint8>& m_Data;
+        uint32 m_Offset;
+    };
+
+    bool ReadFile(const char* Path, std::vector<uint8>& OutData)
+    {
+        FILE* File = fopen(Path, "rb");
+        if (!File)
+            return false;
+
+        fseek(File, 0, SEEK_END);
+        long Size = ftell(File);
+        fseek(File, 0, SEEK_SET);
+
+        OutData.resize(Size > 0 ? static_cast<size_t>(Size) : 0);
+        size_t Read = OutData.empty() ? 0 : fread(OutData.data(), 1, OutData.size(), File);
+        fclose(File);
+
+        return Read == OutData.size();
+    }
+
+    void PrintUsage()
+    {
+        printf("Usage: USSLogDecoder <Input.usslog> [-o Output.txt] [-sites]\n");
+    }
+}
+
+int main(int Argc, char** Argv)
+{
+    const char* InputPath = nullptr;
+    const char* OutputPath = nullptr;
+    bool bSiteSummary = false;
+
+    for (int i = 1; i < Argc; ++i)
+    {
+        if (strcmp(Argv[i], "-o") == 0 && i + 1 < Argc)
+            OutputPath = Argv[++i];
+        else if (strcmp(Argv[i], "-sites") == 0)
+            bSiteSummary = true;
+        else if (Argv[i][0] != '-' && !InputPath)
+            InputPath = Argv[i];
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    if (!InputPath)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    std::vector<uint8> Data;
+    if (!ReadFile(InputPath, Data))
+    {
+        fprintf(stderr, "Failed to read %s\n", InputPath);
+        return 1;
+    }
+
+    FByteReader Reader(Data);
+
+    char Magic[sizeof(LogFileMagic)];
+    uint32 Version = 0;
+    int64 TimeUs = 0;
+
+    if (!Reader.ReadBytes(Magic, sizeof(Magic)) || memcmp(Magic, LogFileMagic, sizeof(Magic)) != 0 ||
+        !Reader.Read(Version) || !Reader.Read(TimeUs))
+    {
+        fprintf(stderr, "%s is not a binary USS log\n", InputPath);
+        return 1;
+    }
+
+    // Version 1 payloads are version 2 with every integer 64 bits wide
+    if (Version == 0 || Version > LogFileVersion)
+    {
+        fprintf(stderr, "Unsupported log version %u (expected up to %u)\n", Version, LogFileVersion);
+        return 1;
+    }
+
+    FILE* Output = OutputPath ? fopen(OutputPath, "w") : stdout;
+    if (!Output)
+    {
+        fprintf(stderr, "Failed to open %s\n", OutputPath);
+        return 1;
+    }
+
+    std::unordered_map<uint32, FDecodedSite> Sites;
+    uint64 Lines = 0;
+    bool bTruncated = false;
+
+    char Message[Log::MaxMessageLength * 4];
+    char Line[sizeof(Message) + 64];
+
+    while (!Reader.AtEnd())
+    {
+        uint8 Tag = 0;
+        Reader.Read(Tag);
+
+        const ELogRecordType Type = static_cast<ELogRecordType>(Tag);
+        bool bOk = true;
+
+        if (Type == ELogRecordType::Site)
+        {
+            uint64 Id = 0, SourceLine = 0;
+            ELogLevel Level = ELogLevel::Info;
+            const uint8* Format; uint32 FormatSize;
+            const uint8* File; uint32 FileSize;
+
+            bOk = Reader.ReadVar(Id) && Reader.Read(Level) && Reader.ReadVar(SourceLine) &&
+                  Reader.ReadSpan(Format, FormatSize) && Reader.ReadSpan(File, FileSize);
+
+            if (bOk)
+            {
+                FDecodedSite& Site = Sites[static_cast<uint32>(Id)];
+                Site.Format.assign(reinterpret_cast<const char*>(Format), FormatSize);
+                Site.File.assign(reinterpret_cast<const char*>(File), FileSize);
+                Site.Line = static_cast<uint32>(SourceLine);
+                Site.Level = Level;
+            }
+        }
+        else if (Type == ELogRecordType::Call || Type == ELogRecordType::Text)
+        {
+            uint64 Id = 0, Delta = 0, ThreadId = 0;
+            ELogLevel Level = ELogLevel::Info;
+            const uint8* Payload; uint32 PayloadSize;
+            uint32 RecordStart = Reader.GetOffset();
+
+            if (Type == ELogRecordType::Call)
+                bOk = Reader.ReadVar(Id);
+            else
+                bOk = Reader.Read(Level);
+
+            bOk = bOk && Reader.ReadVar(Delta) && Reader.ReadVar(ThreadId) && Reader.ReadSpan(Payload, PayloadSize);
+
+            if (bOk)
+            {
+                TimeUs += ZigZagDecode(Delta);
+                uint32 MessageLength = 0;
+
+                if (Type == ELogRecordType::Call)
+                {
+                    auto It = Sites.find(static_cast<uint32>(Id));
+                    if (It == Sites.end())
+                    {
+                        MessageLength = snprintf(Message, sizeof(Message), "<unknown log site %llu>",
+                            static_cast<unsigned long long>(Id));
+                    }
+                    else
+                    {
+                        FDecodedSite& Site = It->second;
+                        Level = Site.Level;
+                        ++Site.Calls;
+                        Site.Bytes += Reader.GetOffset() - RecordStart + 1;
+
+                        MessageLength = RenderLogMessage(Site.Format.c_str(), Payload, PayloadSize,
+                            Message, sizeof(Message));
+                    }
+                }
+                else
+                {
+                    MessageLength = std::min<uint32>(PayloadSize, sizeof(Message) - 1);
+                    memcpy(Message, Payload, MessageLength);
+                }
+
+                if (!bSiteSummary)
+                {
+                    uint32 LineLength = FormatLogLine(Level, TimeUs, Message, MessageLength, Line, sizeof(Line));
+                    fwrite(Line, 1, LineLength, Output);
+                }
+
+                ++Lines;
+            }
+        }
+        else
+        {
+            bOk = false;
+        }
+
+        if (!bOk)
+        {
+            // Usually a log cut off by a crash - keep what decoded
+            bTruncated = true;
+            break;
+        }
+    }
+
+    if (bSiteSummary)
+    {
+        std::vector<const FDecodedSite*> Sorted;
+        for (const auto& Pair : Sites)
+            Sorted.push_back(&Pair.second);
+
+        std::sort(Sorted.begin(), Sorted.end(),
+            [](const FDecodedSite* A, const FDecodedSite* B) { return A->Calls > B->Calls; });
+
+        fprintf(Output, "%10s %10s  %-6s %s\n", "Calls", "Bytes", "Level", "Site");
+        for (const FDecodedSite* Site : Sorted)
+        {
+            fprintf(Output, "%10llu %10llu  %-6s %s:%u \"%s\"\n",
+                static_cast<unsigned long long>(Site->Calls),
+                static_cast<unsigned long long>(Site->Bytes),
+                Log::GetLevelName(Site->Level),
+                Site->File.c_str(), Site->Line, Site->Format.c_str());
+        }
+    }
+
+    if (OutputPath)
+        fclose(Output);
+
+    fprintf(stderr, "Decoded %llu records from %zu sites%s\n",
+        static_cast<unsigned long long>(Lines), Sites.size(),
+        bTruncated ? " (file truncated)" : "");
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,666 @@
+/**
+ * UniversalSlashingSimulator - Mock Engine Image Implementation
+ */
+
+#include "MockEngineImage.h"
+#include "../../Engine/CoreTypes/OffsetResolver.h"
+#include "../../Engine/Snapshot/ObjectSnapshot.h"
+#include <algorithm>
+#include <cstring>
+
+namespace USS
+{
+    FMockEngineImage::FMockEngineImage(const FVersionInfo& Version, int32 MaxObjects)
+        : FMockEngineImage(Version, MaxObjects, EEmpty::Tag)
+    {
+        // The metaclass is its own class, as in the engine
+        m_ClassClass = AddObject("Class", nullptr, nullptr, 0x100);
+        Write<void*>(m_ClassClass, m_Layout.Class, m_ClassClass);
+        m_Classes.emplace("Class", m_ClassClass);
+
+        void* ObjectClass = AddClass("Object");
+        void* FieldClass = AddClass("Field", ObjectClass);
+        void* StructClass = AddClass("Struct", FieldClass);
+        WriteStruct(m_ClassClass, StructClass, 0);
+        m_FunctionClass = AddClass("Function", StructClass);
+    }
+
+    FMockEngineImage::FMockEngineImage(const FVersionInfo& Version, const FObjectSnapshot& Snapshot)
+        : FMockEngineImage(Version, Snapshot.GetHeader().NumObjects + SnapshotSlack, EEmpty::Tag)
+    {
+        ReplaySnapshot(Snapshot);
+    }
+
+    FMockEngineImage::FMockEngineImage(const FVersionInfo& Version, int32 MaxObjects, EEmpty)
+        : m_Version(Version)
+        , m_Layout()
+        , m_PageCursor(nullptr)
+        , m_PageRemaining(0)
+        , m_NamePoolAddress(0)
+        , m_NamePool(nullptr)
+        , m_NameBlock(0)
+        , m_NameCursor(0)
+        , m_NameChunks(nullptr)
+        , m_NumNames(0)
+        , m_ObjectArrayAddress(0)
+        , m_ObjectArray(nullptr)
+        , m_MaxObjects(std::max(MaxObjects, 1))
+        , m_NumObjects(0)
+        , m_ClassClass(nullptr)
+        , m_FunctionClass(nullptr)
+    {
+        InitializeLayout();
+        InitializeNamePool();
+        InitializeObjectArray();
+
+        // "None" must be comparison index 0
+        AddName("None");
+    }
+
+    //=========================================================================
+    // Layout
+    //=========================================================================
+
+    void FMockEngineImage::InitializeLayout()
+    {
+        IOffsetResolver& Resolver = GetOffsetResolver();
+        const FOffsetTable& Table = Resolver.GetOffsets();
+
+        // Mirrors the iterators: resolver value if positive, else their default
+        auto IteratorOffset = [&Resolver](const char* Category, const char* Name, int32 Default)
+        {
+            int32 Value = Resolver.GetOffset(Category, Name);
+            return Value > 0 ? Value : Default;
+        };
+
+        m_Layout.Class = Table.UObject.Class;
+        m_Layout.Name = Table.UObject.Name;
+        m_Layout.Outer = Table.UObject.Outer;
+        m_Layout.ObjectFlags = Table.UObject.ObjectFlags;
+        m_Layout.InternalIndex = Table.UObject.InternalIndex;
+        m_Layout.FieldNext = Table.UField.Next;
+        m_Layout.TableSuperStruct = Table.UStruct.SuperStruct;
+        m_Layout.TableChildren = Table.UStruct.Children;
+        m_Layout.TableChildProperties = Table.UStruct.ChildProperties;
+        m_Layout.PropertiesSize = Table.UStruct.PropertiesSize;
+        m_Layout.FunctionFlags = Table.UFunction.FunctionFlags;
+        m_Layout.ParmsSize = Table.UFunction.ParmsSize;
+        m_Layout.NativeFunc = Table.UFunction.Func;
+        m_Layout.TableFFieldNext = Table.FField.Next;
+        m_Layout.TableFFieldName = Table.FField.NamePrivate;
+
+        m_Layout.SuperStruct = IteratorOffset("UStruct", "SuperStruct", 0x40);
+
+        if (m_Version.bUseFField)
+        {
+            m_Layout.ChildProperties = IteratorOffset("UStruct", "ChildProperties", 0x50);
+            m_Layout.FieldClass = IteratorOffset("FField", "ClassPrivate", 0x00);
+            m_Layout.FieldOwner = IteratorOffset("FField", "Owner", 0x08);
+            m_Layout.FFieldNext = IteratorOffset("FField", "Next", 0x20);
+            m_Layout.FFieldName = IteratorOffset("FField", "NamePrivate", 0x28);
+            m_Layout.FieldClassName = IteratorOffset("FFieldClass", "Name", 0x00);
+            m_Layout.ArrayDim = IteratorOffset("FProperty", "ArrayDim", 0x38);
+            m_Layout.ElementSize = IteratorOffset("FProperty", "ElementSize", 0x3C);
+            m_Layout.PropertyFlags = IteratorOffset("FProperty", "PropertyFlags", 0x40);
+            m_Layout.PropertyOffset = IteratorOffset("FProperty", "Offset_Internal", 0x4C);
+            m_Layout.BoolByteOffset = IteratorOffset("FProperty", "ByteOffset", 0x79);
+            m_Layout.BoolFieldMask = IteratorOffset("FProperty", "FieldMask", 0x7B);
+        }
+        else
+        {
+            m_Layout.PropertyLink = IteratorOffset("UStruct", "PropertyLink", 0x50);
+            m_Layout.PropertyNext = IteratorOffset("UField", "Next", 0x30);
+            m_Layout.ArrayDim = IteratorOffset("UProperty", "ArrayDim", 0x38);
+            m_Layout.ElementSize = IteratorOffset("UProperty", "ElementSize", 0x3C);
+            m_Layout.PropertyFlags = IteratorOffset("UProperty", "PropertyFlags", 0x40);
+            m_Layout.PropertyOffset = IteratorOffset("UProperty", "Offset_Internal", 0x4C);
+            m_Layout.BoolByteOffset = IteratorOffset("UProperty", "ByteOffset", 0x71);
+            m_Layout.BoolFieldMask = IteratorOffset("UProperty", "FieldMask", 0x73);
+        }
+    }
+
+    //=========================================================================
+    // Raw memory
+    //=========================================================================
+
+    void* FMockEngineImage::Allocate(size_t Size, size_t Alignment)
+    {
+        if (Size == 0)
+            Size = 1;
+
+        if (Size + Alignment > PageSize / 4)
+        {
+            // Own block; new[] is 16-aligned, over-allocate for anything more
+            m_Blocks.emplace_back(new uint8[Size + Alignment]());
+            uintptr Raw = reinterpret_cast<uintptr>(m_Blocks.back().get());
+            return reinterpret_cast<void*>((Raw + Alignment - 1) & ~(static_cast<uintptr>(Alignment) - 1));
+        }
+
+        uintptr Cursor = reinterpret_cast<uintptr>(m_PageCursor);
+        uintptr Aligned = (Cursor + Alignment - 1) & ~(static_cast<uintptr>(Alignment) - 1);
+
+        if (!m_PageCursor || Aligned + Size > Cursor + m_PageRemaining)
+        {
+            m_Blocks.emplace_back(new uint8[PageSize]());
+            m_PageCursor = m_Blocks.back().get();
+            m_PageRemaining = PageSize;
+
+            Cursor = reinterpret_cast<uintptr>(m_PageCursor);
+            Aligned = (Cursor + Alignment - 1) & ~(static_cast<uintptr>(Alignment) - 1);
+        }
+
+        const size_t Used = (Aligned - Cursor) + Size;
+        m_PageCursor += Used;
+        m_PageRemaining -= Used;
+
+        return reinterpret_cast<void*>(Aligned);
+    }
+
+    void* FMockEngineImage::WriteArray(void* Base, int32 Offset, int32 ElementSize, int32 Count)
+    {
+        void* Data = Count > 0 ? Allocate(static_cast<size_t>(ElementSize) * Count) : nullptr;
+
+        // TArray: Data, Num, Max
+        Write<void*>(Base, Offset + 0x00, Data);
+        Write<int32>(Base, Offset + 0x08, Count);
+        Write<int32>(Base, Offset + 0x0C, Count);
+
+        return Data;
+    }
+
+    //=========================================================================
+    // Names
+    //=========================================================================
+
+    void FMockEngineImage::InitializeNamePool()
+    {
+        if (m_Version.bUseFNamePool)
+        {
+            // Lock, CurrentBlock, CurrentByteCursor, then the block table
+            m_NamePool = static_cast<uint8*>(Allocate(0x10 + MaxNameBlocks * sizeof(uintptr)));
+            Write<void*>(m_NamePool, 0x10, Allocate(NameBlockSize, 2));
+            m_NamePoolAddress = reinterpret_cast<uintptr>(m_NamePool);
+        }
+        else
+        {
+            // GNames holds a pointer to the chunk table
+            void* Global = Allocate(sizeof(uintptr));
+            m_NameChunks = static_cast<uintptr*>(Allocate(128 * sizeof(uintptr)));
+            Write<void*>(Global, 0, m_NameChunks);
+            m_NamePoolAddress = reinterpret_cast<uintptr>(Global);
+        }
+    }
+
+    int32 FMockEngineImage::AddName(const std::string& Name)
+    {
+        auto It = m_NameIndices.find(Name);
+        if (It != m_NameIndices.end())
+            return It->second;
+
+        int32 Index = m_Version.bUseFNamePool ? AddPoolName(Name) : AddGNamesName(Name);
+        if (Index >= 0)
+            m_NameIndices.emplace(Name, Index);
+
+        return Index;
+    }
+
+    int32 FMockEngineImage::AddPoolName(const std::string& Name)
+    {
+        // Header (bIsWide:1, Len:15) then ANSI characters, two-byte aligned
+        const int32 Length = std::min(static_cast<int32>(Name.size()), 1023);
+        const int32 EntrySize = (2 + Length + 1) & ~1;
+
+        if (m_NameCursor + EntrySize > NameBlockSize)
+        {
+            if (m_NameBlock + 1 >= MaxNameBlocks)
+                return -1;
+
+            ++m_NameBlock;
+            m_NameCursor = 0;
+            Write<void*>(m_NamePool, 0x10 + m_NameBlock * static_cast<int32>(sizeof(uintptr)), Allocate(NameBlockSize, 2));
+        }
+
+        uint8* Block = nullptr;
+        memcpy(&Block, m_NamePool + 0x10 + m_NameBlock * sizeof(uintptr), sizeof(Block));
+
+        Write<uint16>(Block, m_NameCursor, static_cast<uint16>(Length << 1));
+        memcpy(Block + m_NameCursor + 2, Name.data(), Length);
+
+        const int32 Index = (m_NameBlock << 16) | (m_NameCursor / 2);
+        m_NameCursor += EntrySize;
+
+        Write<uint32>(m_NamePool, 0x08, static_cast<uint32>(m_NameBlock));
+        Write<uint32>(m_NamePool, 0x0C, static_cast<uint32>(m_NameCursor));
+
+        ++m_NumNames;
+        return Index;
+    }
+
+    int32 FMockEngineImage::AddGNamesName(const std::string& Name)
+    {
+        const int32 Index = m_NumNames;
+        const int32 Chunk = Index / NamesPerChunk;
+
+        if (Chunk >= 128)
+            return -1;
+
+        if (m_NameChunks[Chunk] == 0)
+            m_NameChunks[Chunk] = reinterpret_cast<uintptr>(Allocate(NamesPerChunk * sizeof(uintptr)));
+
+        // FNameEntry: Index (low bit = wide), pad, HashNext, then the name
+        const size_t Length = std::min<size_t>(Name.size(), 1023);
+        uint8* Entry = static_cast<uint8*>(Allocate(0x10 + Length + 1));
+        Write<int32>(Entry, 0x00, Index << 1);
+        memcpy(Entry + 0x10, Name.data(), Length);
+
+        Write<void*>(reinterpret_cast<void*>(m_NameChunks[Chunk]), (Index % NamesPerChunk) * static_cast<int32>(sizeof(uintptr)), Entry);
+
+        ++m_NumNames;
+        return Index;
+    }
+
+    void FMockEngineImage::WriteName(void* Base, int32 Offset, const char* Name)
+    {
+        // FName: ComparisonIndex, Number
+        Write<int32>(Base, Offset + 0, AddName(Name ? Name : "None"));
+        Write<int32>(Base, Offset + 4, 0);
+    }
+
+    //=========================================================================
+    // Objects
+    //=========================================================================
+
+    void FMockEngineImage::InitializeObjectArray()
+    {
+        // FUObjectArray header; the TUObjectArray readers want starts at 0x10
+        m_ObjectArray = static_cast<uint8*>(Allocate(0x40));
+        m_ObjectArrayAddress = reinterpret_cast<uintptr>(m_ObjectArray);
+
+        if (m_Version.bUseChunkedObjects)
+        {
+            const int32 MaxChunks = (m_MaxObjects + ObjectsPerChunk - 1) / ObjectsPerChunk;
+
+            Write<void*>(m_ObjectArray, 0x10, Allocate(MaxChunks * sizeof(uintptr)));
+            Write<int32>(m_ObjectArray, 0x20, m_MaxObjects);
+            Write<int32>(m_ObjectArray, 0x24, 0);
+            Write<int32>(m_ObjectArray, 0x28, MaxChunks);
+            Write<int32>(m_ObjectArray, 0x2C, 0);
+        }
+        else
+        {
+            Write<void*>(m_ObjectArray, 0x10, Allocate(static_cast<size_t>(m_MaxObjects) * ObjectItemSize));
+            Write<int32>(m_ObjectArray, 0x18, m_MaxObjects);
+            Write<int32>(m_ObjectArray, 0x1C, 0);
+        }
+    }
+
+    uint8* FMockEngineImage::GetItem(int32 Index)
+    {
+        if (m_Version.bUseChunkedObjects)
+        {
+            uint8* Chunks = nullptr;
+            memcpy(&Chunks, m_ObjectArray + 0x10, sizeof(Chunks));
+
+            const int32 Chunk = Index / ObjectsPerChunk;
+            uint8* ChunkData = nullptr;
+            memcpy(&ChunkData, Chunks + Chunk * sizeof(uintptr), sizeof(ChunkData));
+
+            if (!ChunkData)
+            {
+                ChunkData = static_cast<uint8*>(Allocate(static_cast<size_t>(ObjectsPerChunk) * ObjectItemSize));
+                Write<void*>(Chunks, Chunk * static_cast<int32>(sizeof(uintptr)), ChunkData);
+                Write<int32>(m_ObjectArray, 0x2C, Chunk + 1);
+            }
+
+            return ChunkData + (Index % ObjectsPerChunk) * ObjectItemSize;
+        }
+
+        uint8* Items = nullptr;
+        memcpy(&Items, m_ObjectArray + 0x10, sizeof(Items));
+        return Items + Index * ObjectItemSize;
+    }
+
+    void FMockEngineImage::RegisterObject(void* Object, int32 Flags, int32 SerialNumber)
+    {
+        if (m_NumObjects >= m_MaxObjects)
+            return;
+
+        const int32 Index = m_NumObjects++;
+        uint8* Item = GetItem(Index);
+
+        Write<int32>(m_ObjectArray, m_Version.bUseChunkedObjects ? 0x24 : 0x1C, m_NumObjects);
+
+        // FUObjectItem: Object, Flags, ClusterIndex, SerialNumber
+        Write<void*>(Item, 0x00, Object);
+        Write<int32>(Item, 0x08, Flags);
+        Write<int32>(Item, 0x10, SerialNumber);
+
+        // Free slots stay null
+        if (Object)
+            Write<int32>(Object, m_Layout.InternalIndex, Index);
+    }
+
+    void* FMockEngineImage::AddObject(const char* Name, void* Class, void* Outer, int32 Size)
+    {
+        void* Object = Allocate(std::max(Size, 0x80));
+
+        Write<void*>(Object, m_Layout.Class, Class);
+        WriteName(Object, m_Layout.Name, Name);
+        Write<void*>(Object, m_Layout.Outer, Outer);
+
+        RegisterObject(Object);
+        return Object;
+    }
+
+    void FMockEngineImage::FreeObject(void* Object)
+    {
+        int32 Index = -1;
+        memcpy(&Index, static_cast<uint8*>(Object) + m_Layout.InternalIndex, sizeof(Index));
+        if (Index < 0 || Index >= m_NumObjects)
+            return;
+
+        // GC nulls the slot and clears the item; the memory is left as is
+        memset(GetItem(Index), 0, ObjectItemSize);
+    }
+
+    void* FMockEngineImage::ReuseObject(void* Freed, const char* Name, void* Class, void* Outer)
+    {
+        int32 Index = -1;
+        memcpy(&Index, static_cast<uint8*>(Freed) + m_Layout.InternalIndex, sizeof(Index));
+        if (Index < 0 || Index >= m_NumObjects)
+            return nullptr;
+
+        Write<void*>(Freed, m_Layout.Class, Class);
+        WriteName(Freed, m_Layout.Name, Name);
+        Write<void*>(Freed, m_Layout.Outer, Outer);
+
+        // Same slot, no serial until something takes a weak pointer
+        uint8* Item = GetItem(Index);
+        memset(Item, 0, ObjectItemSize);
+        Write<void*>(Item, 0x00, Freed);
+
+        return Freed;
+    }
+
+    void* FMockEngineImage::AddClass(const char* Name, void* SuperClass, int32 PropertiesSize)
+    {
+        void* Class = AddObject(Name, m_ClassClass, nullptr, 0x100);
+        WriteStruct(Class, SuperClass, PropertiesSize);
+
+        if (Name)
+            m_Classes[Name] = Class;
+
+        return Class;
+    }
+
+    void FMockEngineImage::WriteStruct(void* Struct, void* SuperStruct, int32 PropertiesSize)
+    {
+        // Table first so the iterators' offsets win where they overlap;
+        // table entries the resolver hasn't filled in are 0 and skipped
+        if (m_Layout.PropertiesSize > 0)
+            Write<int32>(Struct, m_Layout.PropertiesSize, PropertiesSize);
+        if (m_Layout.TableSuperStruct > 0)
+            Write<void*>(Struct, m_Layout.TableSuperStruct, SuperStruct);
+        Write<void*>(Struct, m_Layout.SuperStruct, SuperStruct);
+    }
+
+    void* FMockEngineImage::AddFunction(void* Class, const char* Name, uint32 FunctionFlags,
+        uint16 ParmsSize, void* Func)
+    {
+        void* Function = AddObject(Name, m_FunctionClass, Class, 0x100);
+
+        // Unresolved offsets are 0 - leave the header alone
+        if (m_Layout.FunctionFlags > 0)
+            Write<uint32>(Function, m_Layout.FunctionFlags, FunctionFlags);
+        if (m_Layout.ParmsSize > 0)
+            Write<uint16>(Function, m_Layout.ParmsSize, ParmsSize);
+        if (m_Layout.NativeFunc > 0)
+            Write<void*>(Function, m_Layout.NativeFunc, Func);
+
+        // Functions sit on the owner's Children list, newest first
+        if (Class && m_Layout.TableChildren > 0 && m_Layout.FieldNext > 0)
+        {
+            void* Head = nullptr;
+            memcpy(&Head, static_cast<uint8*>(Class) + m_Layout.TableChildren, sizeof(Head));
+            Write<void*>(Function, m_Layout.FieldNext, Head);
+            Write<void*>(Class, m_Layout.TableChildren, Function);
+        }
+
+        return Function;
+    }
+
+    void* FMockEngineImage::FindClass(const char* Name) const
+    {
+        auto It = Name ? m_Classes.find(Name) : m_Classes.end();
+        return It != m_Classes.end() ? It->second : nullptr;
+    }
+
+    void* FMockEngineImage::GetPropertyClass(const char* Name)
+    {
+        auto It = m_PropertyClasses.find(Name);
+        if (It != m_PropertyClasses.end())
+            return It->second;
+
+        void* PropertyClass = nullptr;
+
+        if (m_Version.bUseFField)
+        {
+            // FFieldClass - not a UObject, just a name the iterator reads
+            PropertyClass = Allocate(0x40);
+            WriteName(PropertyClass, m_Layout.FieldClassName, Name);
+        }
+        else
+        {
+            // A replayed snapshot already has the engine's property classes
+            PropertyClass = FindClass(Name);
+            if (!PropertyClass)
+                PropertyClass = AddClass(Name);
+        }
+
+        m_PropertyClasses.emplace(Name, PropertyClass);
+        return PropertyClass;
+    }
+
+    void* FMockEngineImage::AddProperty(void* Struct, const char* Name, const char* PropertyClass,
+        int32 Offset, int32 ElementSize, int32 ArrayDim, uint64 PropertyFlags)
+    {
+        if (!Struct || !PropertyClass)
+            return nullptr;
+
+        void* Class = GetPropertyClass(PropertyClass);
+        void* Property = nullptr;
+
+        if (m_Version.bUseFField)
+        {
+            // FField/FProperty, outside GObjects
+            Property = Allocate(0x80);
+
+            if (m_Layout.TableFFieldName > 0)
+                WriteName(Property, m_Layout.TableFFieldName, Name);
+
+            Write<void*>(Property, m_Layout.FieldClass, Class);
+            Write<void*>(Property, m_Layout.FieldOwner, Struct);
+            WriteName(Property, m_Layout.FFieldName, Name);
+        }
+        else
+        {
+            // UProperty is a UObject owned by the struct
+            Property = AddObject(Name, Class, Struct);
+        }
+
+        LinkProperty(Struct, Property, Offset, ElementSize, ArrayDim, PropertyFlags);
+
+        if (strcmp(PropertyClass, "BoolProperty") == 0)
+            Write<uint8>(Property, m_Layout.BoolFieldMask, 0xFF);
+
+        return Property;
+    }
+
+    void* FMockEngineImage::AddBoolProperty(void* Struct, const char* Name, int32 Offset, uint8 ByteOffset, uint8 FieldMask)
+    {
+        void* Property = AddProperty(Struct, Name, "BoolProperty", Offset, 1);
+        if (Property)
+        {
+            Write<uint8>(Property, m_Layout.BoolByteOffset, ByteOffset);
+            Write<uint8>(Property, m_Layout.BoolFieldMask, FieldMask);
+        }
+        return Property;
+    }
+
+    void FMockEngineImage::LinkProperty(void* Struct, void* Property,
+        int32 Offset, int32 ElementSize, int32 ArrayDim, uint64 PropertyFlags)
+    {
+        const int32 ChainHead = m_Version.bUseFField ? m_Layout.ChildProperties : m_Layout.PropertyLink;
+        const int32 ChainNext = m_Version.bUseFField ? m_Layout.FFieldNext : m_Layout.PropertyNext;
+
+        Write<int32>(Property, m_Layout.ArrayDim, ArrayDim);
+        Write<int32>(Property, m_Layout.ElementSize, ElementSize);
+        Write<uint64>(Property, m_Layout.PropertyFlags, PropertyFlags);
+        Write<int32>(Property, m_Layout.PropertyOffset, Offset);
+
+        // Properties link in declaration order
+        auto It = m_LastProperty.find(Struct);
+        if (It == m_LastProperty.end())
+        {
+            Write<void*>(Struct, ChainHead, Property);
+
+            if (m_Version.bUseFField && m_Layout.TableChildProperties > 0 && m_Layout.TableChildProperties != ChainHead)
+                Write<void*>(Struct, m_Layout.TableChildProperties, Property);
+
+            m_LastProperty.emplace(Struct, Property);
+        }
+        else
+        {
+            Write<void*>(It->second, ChainNext, Property);
+
+            if (m_Version.bUseFField && m_Layout.TableFFieldNext > 0 && m_Layout.TableFFieldNext != ChainNext)
+                Write<void*>(It->second, m_Layout.TableFFieldNext, Property);
+
+            It->second = Property;
+        }
+    }
+
+    //=========================================================================
+    // Snapshots
+    //=========================================================================
+
+    void FMockEngineImage::ReplaySnapshot(const FObjectSnapshot& Snapshot)
+    {
+        const FObjectSnapshotHeader& Header = Snapshot.GetHeader();
+        std::vector<void*> Objects(Header.NumObjects, nullptr);
+
+        // Every slot first, at its original index, so references can point
+        // forward; free slots stay free
+        for (int32 i = 0; i < Header.NumObjects; ++i)
+        {
+            const FSnapshotObject& Record = Snapshot.GetObjectRecord(i);
+
+            if (Record.Address == 0)
+            {
+                RegisterObject(nullptr, 0, 0);
+                continue;
+            }
+
+            void* Object = Allocate(Record.Struct >= 0 ? 0x100 : 0x80);
+
+            Write<int32>(Object, m_Layout.Name + 0, AddName(Snapshot.GetObjectName(i)));
+            Write<int32>(Object, m_Layout.Name + 4, Record.NameNumber);
+            if (m_Layout.ObjectFlags > 0)
+                Write<int32>(Object, m_Layout.ObjectFlags, Record.ObjectFlags);
+
+            RegisterObject(Object, Record.InternalFlags, Record.SerialNumber);
+            Objects[i] = Object;
+        }
+
+        auto Resolve = [&Objects](int32 Index) -> void*
+        {
+            return Index >= 0 ? Objects[Index] : nullptr;
+        };
+
+        for (int32 i = 0; i < Header.NumObjects; ++i)
+        {
+            const FSnapshotObject& Record = Snapshot.GetObjectRecord(i);
+            if (!Objects[i])
+                continue;
+
+            Write<void*>(Objects[i], m_Layout.Class, Resolve(Record.Class));
+            Write<void*>(Objects[i], m_Layout.Outer, Resolve(Record.Outer));
+
+            if (Record.Class == i && strcmp(Snapshot.GetObjectName(i), "Class") == 0)
+                m_ClassClass = Objects[i];
+        }
+
+        // Classes by name, for FindClass and the property classes
+        for (int32 i = 0; i < Header.NumObjects && m_ClassClass; ++i)
+        {
+            if (Objects[i] && Resolve(Snapshot.GetObjectRecord(i).Class) == m_ClassClass)
+                m_Classes.emplace(Snapshot.GetObjectName(i), Objects[i]);
+        }
+
+        m_FunctionClass = FindClass("Function");
+
+        for (int32 i = 0; i < Header.NumStructs; ++i)
+        {
+            const FSnapshotStruct& Record = Snapshot.GetStructRecord(i);
+            void* Struct = Objects[Record.Object];
+            if (!Struct)
+                continue;
+
+            WriteStruct(Struct, Resolve(Record.Super), Record.PropertiesSize);
+
+            for (int32 p = 0; p < Record.NumProperties; ++p)
+            {
+                const FSnapshotProperty& Property = Snapshot.GetPropertyRecord(Record.FirstProperty + p);
+
+                // UProperty objects were replayed with the rest of GObjects
+                void* Existing = m_Version.bUseFField ? nullptr : Resolve(Property.Object);
+
+                if (Existing)
+                {
+                    LinkProperty(Struct, Existing, Property.Offset, Property.ElementSize,
+                        Property.ArrayDim, Property.PropertyFlags);
+                }
+                else
+                {
+                    AddProperty(Struct, Snapshot.GetString(Property.Name), Snapshot.GetString(Property.ClassName),
+                        Property.Offset, Property.ElementSize, Property.ArrayDim, Property.PropertyFlags);
+                }
+            }
+        }
+    }
+
+    //=========================================================================
+    // Readers
+    //=========================================================================
+
+    std::unique_ptr<IObjectArray> FMockEngineImage::CreateObjectArray() const
+    {
+        std::unique_ptr<IObjectArray> Array;
+
+        if (m_Version.bUseChunkedObjects)
+            Array = std::make_unique<FChunkedObjectArray>();
+        else
+            Array = std::make_unique<FFixedObjectArray>();
+
+        if (Array->Initialize(m_ObjectArrayAddress) != EResult::Success)
+            return nullptr;
+
+        return Array;
+    }
+
+    std::unique_ptr<INamePool> FMockEngineImage::CreateNamePool() const
+    {
+        std::unique_ptr<INamePool> Pool;
+
+        if (m_Version.bUseFNamePool)
+            Pool = std::make_unique<FNamePoolImpl>();
+        else
+            Pool = std::make_unique<FGNamesArray>();
+
+        if (Pool->Initialize(m_NamePoolAddress) != EResult::Success)
+            return nullptr;
+
+        return Pool;
+    }
+
+}
\ No newline at end of file
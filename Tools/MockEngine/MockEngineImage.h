@@ -0,0 +1,259 @@
+/**
+ * UniversalSlashingSimulator - Mock Engine Image
+ *
+ * Builds engine globals in process memory with the byte layout the real
+ * readers expect, so FNamePoolImpl/FGNamesArray, the object arrays, both
+ * property iterators and the fast array serializers run unmodified on
+ * top of it. The version decides the layout:
+ * - bUseFNamePool:      FNamePool blocks, else a GNames chunk table
+ * - bUseChunkedObjects: chunked GObjects, else a fixed item array
+ * - bUseFField:         FField/FProperty chains, else UProperty objects
+ *
+ * Field offsets are read from the offset resolver when the image is
+ * built, the same way the readers get them, so resolve offsets (or
+ * don't) before constructing an image and leave them alone afterwards.
+ * Where the offset table used by UObjectWrapper and the iterators'
+ * offsets disagree, both are written and the iterators win on overlap.
+ *
+ * An image can also replay an FObjectSnapshot taken in a live game, with
+ * every object at its original GObjects index.
+ *
+ * Memory is never moved or freed while the image lives.
+ */
+
+#pragma once
+
+#include "../../Core/Common.h"
+#include "../../Core/Versioning/VersionInfo.h"
+#include "../../Engine/CoreTypes/ObjectArray.h"
+#include "../../Engine/CoreTypes/NamePool.h"
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace USS
+{
+    class FObjectSnapshot;
+
+    class FMockEngineImage
+    {
+    public:
+        /**
+         * @param Version - Layout to build, e.g. from FVersionResolver::LookupCL
+         * @param MaxObjects - GObjects capacity
+         */
+        explicit FMockEngineImage(const FVersionInfo& Version, int32 MaxObjects = 0x20000);
+
+        /**
+         * Rebuild Snapshot's objects, names, flags and struct layouts.
+         * Objects added afterwards go behind them.
+         * @param Version - Layout to build, normally the snapshot's CL
+         */
+        FMockEngineImage(const FVersionInfo& Version, const FObjectSnapshot& Snapshot);
+
+        USS_NON_COPYABLE(FMockEngineImage)
+        USS_NON_MOVABLE(FMockEngineImage)
+
+        const FVersionInfo& GetVersion() const { return m_Version; }
+
+        //=====================================================================
+        // Names
+        //=====================================================================
+
+        // Comparison index for Name, adding it on first use ("None" is 0)
+        int32 AddName(const std::string& Name);
+
+        // Address to pass to INamePool::Initialize
+        uintptr GetNamePoolAddress() const { return m_NamePoolAddress; }
+
+        //=====================================================================
+        // Objects
+        //=====================================================================
+
+        // UObject header plus Size bytes in total, registered in GObjects
+        void* AddObject(const char* Name, void* Class, void* Outer = nullptr, int32 Size = 0x80);
+
+        // Clear Object's GObjects slot, as GC does; its memory stays mapped
+        void FreeObject(void* Object);
+
+        /**
+         * New object in a freed object's slot and memory, the way the
+         * engine's LIFO allocators hand both back out to the next spawn
+         */
+        void* ReuseObject(void* Freed, const char* Name, void* Class, void* Outer = nullptr);
+
+        // UClass whose class is "Class"
+        void* AddClass(const char* Name, void* SuperClass = nullptr, int32 PropertiesSize = 0);
+
+        /**
+         * UFunction owned by Class; add parameters with AddProperty
+         * @param Func - Native exec thunk, stored in UFunction::Func
+         */
+        void* AddFunction(void* Class, const char* Name, uint32 FunctionFlags = 0,
+            uint16 ParmsSize = 0, void* Func = nullptr);
+
+        /**
+         * Append a property to Struct's property chain - a UProperty object
+         * or an FProperty field depending on the version
+         * @param PropertyClass - e.g. "IntProperty", "ObjectProperty"
+         */
+        void* AddProperty(void* Struct, const char* Name, const char* PropertyClass,
+            int32 Offset, int32 ElementSize, int32 ArrayDim = 1, uint64 PropertyFlags = 0);
+
+        /**
+         * Append a bitfield bool - the bit FieldMask of the byte at
+         * Offset + ByteOffset. AddProperty writes a native bool (mask 0xFF)
+         */
+        void* AddBoolProperty(void* Struct, const char* Name, int32 Offset, uint8 ByteOffset, uint8 FieldMask);
+
+        void* FindClass(const char* Name) const;
+
+        int32 GetNumObjects() const { return m_NumObjects; }
+
+        // Address to pass to IObjectArray::Initialize
+        uintptr GetObjectArrayAddress() const { return m_ObjectArrayAddress; }
+
+        //=====================================================================
+        // Raw memory
+        //=====================================================================
+
+        // Zeroed, never moves
+        void* Allocate(size_t Size, size_t Alignment = 16);
+
+        /**
+         * Write a TArray header at Base + Offset with room for Count elements
+         * @return The element storage (zeroed)
+         */
+        void* WriteArray(void* Base, int32 Offset, int32 ElementSize, int32 Count);
+
+        template<typename T>
+        static void Write(void* Base, int32 Offset, const T& Value)
+        {
+            memcpy(static_cast<uint8*>(Base) + Offset, &Value, sizeof(T));
+        }
+
+        //=====================================================================
+        // Readers
+        //=====================================================================
+
+        // The implementations the version selects, initialized on this image
+        std::unique_ptr<IObjectArray> CreateObjectArray() const;
+        std::unique_ptr<INamePool> CreateNamePool() const;
+
+    private:
+        enum class EEmpty { Tag };
+
+        // Name pool and object array holding only "None"
+        FMockEngineImage(const FVersionInfo& Version, int32 MaxObjects, EEmpty);
+
+        // Offsets the readers use, captured once at construction
+        struct FLayout
+        {
+            // UObjectWrapper (FOffsetTable)
+            int32 Class;
+            int32 Name;
+            int32 Outer;
+            int32 ObjectFlags;
+            int32 InternalIndex;
+            int32 FieldNext;
+            int32 TableSuperStruct;
+            int32 TableChildren;
+            int32 TableChildProperties;
+            int32 PropertiesSize;
+            int32 FunctionFlags;
+            int32 ParmsSize;
+            int32 NativeFunc;
+            int32 TableFFieldNext;
+            int32 TableFFieldName;
+
+            // Property iterators
+            int32 SuperStruct;
+            int32 PropertyLink;
+            int32 ChildProperties;
+            int32 PropertyNext;
+            int32 FieldClass;
+            int32 FieldOwner;
+            int32 FFieldNext;
+            int32 FFieldName;
+            int32 FieldClassName;
+            int32 ArrayDim;
+            int32 ElementSize;
+            int32 PropertyFlags;
+            int32 PropertyOffset;
+            int32 BoolByteOffset;
+            int32 BoolFieldMask;
+        };
+
+        void InitializeLayout();
+        void InitializeNamePool();
+        void InitializeObjectArray();
+
+        int32 AddPoolName(const std::string& Name);
+        int32 AddGNamesName(const std::string& Name);
+
+        // FUObjectItem for a GObjects index, allocating its chunk if needed
+        uint8* GetItem(int32 Index);
+
+        void RegisterObject(void* Object, int32 Flags = 0, int32 SerialNumber = 0);
+        void WriteName(void* Base, int32 Offset, const char* Name);
+        void WriteStruct(void* Struct, void* SuperStruct, int32 PropertiesSize);
+
+        // Property fields, then append Property to Struct's chain
+        void LinkProperty(void* Struct, void* Property,
+            int32 Offset, int32 ElementSize, int32 ArrayDim, uint64 PropertyFlags);
+
+        void ReplaySnapshot(const FObjectSnapshot& Snapshot);
+
+        void* GetPropertyClass(const char* Name);
+
+        // Large blocks get their own allocation, the rest share pages
+        static constexpr size_t PageSize = 0x10000;
+
+        // FNamePool: 8192 blocks of 64K two-byte slots
+        static constexpr int32 NameBlockSize = 0x20000;
+        static constexpr int32 MaxNameBlocks = 8192;
+
+        // GNames: 128 chunks of 16K entries
+        static constexpr int32 NamesPerChunk = 0x4000;
+
+        // Object capacity beyond a replayed snapshot, for property classes
+        // and whatever the caller adds
+        static constexpr int32 SnapshotSlack = 0x1000;
+
+        // FUObjectItem stride and chunk size
+        static constexpr int32 ObjectItemSize = 0x18;
+        static constexpr int32 ObjectsPerChunk = 64 * 1024;
+
+        FVersionInfo m_Version;
+        FLayout m_Layout;
+
+        std::vector<std::unique_ptr<uint8[]>> m_Blocks;
+        uint8* m_PageCursor;
+        size_t m_PageRemaining;
+
+        // Names
+        std::unordered_map<std::string, int32> m_NameIndices;
+        uintptr m_NamePoolAddress;
+        uint8* m_NamePool;
+        int32 m_NameBlock;
+        int32 m_NameCursor;
+        uintptr* m_NameChunks;
+        int32 m_NumNames;
+
+        // Objects
+        uintptr m_ObjectArrayAddress;
+        uint8* m_ObjectArray;
+        int32 m_MaxObjects;
+        int32 m_NumObjects;
+
+        void* m_ClassClass;
+        void* m_FunctionClass;
+        std::unordered_map<std::string, void*> m_Classes;
+        std::unordered_map<std::string, void*> m_PropertyClasses;
+
+        // Last property in each struct's chain, for appending
+        std::unordered_map<void*, void*> m_LastProperty;
+    };
+
+}
\ No newline at end of file
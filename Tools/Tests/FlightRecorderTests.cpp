@@ -0,0 +1,82 @@
+/**
+ * UniversalSlashingSimulator - Flight Recorder Tests
+ *
+ * The dump FCrashHandler writes, produced here without a crash.
+ */
+
+#include "TestHarness.h"
+#include "../../Core/Diagnostics/FlightRecorder.h"
+#include "../../Core/Logging/Log.h"
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+using namespace USS;
+
+namespace
+{
+    // Stand-ins - only their addresses are recorded
+    uint64 Object;
+    uint64 Function;
+    uint64 UnnamedFunction;
+
+    const char* const TagNames[] = { "None", "Tick" };
+
+    std::string ReadText(const std::string& Path)
+    {
+        std::string Text;
+        FILE* File = fopen(Path.c_str(), "rb");
+        if (!File)
+            return Text;
+
+        char Buffer[4096];
+        size_t Read;
+        while ((Read = fread(Buffer, 1, sizeof(Buffer), File)) > 0)
+            Text.append(Buffer, Read);
+
+        fclose(File);
+        return Text;
+    }
+}
+
+USS_TEST(FlightRecorder_WritesLogAndEventSections)
+{
+    const std::string Path = (std::filesystem::temp_directory_path() / "USSTests_Flight.txt").string();
+
+    USS_CHECK(Log::Initialize(false) == EResult::Success);
+    Log::Write(ELogLevel::Info, "flight marker %d", 42);
+
+    const uint64 EventsBefore = FFlightRecorder::GetEventCount();
+
+    FFlightRecorder::SetTagNames(TagNames, 2);
+    FFlightRecorder::NoteFunctionName(&Function, "ReceiveTick");
+    FFlightRecorder::RecordEvent(&Object, &Function, 1);
+    FFlightRecorder::RecordEvent(&Object, &UnnamedFunction, 7);
+
+    USS_CHECK(FFlightRecorder::GetEventCount() == EventsBefore + 2);
+    USS_CHECK(FFlightRecorder::WriteToFile(Path.c_str()) == EResult::Success);
+    USS_CHECK(FFlightRecorder::WriteToFile(nullptr) == EResult::InvalidParameter);
+
+    Log::Shutdown();
+    FFlightRecorder::SetTagNames(nullptr, 0);
+
+    const std::string Text = ReadText(Path);
+    std::remove(Path.c_str());
+
+    const size_t LogSection = Text.find("==== Recent log records ====");
+    const size_t EventSection = Text.find("==== Recent ProcessEvent calls");
+
+    USS_CHECK(LogSection != std::string::npos);
+    USS_CHECK(EventSection != std::string::npos);
+    USS_CHECK(LogSection < EventSection);
+
+    // The log record sits in the log section, still in the ring
+    const size_t Marker = Text.find("[INFO] flight marker 42");
+    USS_CHECK(Marker != std::string::npos && Marker > LogSection && Marker < EventSection);
+
+    // Named with its tag; an unknown tag and function fall back to - and ?
+    const size_t Named = Text.find("Tick                  ReceiveTick (");
+    const size_t Unnamed = Text.find("-                     ? (");
+    USS_CHECK(Named != std::string::npos && Named > EventSection);
+    USS_CHECK(Unnamed != std::string::npos && Unnamed > Named);
+}
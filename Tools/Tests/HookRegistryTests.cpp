@@ -0,0 +1,133 @@
+/**
+ * UniversalSlashingSimulator - Hook Registry Tests
+ *
+ * The batched install the DLL does at startup, over FFakeHookBackend,
+ * with failures injected per target.
+ */
+
+#include "TestHarness.h"
+#include "../HeadlessSim/FakeHookBackend.h"
+#include <cstdio>
+
+using namespace USS;
+
+namespace
+{
+    constexpr int32 NumHooks = 8;
+
+    /**
+     * Registry with NumHooks fake detours registered, not yet installed
+     */
+    struct FHookFixture
+    {
+        uint8 Code[NumHooks][16] = {};      // Stand-in targets, never executed
+        void* Originals[NumHooks] = {};
+        FFakeHookBackend Backend;
+        FHookRegistry Registry;
+
+        FHookFixture()
+            : Registry(Backend)
+        {
+            USS_CHECK(Registry.Initialize() == EResult::Success);
+
+            for (int32 i = 0; i < NumHooks; ++i)
+                USS_CHECK(Registry.RegisterRaw(Name(i), Code[i], Code[i] + 8, &Originals[i]) == EResult::Success);
+        }
+
+        static const char* Name(int32 Index)
+        {
+            static char Names[NumHooks][16];
+            snprintf(Names[Index], sizeof(Names[Index]), "FakeHook%d", Index);
+            return Names[Index];
+        }
+
+        bool IsEnabled(int32 Index) const { return Backend.IsEnabled(const_cast<uint8*>(Code[Index])); }
+        EHookState GetState(int32 Index) const { return Registry.GetState(Name(Index)); }
+    };
+}
+
+USS_TEST(HookRegistry_InstallsAllInOneBatch)
+{
+    FHookFixture Fixture;
+
+    USS_CHECK(Fixture.Registry.InstallPending() == EResult::Success);
+
+    for (int32 i = 0; i < NumHooks; ++i)
+    {
+        USS_CHECK(Fixture.GetState(i) == EHookState::Enabled);
+        USS_CHECK(Fixture.IsEnabled(i));
+        USS_CHECK(Fixture.Originals[i] == Fixture.Code[i]);
+    }
+
+    // One queued pass, one thread freeze
+    USS_CHECK(Fixture.Registry.GetBatchCount() == 1);
+    USS_CHECK(Fixture.Backend.GetFreezeCount() == 1);
+}
+
+USS_TEST(HookRegistry_EnableFailureFallsBackPerHook)
+{
+    FHookFixture Fixture;
+    Fixture.Backend.FailEnable(Fixture.Code[3]);
+
+    USS_CHECK(Fixture.Registry.InstallPending() == EResult::HookFailed);
+
+    // The failing hook doesn't take the rest of the batch down
+    for (int32 i = 0; i < NumHooks; ++i)
+    {
+        USS_CHECK(Fixture.GetState(i) == (i == 3 ? EHookState::EnableFailed : EHookState::Enabled));
+        USS_CHECK(Fixture.IsEnabled(i) == (i != 3));
+    }
+
+    USS_CHECK(Fixture.Registry.GetCount(EHookState::Enabled) == NumHooks - 1);
+    USS_CHECK(Fixture.Registry.GetBatchCount() == 1);
+
+    // The batch freeze plus at least the failing hook's own retry
+    USS_CHECK(Fixture.Backend.GetFreezeCount() >= 2);
+}
+
+USS_TEST(HookRegistry_CreateFailureSkipsHook)
+{
+    FHookFixture Fixture;
+    Fixture.Backend.FailCreate(Fixture.Code[5]);
+
+    USS_CHECK(Fixture.Registry.InstallPending() == EResult::HookFailed);
+
+    for (int32 i = 0; i < NumHooks; ++i)
+    {
+        USS_CHECK(Fixture.GetState(i) == (i == 5 ? EHookState::CreateFailed : EHookState::Enabled));
+        USS_CHECK(Fixture.IsEnabled(i) == (i != 5));
+    }
+
+    // Never created: no trampoline, and the batch still went through in one pass
+    USS_CHECK(Fixture.Originals[5] == nullptr);
+    USS_CHECK(Fixture.Registry.GetBatchCount() == 1);
+    USS_CHECK(Fixture.Backend.GetFreezeCount() == 1);
+}
+
+USS_TEST(HookRegistry_DisableAllAndShutdownTouchOnlyCreatedHooks)
+{
+    FHookFixture Fixture;
+    Fixture.Backend.FailCreate(Fixture.Code[1]);
+    Fixture.Backend.FailEnable(Fixture.Code[2]);
+
+    USS_CHECK(Fixture.Registry.InstallPending() == EResult::HookFailed);
+    USS_CHECK(Fixture.Registry.DisableAll() == EResult::Success);
+
+    for (int32 i = 0; i < NumHooks; ++i)
+    {
+        const EHookState Expected = (i == 1) ? EHookState::CreateFailed
+                                  : (i == 2) ? EHookState::EnableFailed
+                                             : EHookState::Disabled;
+        USS_CHECK(Fixture.GetState(i) == Expected);
+        USS_CHECK(!Fixture.IsEnabled(i));
+    }
+
+    // Re-enabling picks up the disabled hooks only
+    USS_CHECK(Fixture.Registry.EnableAll() == EResult::HookFailed);
+    USS_CHECK(Fixture.Registry.GetCount(EHookState::Enabled) == NumHooks - 2);
+
+    // Every created hook is removed once; the one that never got created isn't
+    Fixture.Registry.Shutdown();
+    USS_CHECK(Fixture.Backend.GetRemoveCount() == NumHooks - 1);
+    USS_CHECK(!Fixture.Registry.IsInitialized());
+}
@@ -0,0 +1,249 @@
+/**
+ * UniversalSlashingSimulator - Log Format Tests
+ *
+ * Rendering is checked against what printf prints for the same call, and
+ * the binary file against the records it should hold.
+ */
+
+#include "TestHarness.h"
+#include "../../Core/Logging/Log.h"
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace USS;
+
+namespace
+{
+    template<typename... ArgTypes>
+    std::string Render(const char* Format, const ArgTypes&... Args)
+    {
+        uint8 Payload[256];
+        uint32 Size = EncodeLogArgs(Payload, sizeof(Payload), Args...);
+
+        char Out[256];
+        uint32 Length = RenderLogMessage(Format, Payload, Size, Out, sizeof(Out));
+        return std::string(Out, Length);
+    }
+
+    /**
+     * Cursor over a .usslog, mirroring Tools/LogDecoder
+     */
+    struct FFileCursor
+    {
+        const std::vector<uint8>& Data;
+        uint32 Offset = 0;
+
+        bool AtEnd() const { return Offset >= Data.size(); }
+
+        bool Byte(uint8& Out)
+        {
+            if (AtEnd())
+                return false;
+            Out = Data[Offset++];
+            return true;
+        }
+
+        bool Var(uint64& Out)
+        {
+            return DecodeVarInt(Data.data(), static_cast<uint32>(Data.size()), Offset, Out);
+        }
+
+        bool Span(std::string& Out)
+        {
+            uint64 Size = 0;
+            if (!Var(Size) || Size > Data.size() - Offset)
+                return false;
+            Out.assign(reinterpret_cast<const char*>(Data.data() + Offset), static_cast<size_t>(Size));
+            Offset += static_cast<uint32>(Size);
+            return true;
+        }
+    };
+
+    std::vector<uint8> ReadAll(const std::string& Path)
+    {
+        std::vector<uint8> Data;
+        FILE* File = fopen(Path.c_str(), "rb");
+        if (!File)
+            return Data;
+
+        uint8 Buffer[4096];
+        size_t Read;
+        while ((Read = fread(Buffer, 1, sizeof(Buffer), File)) > 0)
+            Data.insert(Data.end(), Buffer, Buffer + Read);
+
+        fclose(File);
+        return Data;
+    }
+}
+
+USS_TEST(LogFormat_IntegersKeepTheirWidth)
+{
+    USS_CHECK(Render("0x%08X %u", static_cast<int32>(0x80004005), -1) == "0x80004005 4294967295");
+    USS_CHECK(Render("%d", static_cast<uint32>(0xFFFFFFFF)) == "-1");
+    USS_CHECK(Render("%x", static_cast<int16>(-1)) == "ffffffff");
+    USS_CHECK(Render("%d %u", static_cast<uint8>(255), static_cast<int8>(-1)) == "255 4294967295");
+    USS_CHECK(Render("%llu %lld", static_cast<int64>(-1), static_cast<uint64>(~0ull)) == "18446744073709551615 -1");
+    USS_CHECK(Render("%c%c", 'o', 'k') == "ok");
+
+    // Version 1 payloads carry no width and read as 64-bit
+    const uint8 Legacy[] = { 1, static_cast<uint8>(ELogArgType::Int), 1 };
+    char Out[64];
+    RenderLogMessage("%u", Legacy, sizeof(Legacy), Out, sizeof(Out));
+    USS_CHECK(std::string(Out) == "18446744073709551615");
+}
+
+USS_TEST(LogFormat_StarAndPrecision)
+{
+    USS_CHECK(Render("[%*d]", 5, 42) == "[   42]");
+    USS_CHECK(Render("[%-*d]", 5, 42) == "[42   ]");
+    USS_CHECK(Render("[%.*s]", 3, "abcdef") == "[abc]");
+    USS_CHECK(Render("[%.10s]", "abc") == "[abc]");
+    USS_CHECK(Render("[%*.*f]", 8, 2, 3.14159) == "[    3.14]");
+    USS_CHECK(Render("%s", static_cast<const char*>(nullptr)) == "(null)");
+}
+
+USS_TEST(LogFormat_Truncation)
+{
+    // Output buffer: clipped and still terminated
+    uint8 Payload[64];
+    uint32 Size = EncodeLogArgs(Payload, sizeof(Payload), 123456789);
+
+    char Small[8];
+    USS_CHECK(RenderLogMessage("value %d", Payload, Size, Small, sizeof(Small)) == 7);
+    USS_CHECK(std::string(Small) == "value 1");
+
+    // Payload buffer: the string keeps what fits, later arguments drop out
+    Size = EncodeLogArgs(Payload, 16, "a very long string", 5);
+    USS_CHECK(Size <= 16);
+
+    char Out[64];
+    RenderLogMessage("%s %d", Payload, Size, Out, sizeof(Out));
+    USS_CHECK(std::string(Out) == "a ve <?>");
+
+    // Fewer arguments than conversions
+    USS_CHECK(Render("%d %d", 1) == "1 <?>");
+}
+
+USS_TEST(LogFormat_BinaryFileRoundTrip)
+{
+    const std::string Path = (std::filesystem::temp_directory_path() / "USSTests_LogFormat.usslog").string();
+
+    static FLogSite Site(ELogLevel::Info, "0x%08X %u %s", __FILE__, __LINE__);
+
+    USS_CHECK(Log::Initialize(false, Path.c_str(), ELogFileFormat::Binary) == EResult::Success);
+    Log::WriteSite(Site, static_cast<int32>(0x80004005), -1, "tail");
+    Log::WriteSite(Site, 1, 2u, "again");
+    Log::Write(ELogLevel::Warning, "plain %d", 7);
+    Log::Shutdown();
+
+    const std::vector<uint8> Data = ReadAll(Path);
+    std::remove(Path.c_str());
+
+    FFileCursor Cursor{ Data };
+
+    char Magic[sizeof(LogFileMagic)] = {};
+    uint32 Version = 0;
+    int64 BaseTimeUs = 0;
+
+    USS_CHECK(Data.size() > sizeof(Magic) + sizeof(Version) + sizeof(BaseTimeUs));
+    if (Data.size() <= sizeof(Magic) + sizeof(Version) + sizeof(BaseTimeUs))
+        return;
+
+    memcpy(Magic, Data.data(), sizeof(Magic));
+    memcpy(&Version, Data.data() + sizeof(Magic), sizeof(Version));
+    memcpy(&BaseTimeUs, Data.data() + sizeof(Magic) + sizeof(Version), sizeof(BaseTimeUs));
+    Cursor.Offset = sizeof(Magic) + sizeof(Version) + sizeof(BaseTimeUs);
+
+    USS_CHECK(memcmp(Magic, LogFileMagic, sizeof(Magic)) == 0);
+    USS_CHECK(Version == LogFileVersion);
+    USS_CHECK(BaseTimeUs > 0);
+
+    std::string Format;
+    std::vector<std::string> Messages;
+    uint32 SiteRecords = 0;
+
+    while (!Cursor.AtEnd())
+    {
+        uint8 Tag = 0, Level = 0;
+        uint64 Id = 0, Line = 0, Delta = 0, ThreadId = 0;
+        std::string File, Payload;
+        bool bOk = Cursor.Byte(Tag);
+
+        if (Tag == static_cast<uint8>(ELogRecordType::Site))
+        {
+            bOk = bOk && Cursor.Var(Id) && Cursor.Byte(Level) && Cursor.Var(Line) &&
+                  Cursor.Span(Format) && Cursor.Span(File);
+            USS_CHECK(Id == Site.Id && Line == Site.Line);
+            ++SiteRecords;
+        }
+        else if (Tag == static_cast<uint8>(ELogRecordType::Call))
+        {
+            bOk = bOk && Cursor.Var(Id) && Cursor.Var(Delta) && Cursor.Var(ThreadId) && Cursor.Span(Payload);
+
+            char Out[256];
+            uint32 Length = RenderLogMessage(Format.c_str(), reinterpret_cast<const uint8*>(Payload.data()),
+                static_cast<uint32>(Payload.size()), Out, sizeof(Out));
+            Messages.emplace_back(Out, Length);
+        }
+        else if (Tag == static_cast<uint8>(ELogRecordType::Text))
+        {
+            bOk = bOk && Cursor.Byte(Level) && Cursor.Var(Delta) && Cursor.Var(ThreadId) && Cursor.Span(Payload);
+            USS_CHECK(Level == static_cast<uint8>(ELogLevel::Warning));
+            Messages.push_back(Payload);
+        }
+        else
+        {
+            bOk = false;
+        }
+
+        USS_CHECK(bOk);
+        if (!bOk)
+            break;
+    }
+
+    // One site record, then its calls in order
+    USS_CHECK(SiteRecords == 1);
+    USS_CHECK(Format == Site.Format);
+    USS_CHECK(Messages.size() == 3);
+    if (Messages.size() == 3)
+    {
+        USS_CHECK(Messages[0] == "0x80004005 4294967295 tail");
+        USS_CHECK(Messages[1] == "0x00000001 2 again");
+        USS_CHECK(Messages[2] == "plain 7");
+    }
+}
+
+USS_TEST(LogFormat_SiteRateLimit)
+{
+    // Static - throttled sites stay linked into Log's summary list
+    static FLogSite Limited(ELogLevel::Info, "limited %d", __FILE__, __LINE__, 10);
+    static FLogSite Unlimited(ELogLevel::Info, "unlimited %d", __FILE__, __LINE__);
+    static FLogSite Fatal(ELogLevel::Fatal, "fatal %d", __FILE__, __LINE__, 1);
+
+    USS_CHECK(Log::Initialize(false) == EResult::Success);
+    Log::SetSiteRateLimit(0);
+
+    for (int32 i = 0; i < 100; ++i)
+    {
+        Log::WriteSite(Limited, i);
+        Log::WriteSite(Unlimited, i);
+    }
+
+    Log::WriteSite(Fatal, 1);
+    Log::WriteSite(Fatal, 2);
+
+    // 10/s with a second's burst admits ten back to back; the coarse clock
+    // may tick once or twice during the loop
+    const uint32 Suppressed = Limited.Limiter.Suppressed.load();
+    USS_CHECK(Suppressed >= 85 && Suppressed <= 90);
+    USS_CHECK(Unlimited.Limiter.Suppressed.load() == 0);
+    USS_CHECK(Fatal.Limiter.Suppressed.load() == 0);
+
+    Log::SetSiteRateLimit(Log::DefaultSiteRateLimit);
+    Log::Shutdown();
+
+    // Shutdown reports and resets the count
+    USS_CHECK(Limited.Limiter.Suppressed.load() == 0);
+}
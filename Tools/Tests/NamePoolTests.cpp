@@ -0,0 +1,48 @@
+/**
+ * UniversalSlashingSimulator - Name Pool Tests
+ *
+ * Names interned after the pool was initialized, landing in a block
+ * FNamePool allocated since, on the real reader over a mock engine image.
+ */
+
+#include "TestHarness.h"
+#include "../MockEngine/MockEngineImage.h"
+#include "../../Core/Versioning/VersionResolver.h"
+#include <string>
+
+using namespace USS;
+
+namespace
+{
+    // 11.0 (UE 4.24) - FNamePool
+    constexpr uint32 PoolCL = 5878874;
+}
+
+USS_TEST(NamePool_ResolvesNamesInBlocksAddedAfterInitialize)
+{
+    FVersionInfo Version;
+    FVersionResolver::LookupCL(PoolCL, Version);
+
+    FMockEngineImage Image(Version);
+
+    std::unique_ptr<INamePool> Pool = Image.CreateNamePool();
+    USS_CHECK(Pool != nullptr);
+    if (!Pool)
+        return;
+
+    // ~1K per entry: a few hundred fill the 128K block the pool started on
+    std::string Last;
+    int32 Index = 0;
+    for (int32 i = 0; i < 512 && (Index >> 16) == 0; ++i)
+    {
+        Last = "Late_" + std::to_string(i) + "_" + std::string(1000, 'x');
+        Index = Image.AddName(Last);
+    }
+
+    USS_CHECK((Index >> 16) == 1);
+
+    // No Refresh() - the miss itself has to pick the new block up
+    USS_CHECK(Pool->GetNameString(Index) == Last);
+    USS_CHECK(Pool->GetNameString(Index - 1).empty());
+    USS_CHECK(Pool->GetNameString(2 << 16).empty());
+}
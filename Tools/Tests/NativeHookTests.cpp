@@ -0,0 +1,119 @@
+/**
+ * UniversalSlashingSimulator - Native Hook Tests
+ *
+ * A typed hook on a mock-image UFunction, called the two ways the engine
+ * calls an exec thunk: from ProcessEvent and from script bytecode.
+ */
+
+#include "TestHarness.h"
+#include "../MockEngine/MockEngineImage.h"
+#include "../../Core/Versioning/VersionResolver.h"
+#include "../../Engine/CoreTypes/OffsetResolver.h"
+#include "../../Engine/Events/NativeHooks.h"
+#include "../../Engine/UObject/UObjectWrapper.h"
+
+using namespace USS;
+
+namespace
+{
+    // 11.0 (UE 4.24)
+    constexpr uint32 TestCL = 5878874;
+
+    struct FDamageParms
+    {
+        float Damage;
+        int32 InstigatorId;
+    };
+
+    int32 HandlerCalls = 0;
+    int32 OriginalCalls = 0;
+    float LastDamage = 0.0f;
+    bool bBlock = false;
+
+    bool OnDamaged(void* Object, FDamageParms& Parms)
+    {
+        (void)Object;
+        ++HandlerCalls;
+        LastDamage = Parms.Damage;
+        return !bBlock;
+    }
+
+    void OriginalExec(void* Context, void* Stack, void* Result)
+    {
+        (void)Context; (void)Stack; (void)Result;
+        ++OriginalCalls;
+    }
+
+    /**
+     * FFrame with just the fields the thunk reads
+     */
+    struct FTestFrame
+    {
+        alignas(16) uint8 Bytes[0x80] = {};
+
+        FTestFrame(void* Code, void* Locals)
+        {
+            const FOffsetTable& Offsets = GetOffsetResolver().GetOffsets();
+            FMockEngineImage::Write<void*>(Bytes, Offsets.Frame.Code, Code);
+            FMockEngineImage::Write<void*>(Bytes, Offsets.Frame.Locals, Locals);
+        }
+    };
+}
+
+USS_TEST(NativeHooks_HandlerSeesProcessEventCallsOnly)
+{
+    FVersionInfo Version;
+    FVersionResolver::LookupCL(TestCL, Version);
+
+    // The image lays UFunctions out with the resolved offsets
+    GetOffsetResolver().ResolveOffsets(Version);
+    USS_CHECK(GetOffsetResolver().GetOffsets().UFunction.Func > 0);
+
+    FMockEngineImage Image(Version);
+    void* PawnClass = Image.AddClass("FortPawn", Image.FindClass("Object"));
+    void* Function = Image.AddFunction(PawnClass, "OnDamageServer", FUNC_Native,
+        sizeof(FDamageParms), reinterpret_cast<void*>(&OriginalExec));
+
+    // Not native: refused
+    void* ScriptFunction = Image.AddFunction(PawnClass, "ReceiveDamage", 0, sizeof(FDamageParms));
+    USS_CHECK((GetNativeHooks().HookFunction<FDamageParms, &OnDamaged>("ReceiveDamage", ScriptFunction)) ==
+        EResult::InvalidParameter);
+
+    USS_CHECK((GetNativeHooks().HookFunction<FDamageParms, &OnDamaged>("OnDamageServer", Function)) ==
+        EResult::Success);
+    USS_CHECK(GetNativeHooks().IsHooked(Function));
+
+    FNativeFuncPtr Func = reinterpret_cast<FNativeFuncPtr>(UFunctionWrapper(Function).GetNativeFunc());
+    USS_CHECK(Func != nullptr && Func != &OriginalExec);
+    if (!Func || Func == &OriginalExec)
+    {
+        GetNativeHooks().UnhookAll();
+        return;
+    }
+
+    uint64 Pawn = 0;
+    FDamageParms Parms = { 25.0f, 7 };
+
+    // ProcessEvent: no bytecode, Locals is the finished parameter block
+    FTestFrame EventFrame(nullptr, &Parms);
+    Func(&Pawn, EventFrame.Bytes, nullptr);
+    USS_CHECK(HandlerCalls == 1 && LastDamage == 25.0f);
+    USS_CHECK(OriginalCalls == 1);
+
+    // Script: Code points into the caller's bytecode - straight to the original
+    uint8 Bytecode[4] = {};
+    FTestFrame ScriptFrame(Bytecode, &Parms);
+    Func(&Pawn, ScriptFrame.Bytes, nullptr);
+    USS_CHECK(HandlerCalls == 1);
+    USS_CHECK(OriginalCalls == 2);
+
+    // A handler returning false skips the original
+    bBlock = true;
+    Func(&Pawn, EventFrame.Bytes, nullptr);
+    bBlock = false;
+    USS_CHECK(HandlerCalls == 2 && OriginalCalls == 2);
+
+    GetNativeHooks().UnhookAll();
+    USS_CHECK(!GetNativeHooks().IsHooked(Function));
+    USS_CHECK(UFunctionWrapper(Function).GetNativeFunc() == reinterpret_cast<void*>(&OriginalExec));
+}
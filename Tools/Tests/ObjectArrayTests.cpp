@@ -0,0 +1,155 @@
+/**
+ * UniversalSlashingSimulator - Object Array Tests
+ *
+ * Objects created after the array was initialized, as every actor
+ * spawned in a match is, on the real readers over a mock engine image.
+ */
+
+#include "TestHarness.h"
+#include "../MockEngine/MockEngineImage.h"
+#include "../../Core/Versioning/VersionResolver.h"
+#include "../../Engine/EngineCore.h"
+#include "../../Engine/UObject/WeakObjectHandle.h"
+
+using namespace USS;
+
+namespace
+{
+    // 1.10 (UE 4.19) - fixed FUObjectItem array
+    constexpr uint32 FixedCL = 3790078;
+
+    // 11.0 (UE 4.24) - chunked, 64K items per chunk
+    constexpr uint32 ChunkedCL = 5878874;
+
+    constexpr int32 ItemsPerChunk = 64 * 1024;
+
+    FVersionInfo GetVersion(uint32 CL)
+    {
+        FVersionInfo Version;
+        FVersionResolver::LookupCL(CL, Version);
+        return Version;
+    }
+
+    void CheckLateObject(uint32 CL)
+    {
+        FMockEngineImage Image(GetVersion(CL));
+        void* ObjectClass = Image.FindClass("Object");
+
+        std::unique_ptr<IObjectArray> Array = Image.CreateObjectArray();
+        USS_CHECK(Array != nullptr);
+        if (!Array)
+            return;
+
+        const int32 NumAtInitialize = Array->Num();
+
+        void* Late = Image.AddObject("LateObject", ObjectClass);
+        const int32 Index = UObjectWrapper(Late).GetInternalIndex();
+        USS_CHECK(Index == NumAtInitialize);
+
+        // No Refresh() - the miss itself has to pick the new count up
+        USS_CHECK(Array->IsValidIndex(Index));
+        USS_CHECK(Array->GetByIndex(Index) == Late);
+
+        FObjectItem Item;
+        USS_CHECK(Array->GetItemByIndex(Index, Item));
+        USS_CHECK(Item.Object == Late);
+
+        USS_CHECK(Array->Num() == NumAtInitialize + 1);
+        USS_CHECK(!Array->IsValidIndex(Index + 1));
+    }
+}
+
+USS_TEST(ObjectArray_FixedSeesObjectsAddedAfterInitialize)
+{
+    CheckLateObject(FixedCL);
+}
+
+USS_TEST(ObjectArray_ChunkedSeesObjectsAddedAfterInitialize)
+{
+    CheckLateObject(ChunkedCL);
+}
+
+USS_TEST(ObjectArray_ChunkedLoadsChunksAddedAfterInitialize)
+{
+    FMockEngineImage Image(GetVersion(ChunkedCL));
+    void* ObjectClass = Image.FindClass("Object");
+
+    std::unique_ptr<IObjectArray> Array = Image.CreateObjectArray();
+    USS_CHECK(Array != nullptr);
+    if (!Array)
+        return;
+
+    // Fill the first chunk so the next object lands in one the array
+    // has never seen
+    void* Late = nullptr;
+    while (Image.GetNumObjects() <= ItemsPerChunk)
+    {
+        Late = Image.AddObject("Filler", ObjectClass);
+    }
+
+    const int32 Index = UObjectWrapper(Late).GetInternalIndex();
+    USS_CHECK(Index == ItemsPerChunk);
+    USS_CHECK(Array->GetByIndex(Index) == Late);
+
+    FObjectItem Item;
+    USS_CHECK(Array->GetItemByIndex(Index, Item));
+    USS_CHECK(Item.Object == Late);
+}
+
+USS_TEST(WeakObjectHandle_ResolvesObjectCreatedAfterInitialize)
+{
+    for (uint32 CL : { FixedCL, ChunkedCL })
+    {
+        FMockEngineImage Image(GetVersion(CL));
+        void* ObjectClass = Image.FindClass("Object");
+
+        USS_CHECK(GetEngineCore().InitializeWithTables(Image.CreateObjectArray(), Image.CreateNamePool()) == EResult::Success);
+
+        void* Late = Image.AddObject("LatePlayerController", ObjectClass);
+
+        TWeakObjectHandle<> Handle(Late);
+        USS_CHECK(Handle.GetRaw() == Late);
+        USS_CHECK(Handle.IsValid());
+        USS_CHECK(Handle.Get().GetRaw() == Late);
+
+        // The engine core must let go before the image is freed
+        GetEngineCore().Shutdown();
+    }
+}
+
+USS_TEST(WeakObjectHandle_RejectsNewObjectInReusedSlotAndAddress)
+{
+    for (uint32 CL : { FixedCL, ChunkedCL })
+    {
+        FMockEngineImage Image(GetVersion(CL));
+        void* ObjectClass = Image.FindClass("Object");
+        void* PawnClass = Image.AddClass("PlayerPawn_C", ObjectClass);
+        void* ProjectileClass = Image.AddClass("Projectile_C", ObjectClass);
+
+        USS_CHECK(GetEngineCore().InitializeWithTables(Image.CreateObjectArray(), Image.CreateNamePool()) == EResult::Success);
+
+        void* Pawn = Image.AddObject("PlayerPawn_C_1", PawnClass);
+        TWeakObjectHandle<> Handle(Pawn);
+        USS_CHECK(Handle.IsValid() && Handle.GetSerialNumber() == 0);
+
+        Image.FreeObject(Pawn);
+        USS_CHECK(!Handle.IsValid());
+
+        // Respawned into the same slot and memory, no serial either way
+        void* Respawned = Image.ReuseObject(Pawn, "PlayerPawn_C_2", PawnClass);
+        USS_CHECK(Respawned == Pawn);
+        USS_CHECK(UObjectWrapper(Respawned).GetInternalIndex() == Handle.GetIndex());
+        USS_CHECK(!Handle.IsValid());
+        USS_CHECK(Handle.Get().GetRaw() == nullptr);
+
+        TWeakObjectHandle<> Fresh(Respawned);
+        USS_CHECK(Fresh.IsValid());
+
+        // Same name, different class
+        Image.FreeObject(Respawned);
+        Image.ReuseObject(Respawned, "PlayerPawn_C_2", ProjectileClass);
+        USS_CHECK(!Fresh.IsValid());
+
+        GetEngineCore().Shutdown();
+    }
+}
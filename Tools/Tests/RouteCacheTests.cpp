@@ -0,0 +1,80 @@
+/**
+ * UniversalSlashingSimulator - ProcessEvent Routing Tests
+ */
+
+#include "TestHarness.h"
+#include "../../STW/GameMode/RouteCache.h"
+#include "../../STW/GameMode/STWGameMode.h"
+
+using namespace USS;
+
+namespace
+{
+    // Stand-in UFunctions - only their addresses are used
+    uint64 Functions[64];
+}
+
+USS_TEST(ClassifyFunction_EarlierRulesWin)
+{
+    USS_CHECK(FSTWGameMode::ClassifyFunction("ReadyToStartMatch") == EProcessEventRoute::ReadyToStartMatch);
+    USS_CHECK(FSTWGameMode::ClassifyFunction("ServerLoadingScreenDropped") == EProcessEventRoute::LoadingScreenDropped);
+    USS_CHECK(FSTWGameMode::ClassifyFunction("ServerHandleMissionEvent_ToggledEditMode") == EProcessEventRoute::ToggleEditMode);
+    USS_CHECK(FSTWGameMode::ClassifyFunction("ServerHandleMissionEvent_StartLeavingZone") == EProcessEventRoute::StartLeavingZone);
+    USS_CHECK(FSTWGameMode::ClassifyFunction("ServerCraftSchematic") == EProcessEventRoute::CraftSchematic);
+    USS_CHECK(FSTWGameMode::ClassifyFunction("ReceiveTick") == EProcessEventRoute::Tick);
+
+    // Server RPCs matching a rule take the rule, not Forward
+    USS_CHECK(FSTWGameMode::ClassifyFunction("ServerReadyToStartMatch") == EProcessEventRoute::ReadyToStartMatch);
+    USS_CHECK(FSTWGameMode::ClassifyFunction("ServerCraftSchematicTick") == EProcessEventRoute::CraftSchematic);
+
+    USS_CHECK(FSTWGameMode::ClassifyFunction("ServerExecuteInventoryItem") == EProcessEventRoute::Forward);
+    USS_CHECK(FSTWGameMode::ClassifyFunction("ClientServerNotice") == EProcessEventRoute::None);
+    USS_CHECK(FSTWGameMode::ClassifyFunction("K2_OnDeath") == EProcessEventRoute::None);
+}
+
+USS_TEST(RouteCache_FindsWhatWasAdded)
+{
+    FRouteCache Cache;
+
+    uint8 Value = 0;
+    USS_CHECK(!Cache.Find(&Functions[0], Value));
+
+    USS_CHECK(Cache.Add(&Functions[0], 3));
+    USS_CHECK(Cache.Add(&Functions[1], 0));
+    USS_CHECK(Cache.Find(&Functions[0], Value) && Value == 3);
+    USS_CHECK(Cache.Find(&Functions[1], Value) && Value == 0);
+
+    // Adding again keeps the first value
+    USS_CHECK(Cache.Add(&Functions[0], 5));
+    USS_CHECK(Cache.Find(&Functions[0], Value) && Value == 3);
+
+    Cache.Clear();
+    USS_CHECK(!Cache.Find(&Functions[0], Value));
+    USS_CHECK(!Cache.Find(&Functions[1], Value));
+}
+
+USS_TEST(RouteCache_FullTableFallsBackToUncached)
+{
+    // As many slots as one probe covers, so every insert competes
+    FRouteCache Cache(FRouteCache::MaxProbe);
+
+    for (uint32 i = 0; i < FRouteCache::MaxProbe; ++i)
+    {
+        USS_CHECK(Cache.Add(&Functions[i], static_cast<uint8>(i)));
+    }
+
+    uint8 Value = 0;
+    USS_CHECK(!Cache.Add(&Functions[FRouteCache::MaxProbe], 1));
+    USS_CHECK(!Cache.Find(&Functions[FRouteCache::MaxProbe], Value));
+
+    // What was cached before the table filled is still served
+    for (uint32 i = 0; i < FRouteCache::MaxProbe; ++i)
+    {
+        USS_CHECK(Cache.Find(&Functions[i], Value) && Value == i);
+    }
+
+    // Room again once cleared, as on a zone change
+    Cache.Clear();
+    USS_CHECK(Cache.Add(&Functions[FRouteCache::MaxProbe], 1));
+    USS_CHECK(Cache.Find(&Functions[FRouteCache::MaxProbe], Value) && Value == 1);
+}
@@ -0,0 +1,46 @@
+/**
+ * UniversalSlashingSimulator - Test Harness
+ *
+ * Minimal self-registering test cases for USSTests. Each USS_TEST body
+ * runs once; a failed USS_CHECK reports its file, line and expression and
+ * marks the case failed but keeps going, so one run lists every failure.
+ */
+
+#pragma once
+
+#include "../../Core/Common.h"
+#include <vector>
+
+namespace USS
+{
+    namespace Test
+    {
+        using FTestFn = void(*)();
+
+        struct FTestCase
+        {
+            const char* Name;
+            FTestFn Fn;
+        };
+
+        std::vector<FTestCase>& GetTestCases();
+
+        void ReportFailure(const char* File, int32 Line, const char* Expression);
+
+        struct FTestRegistrar
+        {
+            FTestRegistrar(const char* Name, FTestFn Fn)
+            {
+                GetTestCases().push_back({ Name, Fn });
+            }
+        };
+    }
+}
+
+#define USS_TEST(Name) \
+    static void Name(); \
+    static ::USS::Test::FTestRegistrar Name##_Registrar(#Name, &Name); \
+    static void Name()
+
+#define USS_CHECK(Expression) \
+    do { if (!(Expression)) ::USS::Test::ReportFailure(__FILE__, __LINE__, #Expression); } while (0)
@@ -0,0 +1,81 @@
+/**
+ * UniversalSlashingSimulator - Test Runner
+ *
+ * Usage:
+ *   USSTests [-filter Text]
+ *
+ * Runs every registered case whose name contains Text and exits nonzero
+ * if any check failed.
+ */
+
+#include "TestHarness.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace USS
+{
+    namespace Test
+    {
+        namespace
+        {
+            int32 g_CaseFailures = 0;
+        }
+
+        std::vector<FTestCase>& GetTestCases()
+        {
+            static std::vector<FTestCase> Cases;
+            return Cases;
+        }
+
+        void ReportFailure(const char* File, int32 Line, const char* Expression)
+        {
+            printf("  %s:%d: check failed: %s\n", File, Line, Expression);
+            ++g_CaseFailures;
+        }
+
+        int32 RunAll(const char* Filter)
+        {
+            int32 Run = 0;
+            int32 Failed = 0;
+
+            for (const FTestCase& Case : GetTestCases())
+            {
+                if (Filter && !strstr(Case.Name, Filter))
+                    continue;
+
+                g_CaseFailures = 0;
+                Case.Fn();
+                ++Run;
+
+                if (g_CaseFailures > 0)
+                    ++Failed;
+
+                printf("%-48s %s\n", Case.Name, g_CaseFailures > 0 ? "FAILED" : "ok");
+            }
+
+            printf("\n%d cases, %d failed\n", Run, Failed);
+            return Failed;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const char* Filter = nullptr;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-filter") == 0 && i + 1 < argc)
+        {
+            Filter = argv[++i];
+        }
+        else
+        {
+            printf("Usage: USSTests [-filter Text]\n");
+            return 2;
+        }
+    }
+
+    return USS::Test::RunAll(Filter) == 0 ? 0 : 1;
+}
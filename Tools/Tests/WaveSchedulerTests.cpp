@@ -0,0 +1,163 @@
+/**
+ * UniversalSlashingSimulator - Wave Scheduler Tests
+ */
+
+#include "TestHarness.h"
+#include "../../STW/Missions/WaveScheduler.h"
+
+using namespace USS;
+
+namespace
+{
+    /**
+     * Resolves every class to the same dummy handle and fails the first
+     * FailuresLeft spawns
+     */
+    class FTestSpawner : public IEnemySpawner
+    {
+    public:
+        int32 FailuresLeft = 0;
+        int32 Spawned = 0;
+        int32 Calls = 0;
+
+        void* ResolveSpawnClass(const std::string&) override
+        {
+            return &m_Class;
+        }
+
+        EResult SpawnEnemy(void* SpawnClass, const FSpawnRequest&) override
+        {
+            ++Calls;
+
+            if (SpawnClass != &m_Class)
+                return EResult::InvalidParameter;
+
+            if (FailuresLeft > 0)
+            {
+                --FailuresLeft;
+                return EResult::Failed;
+            }
+
+            ++Spawned;
+            return EResult::Success;
+        }
+
+    private:
+        int32 m_Class = 0;
+    };
+
+    FMissionConfig MakeConfig(float SpawnBudgetMs)
+    {
+        FMissionConfig Config;
+        Config.SpawnBudgetMs = SpawnBudgetMs;
+        return Config;
+    }
+}
+
+USS_TEST(WaveScheduler_NoSpawnerStaysIdle)
+{
+    FWaveScheduler Scheduler;
+
+    USS_CHECK(Scheduler.PrepareMission(MakeConfig(0.0f)) == EResult::NotInitialized);
+    USS_CHECK(Scheduler.EnqueueWave(1, 4) == EResult::NotInitialized);
+    USS_CHECK(Scheduler.Tick() == 0);
+}
+
+USS_TEST(WaveScheduler_ResetRestoresBaseBudget)
+{
+    FTestSpawner Spawner;
+    FWaveScheduler Scheduler;
+    Scheduler.SetSpawner(&Spawner);
+
+    USS_CHECK(Scheduler.PrepareMission(MakeConfig(5.0f)) == EResult::Success);
+    USS_CHECK(Scheduler.GetBudgetMs() == 5.0);
+
+    // The next mission doesn't set a budget, so it gets the default back
+    USS_CHECK(Scheduler.PrepareMission(MakeConfig(0.0f)) == EResult::Success);
+    USS_CHECK(Scheduler.GetBudgetMs() == FWaveScheduler::DefaultBudgetMs);
+
+    Scheduler.SetBudgetMs(2.0);
+    USS_CHECK(Scheduler.PrepareMission(MakeConfig(7.0f)) == EResult::Success);
+    Scheduler.Reset();
+    USS_CHECK(Scheduler.GetBudgetMs() == 2.0);
+}
+
+USS_TEST(WaveScheduler_ZeroBudgetSpawnsOnePerTick)
+{
+    FTestSpawner Spawner;
+    FWaveScheduler Scheduler;
+    Scheduler.SetSpawner(&Spawner);
+    Scheduler.SetBudgetMs(0.0);
+
+    USS_CHECK(Scheduler.PrepareMission(MakeConfig(0.0f)) == EResult::Success);
+    USS_CHECK(Scheduler.EnqueueWave(1, 3) == EResult::Success);
+
+    USS_CHECK(Scheduler.Tick() == 1);
+    USS_CHECK(Scheduler.GetQueueDepth() == 2);
+    USS_CHECK(Scheduler.Tick() == 1);
+    USS_CHECK(Scheduler.Tick() == 1);
+    USS_CHECK(!Scheduler.HasPendingSpawns());
+    USS_CHECK(Spawner.Spawned == 3);
+}
+
+USS_TEST(WaveScheduler_FailedSpawnIsRetriedNextTick)
+{
+    FTestSpawner Spawner;
+    Spawner.FailuresLeft = 1;
+
+    FWaveScheduler Scheduler;
+    Scheduler.SetSpawner(&Spawner);
+
+    USS_CHECK(Scheduler.PrepareMission(MakeConfig(0.0f)) == EResult::Success);
+    USS_CHECK(Scheduler.EnqueueWave(1, 1) == EResult::Success);
+
+    // Not retried within the tick that failed it
+    USS_CHECK(Scheduler.Tick() == 0);
+    USS_CHECK(Spawner.Calls == 1);
+    USS_CHECK(Scheduler.GetQueueDepth() == 1);
+    USS_CHECK(Scheduler.GetStats().TotalRetried == 1);
+
+    USS_CHECK(Scheduler.Tick() == 1);
+    USS_CHECK(!Scheduler.HasPendingSpawns());
+    USS_CHECK(Scheduler.GetStats().TotalSpawned == 1);
+    USS_CHECK(Scheduler.GetStats().TotalFailed == 0);
+}
+
+USS_TEST(WaveScheduler_SpawnDroppedAfterMaxAttempts)
+{
+    FTestSpawner Spawner;
+    Spawner.FailuresLeft = 1000;
+
+    FWaveScheduler Scheduler;
+    Scheduler.SetSpawner(&Spawner);
+
+    USS_CHECK(Scheduler.PrepareMission(MakeConfig(0.0f)) == EResult::Success);
+    USS_CHECK(Scheduler.EnqueueWave(1, 1) == EResult::Success);
+
+    for (int32 i = 0; i < FWaveScheduler::MaxSpawnAttempts; ++i)
+    {
+        USS_CHECK(Scheduler.Tick() == 0);
+    }
+
+    USS_CHECK(!Scheduler.HasPendingSpawns());
+    USS_CHECK(Spawner.Calls == FWaveScheduler::MaxSpawnAttempts);
+    USS_CHECK(Scheduler.GetStats().TotalRetried == static_cast<uint64>(FWaveScheduler::MaxSpawnAttempts - 1));
+    USS_CHECK(Scheduler.GetStats().TotalFailed == 1);
+}
+
+USS_TEST(WaveScheduler_SetSpawnerDropsQueuedRequests)
+{
+    FTestSpawner First;
+    FTestSpawner Second;
+
+    FWaveScheduler Scheduler;
+    Scheduler.SetSpawner(&First);
+
+    USS_CHECK(Scheduler.PrepareMission(MakeConfig(0.0f)) == EResult::Success);
+    USS_CHECK(Scheduler.EnqueueWave(1, 2) == EResult::Success);
+
+    Scheduler.SetSpawner(&Second);
+    USS_CHECK(!Scheduler.HasPendingSpawns());
+    USS_CHECK(Scheduler.Tick() == 0);
+    USS_CHECK(Second.Calls == 0);
+}